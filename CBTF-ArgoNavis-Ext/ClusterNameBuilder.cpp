@@ -23,58 +23,147 @@
 
 #include <CBTF-ArgoNavis-Ext/ClusterNameBuilder.h>
 
-#include <QMap>
+#include <QReadLocker>
+#include <QWriteLocker>
+
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
 
 namespace ArgoNavis { namespace CUDA {
 
-QMap< boost::uint64_t, QMap< boost::uint64_t, boost::uint16_t > > m_tidmap;
 
-const QString getUniqueClusterName(const Base::ThreadName& thread)
+/**
+ * @brief ClusterNameRegistry::ThreadKey::operator <
+ * @param other - the other thread key
+ * @return - whether this thread key orders before the other thread key
+ */
+bool ClusterNameRegistry::ThreadKey::operator<(const ThreadKey &other) const
 {
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
-    QString clusterName = QString::fromStdString( thread.host() );
-#else
-    QString clusterName = QString( thread.host().c_str() );
-#endif
+    return boost::tie( pid, host, hasRank, rank, hasTid, tid ) <
+            boost::tie( other.pid, other.host, other.hasRank, other.rank, other.hasTid, other.tid );
+}
 
-#ifdef HAS_STRIP_DOMAIN_NAME
-    int index = clusterName.indexOf( '.' );
-    if ( index > 0 )
-        clusterName = clusterName.left( index );
-#endif
+/**
+ * @brief ClusterNameRegistry::ClusterNameRegistry
+ *
+ * Constructs an empty ClusterNameRegistry instance.
+ */
+ClusterNameRegistry::ClusterNameRegistry()
+{
 
-    const boost::uint64_t pid = thread.pid();
-    clusterName += ( "+p" + QString::number(pid) );
+}
 
-    // append MPI rank (if any)
-    const boost::optional<boost::uint32_t> mpiRank = thread.mpi_rank();
-    if ( mpiRank ) {
-        clusterName += ( "+r" + QString::number(mpiRank.get()) );
+/**
+ * @brief ClusterNameRegistry::instance
+ * @return - the ClusterNameRegistry singleton
+ */
+ClusterNameRegistry &ClusterNameRegistry::instance()
+{
+    static ClusterNameRegistry s_instance;
+
+    return s_instance;
+}
+
+/**
+ * @brief ClusterNameRegistry::getClusterId
+ * @param thread - the ArgoNavis thread name
+ * @return - the dense identifier of the thread
+ */
+int ClusterNameRegistry::getClusterId(const Base::ThreadName &thread)
+{
+    {
+        QReadLocker guard( &m_lock );
+
+        std::map< Base::ThreadName, int >::const_iterator iter = m_threadNameIds.find( thread );
+        if ( iter != m_threadNameIds.end() )
+            return iter->second;
     }
 
+    ThreadKey key;
+
+    key.host = thread.host();
+    key.pid = thread.pid();
+
+    // MPI rank (if any)
+    const boost::optional<boost::uint32_t> mpiRank = thread.mpi_rank();
+    key.hasRank = mpiRank.is_initialized();
+    key.rank = mpiRank ? mpiRank.get() : 0;
+
     const boost::optional<boost::uint64_t> tidval = thread.tid();
-    if ( tidval ) {
-        QMap< boost::uint64_t, boost::uint16_t >& tidmap = m_tidmap[ pid ]; // adds new element if 'pid' not in map already
-        uint64_t tid = tidval.get();
-        uint16_t val;
-        if ( tidmap.contains( tid ) ) {
-            val = tidmap[tid];
-        }
-        else {
-            val = tidmap[tid] = tidmap.size();
-        }
-        clusterName += ( "+t" + QString::number(val) );
+    key.hasTid = tidval.is_initialized();
+    key.tid = tidval ? tidval.get() : 0;
+
+    const int clusterId = getClusterId( key );
+
+    QWriteLocker guard( &m_lock );
+
+    m_threadNameIds.insert( std::make_pair( thread, clusterId ) );
+
+    return clusterId;
+}
+
+/**
+ * @brief ClusterNameRegistry::getClusterId
+ * @param thread - the Open|SpeedShop thread
+ * @return - the dense identifier of the thread
+ *
+ * The thread attributes are only queried from the experiment database the first time the thread is seen.
+ */
+int ClusterNameRegistry::getClusterId(const OpenSpeedShop::Framework::Thread &thread)
+{
+    {
+        QReadLocker guard( &m_lock );
+
+        std::map< OpenSpeedShop::Framework::Thread, int >::const_iterator iter = m_threadIds.find( thread );
+        if ( iter != m_threadIds.end() )
+            return iter->second;
     }
 
-    return clusterName;
+    ThreadKey key;
+
+    key.host = thread.getHost();
+    key.pid = thread.getProcessId();
+
+    // MPI rank (if any)
+    const std::pair<bool, int> mpiRank = thread.getMPIRank();
+    key.hasRank = mpiRank.first;
+    key.rank = mpiRank.first ? mpiRank.second : 0;
+
+    const std::pair< bool, pthread_t> tidval = thread.getPosixThreadId();
+    key.hasTid = tidval.first;
+    key.tid = tidval.first ? tidval.second : 0;
+
+    const int clusterId = getClusterId( key );
+
+    QWriteLocker guard( &m_lock );
+
+    m_threadIds.insert( std::make_pair( thread, clusterId ) );
+
+    return clusterId;
 }
 
-const QString getUniqueClusterName(const OpenSpeedShop::Framework::Thread& thread)
+/**
+ * @brief ClusterNameRegistry::getClusterId
+ * @param key - the attributes identifying the thread
+ * @return - the dense identifier of the thread
+ *
+ * Assigns the next identifier to a thread not seen before and builds its cluster name.  A thread id is numbered in
+ * the order it is first seen within its process.
+ */
+int ClusterNameRegistry::getClusterId(const ThreadKey &key)
 {
+    {
+        QReadLocker guard( &m_lock );
+
+        std::map< ThreadKey, int >::const_iterator iter = m_keyIds.find( key );
+        if ( iter != m_keyIds.end() )
+            return iter->second;
+    }
+
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
-    QString clusterName = QString::fromStdString( thread.getHost() );
+    QString clusterName = QString::fromStdString( key.host );
 #else
-    QString clusterName = QString( thread.getHost().c_str() );
+    QString clusterName = QString( key.host.c_str() );
 #endif
 
 #ifdef HAS_STRIP_DOMAIN_NAME
@@ -83,35 +172,108 @@ const QString getUniqueClusterName(const OpenSpeedShop::Framework::Thread& threa
         clusterName = clusterName.left( index );
 #endif
 
-    const pid_t pid = thread.getProcessId();
-    clusterName += ( "+p" + QString::number(pid) );
+    clusterName += ( "+p" + QString::number(key.pid) );
 
     // append MPI rank (if any)
-    const std::pair<bool, int> mpiRank = thread.getMPIRank();
-    if ( mpiRank.first ) {
-        clusterName += ( "+r" + QString::number(mpiRank.second) );
+    if ( key.hasRank ) {
+        clusterName += ( "+r" + QString::number(key.rank) );
     }
 
-    const std::pair< bool, pthread_t> tidval = thread.getPosixThreadId();
-    if ( tidval.first ) {
-        QMap< boost::uint64_t, boost::uint16_t >& tidmap = m_tidmap[ pid ]; // adds new element if 'pid' not in map already
-        uint64_t tid = tidval.second;
+    QWriteLocker guard( &m_lock );
+
+    // another thread may have registered the same thread while the lock was released
+    std::map< ThreadKey, int >::const_iterator iter = m_keyIds.find( key );
+    if ( iter != m_keyIds.end() )
+        return iter->second;
+
+    if ( key.hasTid ) {
+        QHash< boost::uint64_t, boost::uint16_t >& tidmap = m_tidmap[ key.pid ]; // adds new element if 'pid' not in map already
         uint16_t val;
-        if ( tidmap.contains( tid ) ) {
-            val = tidmap[tid];
+        if ( tidmap.contains( key.tid ) ) {
+            val = tidmap[key.tid];
         }
         else {
-            val = tidmap[tid] = tidmap.size();
+            val = tidmap.size();
+            tidmap.insert( key.tid, val );
         }
         clusterName += ( "+t" + QString::number(val) );
     }
 
-    return clusterName;
+    const int clusterId = m_clusterNames.size();
+
+    m_clusterNames << clusterName;
+    m_keyIds.insert( std::make_pair( key, clusterId ) );
+
+    return clusterId;
 }
 
-void resetThreadMap()
+/**
+ * @brief ClusterNameRegistry::getClusterName
+ * @param clusterId - the thread identifier
+ * @return - the interned cluster name of the thread or an empty string if the identifier is not known
+ */
+QString ClusterNameRegistry::getClusterName(int clusterId) const
+{
+    QReadLocker guard( &m_lock );
+
+    return m_clusterNames.value( clusterId );
+}
+
+/**
+ * @brief ClusterNameRegistry::size
+ * @return - the number of identifiers assigned
+ */
+int ClusterNameRegistry::size() const
+{
+    QReadLocker guard( &m_lock );
+
+    return m_clusterNames.size();
+}
+
+/**
+ * @brief ClusterNameRegistry::reset
+ *
+ * Forget all threads.  Identifiers and thread numbers are assigned from zero again.
+ */
+void ClusterNameRegistry::reset()
 {
+    QWriteLocker guard( &m_lock );
+
+    m_keyIds.clear();
+    m_threadNameIds.clear();
+    m_threadIds.clear();
     m_tidmap.clear();
+    m_clusterNames.clear();
+}
+
+
+int getUniqueClusterId(const Base::ThreadName& thread)
+{
+    return ClusterNameRegistry::instance().getClusterId( thread );
+}
+
+int getUniqueClusterId(const OpenSpeedShop::Framework::Thread& thread)
+{
+    return ClusterNameRegistry::instance().getClusterId( thread );
+}
+
+const QString getUniqueClusterName(const Base::ThreadName& thread)
+{
+    ClusterNameRegistry& registry = ClusterNameRegistry::instance();
+
+    return registry.getClusterName( registry.getClusterId( thread ) );
+}
+
+const QString getUniqueClusterName(const OpenSpeedShop::Framework::Thread& thread)
+{
+    ClusterNameRegistry& registry = ClusterNameRegistry::instance();
+
+    return registry.getClusterName( registry.getClusterId( thread ) );
+}
+
+void resetThreadMap()
+{
+    ClusterNameRegistry::instance().reset();
 }
 
 } // CUDA
@@ -25,14 +25,77 @@
 #define CLUSTERNAMEBUILDER_H
 
 #include <QString>
+#include <QVector>
+#include <QHash>
+#include <QReadWriteLock>
+
+#include <map>
+#include <string>
 
 #include "ArgoNavis/Base/ThreadName.hpp"
 #include "Thread.hxx"
 
 namespace ArgoNavis { namespace CUDA {
 
+    /*!
+     * \brief The ClusterNameRegistry class
+     *
+     * Thread-safe registry assigning each thread a dense integer identifier the first time it is seen and interning
+     * its unique cluster name ("host+pPID+rRANK+tN").  Subsequent lookups of the same thread return the identifier and
+     * the shared cluster name string without querying the thread or building the name again.  The same identifier is
+     * assigned to a thread whether it is given as an ArgoNavis thread name or an Open|SpeedShop thread.
+     */
+
+    class ClusterNameRegistry
+    {
+    public:
+
+        static ClusterNameRegistry& instance();
+
+        int getClusterId(const Base::ThreadName& thread);
+        int getClusterId(const OpenSpeedShop::Framework::Thread& thread);
+
+        QString getClusterName(int clusterId) const;
+
+        int size() const;
+
+        void reset();
+
+    private:
+
+        ClusterNameRegistry();
+
+        Q_DISABLE_COPY(ClusterNameRegistry)
+
+        // the attributes identifying a thread from which the cluster name is built
+        struct ThreadKey {
+            std::string host;
+            boost::uint64_t pid;
+            bool hasRank;
+            boost::int64_t rank;
+            bool hasTid;
+            boost::uint64_t tid;
+            bool operator<(const ThreadKey& other) const;
+        };
+
+        int getClusterId(const ThreadKey& key);
+
+        mutable QReadWriteLock m_lock;
+
+        std::map< ThreadKey, int > m_keyIds;                                        // map thread attributes to identifier
+        std::map< Base::ThreadName, int > m_threadNameIds;                          // map ArgoNavis thread name to identifier
+        std::map< OpenSpeedShop::Framework::Thread, int > m_threadIds;              // map Open|SpeedShop thread to identifier
+        QHash< boost::uint64_t, QHash< boost::uint64_t, boost::uint16_t > > m_tidmap; // per process, map POSIX thread id to thread number
+        QVector< QString > m_clusterNames;                                          // interned cluster name of each identifier
+
+    };
+
     void resetThreadMap();
 
+    int getUniqueClusterId(const Base::ThreadName& thread);
+
+    int getUniqueClusterId(const OpenSpeedShop::Framework::Thread& thread);
+
     const QString getUniqueClusterName(const Base::ThreadName& thread);
 
     const QString getUniqueClusterName(const OpenSpeedShop::Framework::Thread& thread);
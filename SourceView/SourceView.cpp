@@ -71,11 +71,14 @@ SourceView::SourceView(QWidget *parent)
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
     connect( this, &SourceView::addMetricView, &m_metricsCache, &SourceViewMetricsCache::handleAddMetricView );
     connect( this, &SourceView::addMetricViewData, &m_metricsCache, &SourceViewMetricsCache::handleAddMetricViewData );
+    connect( this, &SourceView::addMetricViewDataBlock, &m_metricsCache, &SourceViewMetricsCache::handleAddMetricViewDataBlock );
 #else
     connect( this, SIGNAL(addMetricView(QString,QString,QString,QString,QStringList)),
              &m_metricsCache, SLOT(handleAddMetricView(QString,QString,QString,QString,QStringList)) );
     connect( this, SIGNAL(addMetricViewData(QString,QString,QString,QString,QVariantList,QStringList)),
              &m_metricsCache, SLOT(handleAddMetricViewData(QString,QString,QString,QString,QVariantList,QStringList)) );
+    connect( this, SIGNAL(addMetricViewDataBlock(QString,QString,QString,QString,MetricViewDataBlock,QStringList)),
+             &m_metricsCache, SLOT(handleAddMetricViewDataBlock(QString,QString,QString,QString,MetricViewDataBlock,QStringList)) );
 #endif
 
     connect( &m_metricsCache, SIGNAL(signalSelectedMetricChanged(QString,QString)), this, SLOT(update()) );
@@ -237,6 +237,56 @@ void SourceViewMetricsCache::handleAddMetricViewData(const QString &clusteringCr
     if ( ! metricIndexes.contains( s_functionTitle ) )
          return;
 
+    addMetricViewRow( metricViewData, metricIndexes, data );
+}
+
+/**
+ * @brief SourceViewMetricsCache::handleAddMetricViewDataBlock
+ * @param clusteringCriteriaName - the name of the clustering criteria
+ * @param modeName - the mode name
+ * @param metricName - the name of the metric requested in the metric view
+ * @param viewName - the name of the view requested in the metric view
+ * @param block - the block of rows to add to the cache
+ * @param columnHeaders - if present provides the names of the columns for each index in the data
+ *
+ * Extracts the data for all entries in the block of the specified metric view and stores in the corresponding cache map.
+ */
+void SourceViewMetricsCache::handleAddMetricViewDataBlock(const QString &clusteringCriteriaName, const QString &modeName, const QString &metricName, const QString &viewName, const MetricViewDataBlock &block, const QStringList &columnHeaders)
+{
+    Q_UNUSED( clusteringCriteriaName );
+    Q_UNUSED( columnHeaders );
+
+    const QString metricViewName = PerformanceDataMetricView::getMetricViewName( modeName, metricName, viewName );
+
+    QMutexLocker guard( &m_mutex );
+
+    // return if the metric view name is not contained in either watched data structures
+    if ( ! m_watchedMetricViews.contains( metricViewName ) || ! m_watchedMetricNames.contains( metricViewName ) )
+        return;
+
+    QMap< QString, QMap< QString, QVector< double > > >& metricViewData = m_metrics[ metricViewName ];
+
+    // get the list of metric name / index pairs
+    const QMap< QString, int >& metricIndexes = m_watchedMetricViews[ metricViewName ];
+
+    if ( ! metricIndexes.contains( s_functionTitle ) )
+         return;
+
+    for ( int row=0; row<block.rowCount(); ++row ) {
+        addMetricViewRow( metricViewData, metricIndexes, block.row( row ) );
+    }
+}
+
+/**
+ * @brief SourceViewMetricsCache::addMetricViewRow
+ * @param metricViewData - the cache map of the metric view
+ * @param metricIndexes - the map of metric name to column index for the metric view
+ * @param data - the data for one entry of the metric view
+ *
+ * Stores the metric values of one metric view entry in the cache map of the metric view.  The caller must hold the cache mutex.
+ */
+void SourceViewMetricsCache::addMetricViewRow(QMap< QString, QMap< QString, QVector< double > > >& metricViewData, const QMap< QString, int >& metricIndexes, const QVariantList& data)
+{
     const QString definingLocation = data.at( metricIndexes[ s_functionTitle ] ).toString();
 
     int lineNumber;
@@ -33,6 +33,8 @@
 #include <QMutex>
 #include <set>
 
+#include "managers/MetricViewDataBlock.h"
+
 namespace ArgoNavis { namespace GUI {
 
 
@@ -62,9 +64,12 @@ public slots:
     void handleSelectedMetricChanged();
     void handleAddMetricView(const QString &clusteringCriteriaName, const QString& modeName, const QString &metricName, const QString &viewName, const QStringList &metrics);
     void handleAddMetricViewData(const QString &clusteringCriteriaName, const QString& modeName, const QString &metricName, const QString &viewName, const QVariantList &data, const QStringList &columnHeaders);
+    void handleAddMetricViewDataBlock(const QString &clusteringCriteriaName, const QString& modeName, const QString &metricName, const QString &viewName, const MetricViewDataBlock &block, const QStringList &columnHeaders);
 
 private:
 
+    void addMetricViewRow(QMap< QString, QMap< QString, QVector< double > > >& metricViewData, const QMap< QString, int >& metricIndexes, const QVariantList& data);
+
     // maps metric view name to pair of integers representing the indexes of
     // the columns containing the defining location and the metric value.
     QMap< QString, QMap< QString, int > > m_watchedMetricViews;
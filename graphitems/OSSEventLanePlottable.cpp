@@ -0,0 +1,1111 @@
+/*!
+   \file OSSEventLanePlottable.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "OSSEventLanePlottable.h"
+
+#include <QFontMetricsF>
+#include <QMap>
+#include <QPair>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+double OSSEventLanePlottable::s_halfHeight = 0.3;
+
+// events are drawn individually when the visible events have on average at least this many pixels
+const double LOD_PIXEL_THRESHOLD = 2.0;
+// the largest number of buckets of the finest summary level of a row
+const int MAX_SUMMARY_BUCKETS = 1 << 17;
+// the number of opacity steps used to show the busy fraction of a summary bucket
+const int SUMMARY_SHADES = 8;
+// the smallest width in pixels of the summary buckets drawn when the lane is coarse
+const double COARSE_BUCKET_PIXELS = 4.0;
+// the ranks are folded when the rank lanes would be less than this many pixels high
+const double MIN_RANK_PIXELS = 3.0;
+// the number of representative lanes of a folded group of ranks
+const int FOLDED_LANES = 3;
+// the interval index key and lane rank of the events which are not trace events
+const int BAND_KEY = std::numeric_limits<int>::min();
+
+
+/**
+ * @brief OSSEventLanePlottable::OSSEventLanePlottable
+ * @param axisRect - the associated axis rect
+ *
+ * Constructs an OSSEventLanePlottable instance using the bottom and left axes of the specified axis rect as key and value axes.
+ */
+OSSEventLanePlottable::OSSEventLanePlottable(QCPAxisRect *axisRect)
+    : QCPAbstractPlottable( axisRect->axis( QCPAxis::atBottom ), axisRect->axis( QCPAxis::atLeft ) )
+    , m_sorted( true )
+    , m_indexValid( true )
+    , m_foldSize( 0 )
+    , m_rankFolding( true )
+    , m_summaryValid( true )
+    , m_summaryLower( 0.0 )
+    , m_summaryUpper( 0.0 )
+    , m_coarse( false )
+{
+
+}
+
+/**
+ * @brief OSSEventLanePlottable::~OSSEventLanePlottable
+ *
+ * Destroys the OSSEventLanePlottable instance.
+ */
+OSSEventLanePlottable::~OSSEventLanePlottable()
+{
+
+}
+
+/**
+ * @brief OSSEventLanePlottable::addDataTransfer
+ * @param timeBegin - the start time of the data transfer
+ * @param timeEnd - the end time of the data transfer
+ *
+ * Add a data transfer event drawn between the 0.45 and 0.55 ratio positions of the y axis.
+ */
+void OSSEventLanePlottable::addDataTransfer(double timeBegin, double timeEnd)
+{
+    const int style = getStyleIndex( QStringLiteral("Data Transfer"), AxisRectBand, QColor( 0xff, 0xbf, 0xbf ), true, true );
+
+    appendEvent( timeBegin, timeEnd, 0.0, style );
+}
+
+/**
+ * @brief OSSEventLanePlottable::addKernelExecution
+ * @param timeBegin - the start time of the kernel execution
+ * @param timeEnd - the end time of the kernel execution
+ *
+ * Add a kernel execution event drawn between the 0.45 and 0.55 ratio positions of the y axis.
+ */
+void OSSEventLanePlottable::addKernelExecution(double timeBegin, double timeEnd)
+{
+    const int style = getStyleIndex( QStringLiteral("Kernel Execution"), AxisRectBand, QColor( 0xaf, 0xdb, 0xaf ), true, true );
+
+    appendEvent( timeBegin, timeEnd, 0.0, style );
+}
+
+/**
+ * @brief OSSEventLanePlottable::addPeriodicSample
+ * @param timeBegin - the relative begin time from experiment start
+ * @param timeEnd - the relative end time from experiment start
+ * @param count - the counter value (an average) for this period
+ *
+ * Add a periodic sample drawn from the zero counter value to the counter value location on the y axis.
+ */
+void OSSEventLanePlottable::addPeriodicSample(double timeBegin, double timeEnd, double count)
+{
+    const int style = getStyleIndex( QStringLiteral("Sample Counts"), CountBar, QColor( 140, 140, 140, 80 ), false, false );
+
+    appendEvent( timeBegin, timeEnd, count, style );
+}
+
+/**
+ * @brief OSSEventLanePlottable::addTraceEvents
+ * @param functionName - the name of the function
+ * @param store - the trace events of the function
+ *
+ * Add the trace events of a function, each drawn from the rank - half of rect height to the rank + half of rect height
+ * location on the y axis.  The name of the function is drawn inside the rectangle.  The begin time, end time and rank
+ * of the events are copied, as the lane keeps the events of all functions, kernels, transfers and samples in one set of
+ * arrays sorted by begin time for its interval index and summary.
+ */
+void OSSEventLanePlottable::addTraceEvents(const QString &functionName, const TraceEventStore &store)
+{
+    const int style = getStyleIndex( functionName, RankBar, getTraceColor( functionName ), true, true, functionName );
+
+    for ( int i=0; i<store.size(); ++i ) {
+        appendEvent( store.begin( i ), store.end( i ), store.rank( i ), style );
+    }
+}
+
+/**
+ * @brief OSSEventLanePlottable::eventCount
+ * @return - the number of events in the lane
+ */
+int OSSEventLanePlottable::eventCount() const
+{
+    return m_begin.size();
+}
+
+/**
+ * @brief OSSEventLanePlottable::setCoarse
+ * @param coarse - whether only a coarse approximation of the events is drawn
+ *
+ * A coarse lane switches to the summary density bars at a lower event density, draws the summary with wider buckets and
+ * does not draw the function name labels.  The caller is responsible for the replot.
+ */
+void OSSEventLanePlottable::setCoarse(bool coarse)
+{
+    m_coarse = coarse;
+}
+
+/**
+ * @brief OSSEventLanePlottable::isCoarse
+ * @return - whether only a coarse approximation of the events is drawn
+ */
+bool OSSEventLanePlottable::isCoarse() const
+{
+    return m_coarse;
+}
+
+/**
+ * @brief OSSEventLanePlottable::setRankFolding
+ * @param enabled - whether groups of ranks too close to be told apart are folded into representative lanes
+ *
+ * The caller is responsible for the replot.
+ */
+void OSSEventLanePlottable::setRankFolding(bool enabled)
+{
+    m_rankFolding = enabled;
+}
+
+/**
+ * @brief OSSEventLanePlottable::hasRankFolding
+ * @return - whether groups of ranks too close to be told apart are folded into representative lanes
+ */
+bool OSSEventLanePlottable::hasRankFolding() const
+{
+    return m_rankFolding;
+}
+
+/**
+ * @brief OSSEventLanePlottable::eventAt
+ * @param pos - the pixel position
+ * @return - the index of the topmost event drawn at the pixel position or -1 if none
+ *
+ * The trace events of the rank lane containing the position are drawn on top of the other events.
+ */
+int OSSEventLanePlottable::eventAt(const QPointF &pos) const
+{
+    QCPAxis* keyAxis = mKeyAxis.data();
+
+    if ( ! keyAxis || ! mValueAxis )
+        return -1;
+
+    updateIndex();
+
+    // accept events within one pixel so that events narrower than a pixel can still be hit
+    const double key1 = keyAxis->pixelToCoord( pos.x() - 1.0 );
+    const double key2 = keyAxis->pixelToCoord( pos.x() + 1.0 );
+    const double lower = qMin( key1, key2 );
+    const double upper = qMax( key1, key2 );
+
+    foreach ( const RankLane& lane, getRankLanes() ) {
+        double y1, y2;
+        getExtent( lane, RankBar, lane.center, y1, y2 );
+        if ( pos.y() >= qMin( y1, y2 ) && pos.y() <= qMax( y1, y2 ) ) {
+            const QVector< int > events = m_index.findOverlapping( lane.rank, lower, upper );
+            if ( ! events.isEmpty() )
+                return events.last();
+        }
+    }
+
+    const RankLane band = { BAND_KEY, 0.0, 0.0 };
+    const QVector< int > events = m_index.findOverlapping( BAND_KEY, lower, upper );
+
+    // the later event is drawn on top of the earlier one
+    for ( int k=events.size()-1; k>=0; --k ) {
+        const int i = events[k];
+        const QRectF rect = getEventRect( i, band );
+        if ( pos.y() >= rect.top() && pos.y() <= rect.bottom() )
+            return i;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief OSSEventLanePlottable::findEvents
+ * @param lower - the lower bound of the time window
+ * @param upper - the upper bound of the time window
+ * @return - the indexes of the events overlapping the time window in begin time order
+ */
+QVector<int> OSSEventLanePlottable::findEvents(double lower, double upper) const
+{
+    updateIndex();
+
+    return m_index.findOverlapping( lower, upper );
+}
+
+/**
+ * @brief OSSEventLanePlottable::findEvents
+ * @param rank - the rank of the trace events
+ * @param lower - the lower bound of the time window
+ * @param upper - the upper bound of the time window
+ * @return - the indexes of the trace events on the rank overlapping the time window in begin time order
+ */
+QVector<int> OSSEventLanePlottable::findEvents(int rank, double lower, double upper) const
+{
+    updateIndex();
+
+    return m_index.findOverlapping( rank, lower, upper );
+}
+
+/**
+ * @brief OSSEventLanePlottable::timeBegin
+ * @param index - the event index
+ * @return - the start time of the event
+ */
+double OSSEventLanePlottable::timeBegin(int index) const
+{
+    updateIndex();
+
+    return m_begin.at( index );
+}
+
+/**
+ * @brief OSSEventLanePlottable::timeEnd
+ * @param index - the event index
+ * @return - the end time of the event
+ */
+double OSSEventLanePlottable::timeEnd(int index) const
+{
+    updateIndex();
+
+    return m_end.at( index );
+}
+
+/**
+ * @brief OSSEventLanePlottable::value
+ * @param index - the event index
+ * @return - the rank of a trace event or the counter value of a periodic sample
+ */
+double OSSEventLanePlottable::value(int index) const
+{
+    updateIndex();
+
+    return m_value.at( index );
+}
+
+/**
+ * @brief OSSEventLanePlottable::styleName
+ * @param index - the event index
+ * @return - the function name of a trace event or the kind of the event
+ */
+QString OSSEventLanePlottable::styleName(int index) const
+{
+    updateIndex();
+
+    return m_styles.at( m_style.at( index ) ).name;
+}
+
+/**
+ * @brief OSSEventLanePlottable::getTraceColor
+ * @param functionName - the name of the function
+ * @return - the color used for trace events of the function
+ */
+QColor OSSEventLanePlottable::getTraceColor(const QString &functionName)
+{
+    if ( functionName.contains( QStringLiteral("MPI_Init") ) )
+        return QColor( 0x95, 0xd0, 0xaa );
+    else if ( functionName.contains( QStringLiteral("MPI_Finalize") ) )
+        return QColor( 0xa3, 0x21, 0x3e );
+    else if ( functionName.contains( QStringLiteral("MPI_Barrier") ) )
+        return QColor( 0xca, 0x2b, 0x2b );
+    else if ( functionName.contains( QStringLiteral("MPI_Send") ) )
+        return QColor( 0xcc, 0x7d, 0xaf );
+    else if ( functionName.contains( QStringLiteral("MPI_Recv") ) )
+        return QColor( 0xcc, 0x7d, 0xaf );
+    else
+        return QColor( 0x43, 0x8e, 0xc8 );
+}
+
+#if !defined(HAS_QCUSTOMPLOT_V2)
+/**
+ * @brief OSSEventLanePlottable::clearData
+ *
+ * Implements the QCPAbstractPlottable::clearData method.  Removes all events from the lane.
+ */
+void OSSEventLanePlottable::clearData()
+{
+    m_begin.clear();
+    m_end.clear();
+    m_value.clear();
+    m_style.clear();
+    m_sorted = true;
+    m_index.clear();
+    m_indexValid = true;
+    m_ranks.clear();
+    m_rankBusy.clear();
+    m_foldGroups.clear();
+    m_foldSize = 0;
+    m_summaryRows.clear();
+    m_laneRows.clear();
+    m_summaryValid = true;
+}
+#endif
+
+/**
+ * @brief OSSEventLanePlottable::selectTest
+ * @param pos - the pixel position
+ * @param onlySelectable - whether to return -1 when the plottable is not selectable
+ * @param details - if not null, set to the index of the event at the position
+ * @return - zero if an event is drawn at the position or -1 otherwise
+ *
+ * Implements the QCPAbstractPlottable::selectTest method.
+ */
+double OSSEventLanePlottable::selectTest(const QPointF &pos, bool onlySelectable, QVariant *details) const
+{
+#if defined(HAS_QCUSTOMPLOT_V2)
+    if ( onlySelectable && mSelectable == QCP::stNone )
+        return -1;
+#else
+    if ( onlySelectable && ! mSelectable )
+        return -1;
+#endif
+
+    if ( ! mKeyAxis || ! mValueAxis || ! mKeyAxis.data()->axisRect()->rect().contains( pos.toPoint() ) )
+        return -1;
+
+    const int index = eventAt( pos );
+
+    if ( -1 == index )
+        return -1;
+
+    if ( details ) {
+#if defined(HAS_QCUSTOMPLOT_V2)
+        details->setValue( QCPDataSelection( QCPDataRange( index, index+1 ) ) );
+#else
+        details->setValue( index );
+#endif
+    }
+
+    return 0.0;
+}
+
+/**
+ * @brief OSSEventLanePlottable::draw
+ * @param painter - the painter used for drawing
+ *
+ * Implements the QCPAbstractPlottable::draw method.  The events which are not trace events and the trace events of each
+ * visible rank lane are drawn separately.  When the visible events of a lane have on average fewer pixels than the
+ * level-of-detail threshold the summary density bars are drawn in place of its individual events.  A coarse lane uses
+ * a threshold of COARSE_BUCKET_PIXELS per event instead.
+ */
+void OSSEventLanePlottable::draw(QCPPainter *painter)
+{
+    QCPAxis* keyAxis = mKeyAxis.data();
+
+    if ( ! keyAxis || ! mValueAxis || m_begin.isEmpty() )
+        return;
+
+    updateIndex();
+
+    const QCPRange range = keyAxis->range();
+    const double threshold = m_coarse ? COARSE_BUCKET_PIXELS : LOD_PIXEL_THRESHOLD;
+
+    const RankLane band = { BAND_KEY, 0.0, 0.0 };
+
+    QVector< RankLane > lanes;
+    lanes << band << getRankLanes();
+
+    applyDefaultAntialiasingHint( painter );
+
+    QVector< RankLane > summaryLanes;
+
+    foreach ( const RankLane& lane, lanes ) {
+        // number of events of the lane beginning within the visible range
+        const int visibleCount = m_index.countBeginning( lane.rank, range.lower, range.upper );
+
+        if ( visibleCount * threshold > keyAxis->axisRect()->width() )
+            summaryLanes << lane;
+        else
+            drawEvents( painter, lane, m_index.findOverlapping( lane.rank, range.lower, range.upper ), ! m_coarse );
+    }
+
+    if ( ! summaryLanes.isEmpty() ) {
+        buildSummary();
+        drawSummary( painter, summaryLanes, range.lower, range.upper, m_coarse ? COARSE_BUCKET_PIXELS : 1.0 );
+    }
+}
+
+/**
+ * @brief OSSEventLanePlottable::drawEvents
+ * @param painter - the painter used for drawing
+ * @param lane - the lane of the events
+ * @param events - the indexes of the visible events of the lane in begin time order
+ * @param drawLabels - whether the function names of trace events are drawn
+ *
+ * Draw the individual events.  The pen and brush are only changed when the style changes from the previous event.
+ * Consecutive events of the same style narrower than a pixel which touch in pixel space are merged into one rectangle.
+ * The function name of a trace event is drawn when it fits inside the rectangle.
+ */
+void OSSEventLanePlottable::drawEvents(QCPPainter *painter, const RankLane &lane, const QVector<int> &events, bool drawLabels) const
+{
+    if ( events.isEmpty() )
+        return;
+
+    QFont labelFont = painter->font();
+    labelFont.setPointSize( 10 );
+    labelFont.setBold( true );
+    const QFontMetricsF metrics( labelFont );
+
+    // label widths are measured once per style and draw
+    QVector< double > labelWidths( m_styles.size(), -1.0 );
+
+    int currentStyle( -1 );
+    int pendingStyle( -1 );
+    QRectF pendingRect;
+
+    for ( int k=0; k<=events.size(); ++k ) {
+        QRectF rect;
+        int style( -1 );
+
+        if ( k < events.size() ) {
+            const int i = events[k];
+
+            rect = getEventRect( i, lane );
+            style = m_style[i];
+
+            // merge sub-pixel event into pending rectangle
+            if ( style == pendingStyle && rect.width() < 1.0 && rect.left() <= pendingRect.right() + 1.0 &&
+                 rect.top() == pendingRect.top() && rect.bottom() == pendingRect.bottom() ) {
+                pendingRect.setRight( qMax( pendingRect.right(), rect.right() ) );
+                continue;
+            }
+        }
+
+        // draw the pending rectangle
+        if ( -1 != pendingStyle ) {
+            const EventStyle& eventStyle = m_styles[ pendingStyle ];
+
+            if ( currentStyle != pendingStyle ) {
+                painter->setPen( eventStyle.pen );
+                painter->setBrush( eventStyle.brush );
+                currentStyle = pendingStyle;
+            }
+
+            if ( eventStyle.rounded )
+                painter->drawRoundedRect( pendingRect, 5.0, 5.0 );
+            else
+                painter->drawRect( pendingRect );
+
+            if ( drawLabels && ! eventStyle.label.isEmpty() ) {
+                if ( labelWidths[ pendingStyle ] < 0.0 )
+                    labelWidths[ pendingStyle ] = metrics.width( eventStyle.label );
+                if ( labelWidths[ pendingStyle ] <= pendingRect.width() ) {
+                    painter->setFont( labelFont );
+                    painter->setPen( Qt::white );
+                    painter->drawText( pendingRect, Qt::AlignCenter, eventStyle.label );
+                    currentStyle = -1;
+                }
+            }
+        }
+
+        pendingRect = rect;
+        pendingStyle = style;
+    }
+}
+
+/**
+ * @brief OSSEventLanePlottable::drawSummary
+ * @param painter - the painter used for drawing
+ * @param lanes - the lanes whose summary rows are drawn
+ * @param lower - the lower bound of the visible key range
+ * @param upper - the upper bound of the visible key range
+ * @param minBucketPixels - the smallest width in pixels of the buckets drawn
+ *
+ * Draw a density bar for each non-empty visible bucket of each summary row of the lanes.  The level used is the finest level whose
+ * buckets are at least the minimum width, so the cost is bounded by the number of pixel columns.  A bar has the color of the
+ * dominant style of the bucket and an opacity in proportion to its busy fraction.  The bars of the same color and opacity
+ * are collected and drawn with one call.
+ */
+void OSSEventLanePlottable::drawSummary(QCPPainter *painter, const QVector<RankLane> &lanes, double lower, double upper, double minBucketPixels) const
+{
+    QCPAxis* keyAxis = mKeyAxis.data();
+
+    const double span = m_summaryUpper - m_summaryLower;
+    const double pixelsPerKey = keyAxis->axisRect()->width() / keyAxis->range().size();
+
+    // key: style index * SUMMARY_SHADES + shade  value: the bars drawn with that color and opacity
+    QHash< int, QVector< QRectF > > bars;
+
+    foreach ( const RankLane& lane, lanes ) {
+        foreach ( int rowIndex, m_laneRows.value( lane.rank ) ) {
+            const SummaryRow& row = m_summaryRows[ rowIndex ];
+
+            // find finest level having buckets at least the minimum width
+            int level( 0 );
+            while ( level < row.levels.size() - 1 && span / row.levels[ level ].busy.size() * pixelsPerKey < minBucketPixels ) {
+                ++level;
+            }
+
+            const SummaryLevel& summary = row.levels[ level ];
+            const int bucketCount = summary.busy.size();
+            const double width = span / bucketCount;
+
+            const int firstBucket = (int) qBound( 0.0, std::floor( ( lower - m_summaryLower ) / width ), bucketCount - 1.0 );
+            const int lastBucket = (int) qBound( 0.0, std::floor( ( upper - m_summaryLower ) / width ), bucketCount - 1.0 );
+
+            for ( int b=firstBucket; b<=lastBucket; ++b ) {
+                if ( 0 == summary.count[b] )
+                    continue;
+
+                double y1, y2;
+                getExtent( lane, row.shape, summary.maxValue[b], y1, y2 );
+
+                const double x1 = keyAxis->coordToPixel( m_summaryLower + b * width );
+                const double x2 = keyAxis->coordToPixel( m_summaryLower + ( b + 1 ) * width );
+                const QRectF rect = QRectF( QPointF( x1, y1 ), QPointF( x2, y2 ) ).normalized();
+
+                const int shade = qBound( 1, (int) std::ceil( summary.busy[b] * SUMMARY_SHADES ), SUMMARY_SHADES ) - 1;
+
+                // extend the previous bar of the same color and opacity when adjacent
+                QVector< QRectF >& rects = bars[ summary.dominant[b] * SUMMARY_SHADES + shade ];
+                if ( ! rects.isEmpty() && rects.last().top() == rect.top() && rects.last().bottom() == rect.bottom() &&
+                     rect.left() <= rects.last().right() + 0.5 ) {
+                    rects.last().setRight( qMax( rects.last().right(), rect.right() ) );
+                }
+                else {
+                    rects << rect;
+                }
+            }
+        }
+    }
+
+    painter->setPen( Qt::NoPen );
+
+    for ( QHash< int, QVector< QRectF > >::const_iterator iter = bars.constBegin(); iter != bars.constEnd(); ++iter ) {
+        const int style = iter.key() / SUMMARY_SHADES;
+        const int shade = iter.key() % SUMMARY_SHADES + 1;
+
+        QColor color = m_styles[ style ].brush.color();
+        color.setAlpha( color.alpha() * shade / SUMMARY_SHADES );
+
+        painter->setBrush( color );
+        painter->drawRects( iter.value().constData(), iter.value().size() );
+    }
+}
+
+/**
+ * @brief OSSEventLanePlottable::drawLegendIcon
+ * @param painter - the painter used for drawing
+ * @param rect - the rect of the legend icon
+ *
+ * Implements the QCPAbstractPlottable::drawLegendIcon method.  The lane is not shown in a legend.
+ */
+void OSSEventLanePlottable::drawLegendIcon(QCPPainter *painter, const QRectF &rect) const
+{
+    Q_UNUSED( painter )
+    Q_UNUSED( rect )
+}
+
+/**
+ * @brief OSSEventLanePlottable::getKeyRange
+ * @param foundRange - set to whether the lane has any events
+ * @param inSignDomain - restrict the range to positive or negative keys
+ * @return - the range of the event times
+ *
+ * Implements the QCPAbstractPlottable::getKeyRange method.
+ */
+#if defined(HAS_QCUSTOMPLOT_V2)
+QCPRange OSSEventLanePlottable::getKeyRange(bool &foundRange, QCP::SignDomain inSignDomain) const
+#else
+QCPRange OSSEventLanePlottable::getKeyRange(bool &foundRange, SignDomain inSignDomain) const
+#endif
+{
+    Q_UNUSED( inSignDomain )
+
+    foundRange = ! m_begin.isEmpty();
+
+    if ( ! foundRange )
+        return QCPRange();
+
+    updateIndex();
+
+    double upper = m_end.first();
+    foreach ( double timeEnd, m_end ) {
+        upper = qMax( upper, timeEnd );
+    }
+
+    return QCPRange( m_begin.first(), upper );
+}
+
+/**
+ * @brief OSSEventLanePlottable::getValueRange
+ * @param foundRange - set to whether the lane has any events
+ * @param inSignDomain - restrict the range to positive or negative values
+ * @return - the range of the ranks and counter values
+ *
+ * Implements the QCPAbstractPlottable::getValueRange method.
+ */
+#if defined(HAS_QCUSTOMPLOT_V2)
+QCPRange OSSEventLanePlottable::getValueRange(bool &foundRange, QCP::SignDomain inSignDomain, const QCPRange &inKeyRange) const
+#else
+QCPRange OSSEventLanePlottable::getValueRange(bool &foundRange, SignDomain inSignDomain) const
+#endif
+{
+    Q_UNUSED( inSignDomain )
+#if defined(HAS_QCUSTOMPLOT_V2)
+    Q_UNUSED( inKeyRange )
+#endif
+
+    foundRange = ! m_value.isEmpty();
+
+    if ( ! foundRange )
+        return QCPRange();
+
+    QCPRange range( 0.0, 0.0 );
+    foreach ( double value, m_value ) {
+        range.expand( value );
+    }
+
+    return range;
+}
+
+/**
+ * @brief OSSEventLanePlottable::getStyleIndex
+ * @param name - the unique name of the style
+ * @param shape - how the vertical extent of the event is determined
+ * @param color - the fill color
+ * @param rounded - whether the rectangle has rounded corners
+ * @param hasPen - whether the outline is drawn with a cosmetic pen of the fill color
+ * @param label - the text drawn inside the rectangle (if any)
+ * @return - the index of the interned style
+ */
+int OSSEventLanePlottable::getStyleIndex(const QString &name, Shape shape, const QColor &color, bool rounded, bool hasPen, const QString &label)
+{
+    QHash< QString, int >::const_iterator iter = m_styleIndexes.constFind( name );
+
+    if ( iter != m_styleIndexes.constEnd() )
+        return iter.value();
+
+    EventStyle style;
+    style.name = name;
+    style.shape = shape;
+    style.brush = QBrush( color );
+    style.pen = hasPen ? QPen( color, 0.0 ) : QPen( Qt::NoPen );  // cosmetic pen
+    style.rounded = rounded;
+    style.label = label;
+
+    const int index = m_styles.size();
+
+    m_styles << style;
+    m_styleIndexes.insert( name, index );
+
+    return index;
+}
+
+/**
+ * @brief OSSEventLanePlottable::appendEvent
+ * @param timeBegin - the start time of the event
+ * @param timeEnd - the end time of the event
+ * @param value - the rank or counter value of the event
+ * @param style - the style index of the event
+ */
+void OSSEventLanePlottable::appendEvent(double timeBegin, double timeEnd, double value, int style)
+{
+    if ( ! m_begin.isEmpty() && timeBegin < m_begin.last() )
+        m_sorted = false;
+
+    m_begin << timeBegin;
+    m_end << timeEnd;
+    m_value << value;
+    m_style << style;
+
+    m_indexValid = false;
+    m_summaryValid = false;
+}
+
+/**
+ * @brief OSSEventLanePlottable::updateIndex
+ *
+ * Sort the event rows by begin time if events were appended out of order and rebuild the interval index if events were
+ * appended since it was last built.  The relative order of events having the same begin time is kept so that the later
+ * event is still drawn on top.  The rank of a trace event is the key of the event in the interval index and the other
+ * events share the BAND_KEY key.  The distinct ranks and the total time of the trace events of each rank are found as well.
+ */
+void OSSEventLanePlottable::updateIndex() const
+{
+    if ( m_indexValid )
+        return;
+
+    if ( ! m_sorted )
+        sortEvents();
+
+    const int count = m_begin.size();
+
+    QVector< int > ranks( count );
+    QMap< int, double > rankBusy;
+
+    for ( int i=0; i<count; ++i ) {
+        if ( RankBar == m_styles[ m_style[i] ].shape ) {
+            ranks[i] = (int) m_value[i];
+            rankBusy[ ranks[i] ] += m_end[i] - m_begin[i];
+        }
+        else {
+            ranks[i] = BAND_KEY;
+        }
+    }
+
+    m_index.build( m_begin, m_end, ranks );
+
+    m_ranks = rankBusy.keys().toVector();
+    m_rankBusy = rankBusy.values().toVector();
+    m_foldGroups.clear();
+    m_foldSize = 0;
+
+    m_indexValid = true;
+}
+
+/**
+ * @brief OSSEventLanePlottable::sortEvents
+ *
+ * Sort the event rows by begin time.
+ */
+void OSSEventLanePlottable::sortEvents() const
+{
+    const int count = m_begin.size();
+
+    QVector< int > permutation( count );
+    for ( int i=0; i<count; ++i ) {
+        permutation[i] = i;
+    }
+
+    const QVector< double >& begin = m_begin;
+    std::stable_sort( permutation.begin(), permutation.end(), [&begin](int a, int b) { return begin[a] < begin[b]; } );
+
+    QVector< double > sortedBegin( count );
+    QVector< double > sortedEnd( count );
+    QVector< double > sortedValue( count );
+    QVector< int > sortedStyle( count );
+
+    for ( int i=0; i<count; ++i ) {
+        const int index = permutation[i];
+        sortedBegin[i] = m_begin[index];
+        sortedEnd[i] = m_end[index];
+        sortedValue[i] = m_value[index];
+        sortedStyle[i] = m_style[index];
+    }
+
+    m_begin.swap( sortedBegin );
+    m_end.swap( sortedEnd );
+    m_value.swap( sortedValue );
+    m_style.swap( sortedStyle );
+
+    m_sorted = true;
+}
+
+/**
+ * @brief OSSEventLanePlottable::getRankLanes
+ * @return - the lanes of the ranks within the visible value range in ascending value order
+ *
+ * Without rank folding or when the lanes are at least MIN_RANK_PIXELS high each visible rank has its own lane centered on
+ * the rank.  Otherwise the ranks are folded in aligned groups of a power of two ranks, the smallest size giving each of the
+ * FOLDED_LANES representative lanes of a group enough height.  The representative lanes split the value range of the group.
+ */
+QVector<OSSEventLanePlottable::RankLane> OSSEventLanePlottable::getRankLanes() const
+{
+    QVector< RankLane > lanes;
+
+    if ( m_ranks.isEmpty() )
+        return lanes;
+
+    QCPAxis* valueAxis = mValueAxis.data();
+
+    const QCPRange range = valueAxis->range();
+
+    // the ranks whose lanes overlap the visible value range
+    const int first = std::lower_bound( m_ranks.constBegin(), m_ranks.constEnd(), (int) std::ceil( range.lower - s_halfHeight ) ) - m_ranks.constBegin();
+    const int last = std::upper_bound( m_ranks.constBegin(), m_ranks.constEnd(), (int) std::floor( range.upper + s_halfHeight ) ) - m_ranks.constBegin();
+
+    if ( first >= last )
+        return lanes;
+
+    const double pixelsPerRank = qAbs( valueAxis->coordToPixel( 1.0 ) - valueAxis->coordToPixel( 0.0 ) );
+
+    if ( ! m_rankFolding || pixelsPerRank >= MIN_RANK_PIXELS ) {
+        lanes.reserve( last - first );
+        for ( int k=first; k<last; ++k ) {
+            const RankLane lane = { m_ranks[k], (double) m_ranks[k], s_halfHeight };
+            lanes << lane;
+        }
+        return lanes;
+    }
+
+    int foldSize( 2 );
+    while ( foldSize * pixelsPerRank < FOLDED_LANES * MIN_RANK_PIXELS ) {
+        foldSize <<= 1;
+    }
+
+    updateFoldGroups( foldSize );
+
+    const int lastGroup = (int) std::floor( (double) m_ranks[ last - 1 ] / foldSize );
+
+    QMap< int, QVector< int > >::const_iterator iter = m_foldGroups.lowerBound( (int) std::floor( (double) m_ranks[ first ] / foldSize ) );
+
+    for ( ; iter != m_foldGroups.constEnd() && iter.key() <= lastGroup; ++iter ) {
+        const QVector< int >& representatives = iter.value();
+        const double height = (double) foldSize / representatives.size();
+        const double lower = iter.key() * foldSize - 0.5;
+
+        for ( int k=0; k<representatives.size(); ++k ) {
+            const RankLane lane = { representatives[k], lower + ( k + 0.5 ) * height, s_halfHeight * height };
+            lanes << lane;
+        }
+    }
+
+    return lanes;
+}
+
+/**
+ * @brief OSSEventLanePlottable::updateFoldGroups
+ * @param foldSize - the number of ranks in each group
+ *
+ * Group the ranks by rank divided by the fold size and find the ranks of each group with the minimum, median and maximum
+ * total time in traced functions.  The groups are kept until the fold size changes or the index is rebuilt.
+ */
+void OSSEventLanePlottable::updateFoldGroups(int foldSize) const
+{
+    if ( foldSize == m_foldSize )
+        return;
+
+    m_foldGroups.clear();
+    m_foldSize = foldSize;
+
+    const QVector< double >& busy = m_rankBusy;
+
+    int k( 0 );
+    while ( k < m_ranks.size() ) {
+        const int group = (int) std::floor( (double) m_ranks[k] / foldSize );
+
+        // indexes of the ranks of the group
+        QVector< int > members;
+        while ( k < m_ranks.size() && (int) std::floor( (double) m_ranks[k] / foldSize ) == group ) {
+            members << k++;
+        }
+
+        std::stable_sort( members.begin(), members.end(), [&busy](int a, int b) { return busy[a] < busy[b]; } );
+
+        QVector< int > representatives;
+        representatives << m_ranks[ members.first() ];
+        if ( members.size() > 2 )
+            representatives << m_ranks[ members[ members.size() / 2 ] ];
+        if ( members.size() > 1 )
+            representatives << m_ranks[ members.last() ];
+
+        m_foldGroups.insert( group, representatives );
+    }
+}
+
+/**
+ * @brief OSSEventLanePlottable::getEventRect
+ * @param index - the event index
+ * @param lane - the lane of the event
+ * @return - the rectangle of the event in pixel coordinates
+ */
+QRectF OSSEventLanePlottable::getEventRect(int index, const RankLane &lane) const
+{
+    QCPAxis* keyAxis = mKeyAxis.data();
+
+    const double x1 = keyAxis->coordToPixel( m_begin[ index ] );
+    const double x2 = keyAxis->coordToPixel( m_end[ index ] );
+
+    double y1, y2;
+    getExtent( lane, m_styles[ m_style[ index ] ].shape, m_value[ index ], y1, y2 );
+
+    return QRectF( QPointF( x1, y1 ), QPointF( x2, y2 ) ).normalized();
+}
+
+/**
+ * @brief OSSEventLanePlottable::getExtent
+ * @param lane - the lane of the event
+ * @param shape - the shape of the event
+ * @param value - the counter value of the event
+ * @param y1 - set to the first vertical pixel coordinate of the event
+ * @param y2 - set to the second vertical pixel coordinate of the event
+ *
+ * The vertical extent of a trace event is given by its lane, which is centered on the rank unless the rank is folded.
+ */
+void OSSEventLanePlottable::getExtent(const RankLane &lane, Shape shape, double value, double &y1, double &y2) const
+{
+    switch ( shape ) {
+    case AxisRectBand:
+    {
+        const QRect axisRect = mKeyAxis.data()->axisRect()->rect();
+        y1 = axisRect.top() + 0.45 * axisRect.height();
+        y2 = axisRect.top() + 0.55 * axisRect.height();
+        break;
+    }
+    case RankBar:
+        y1 = mValueAxis.data()->coordToPixel( lane.center + lane.halfHeight );
+        y2 = mValueAxis.data()->coordToPixel( lane.center - lane.halfHeight );
+        break;
+    case CountBar:
+    default:
+        y1 = mValueAxis.data()->coordToPixel( value );
+        y2 = mValueAxis.data()->coordToPixel( 0.0 );
+        break;
+    }
+}
+
+/**
+ * @brief OSSEventLanePlottable::buildSummary
+ *
+ * Build the multi-resolution summary of the events if events were added since it was last built.  The events are
+ * partitioned into rows: one row for the CUDA events, one for the periodic samples and one for each rank of the trace
+ * events.  The finest level of a row has a power of two number of buckets spanning the key range of the lane, about one
+ * bucket for every four events of the row.  For each bucket the number of overlapping events, the fraction of the bucket
+ * covered by events (the busy fraction), the style of the longest event portion within the bucket (the dominant style)
+ * and the largest counter value are kept.  Each next level halves the number of buckets down to a single bucket.
+ */
+void OSSEventLanePlottable::buildSummary() const
+{
+    if ( m_summaryValid )
+        return;
+
+    m_summaryRows.clear();
+    m_laneRows.clear();
+    m_summaryValid = true;
+
+    const int count = m_begin.size();
+
+    if ( 0 == count )
+        return;
+
+    m_summaryLower = m_begin.first();
+    m_summaryUpper = m_summaryLower;
+    foreach ( double timeEnd, m_end ) {
+        m_summaryUpper = qMax( m_summaryUpper, timeEnd );
+    }
+
+    // avoid zero bucket width when all events are instantaneous at the same time
+    if ( m_summaryUpper <= m_summaryLower )
+        m_summaryUpper = m_summaryLower + 1.0;
+
+    const double span = m_summaryUpper - m_summaryLower;
+
+    // assign each event to its row
+    QMap< QPair< int, int >, int > rowIndexes;
+    QVector< int > rows( count );
+    QVector< int > rowCounts;
+
+    for ( int i=0; i<count; ++i ) {
+        const Shape shape = m_styles[ m_style[i] ].shape;
+        const QPair< int, int > key( shape, RankBar == shape ? (int) m_value[i] : 0 );
+
+        QMap< QPair< int, int >, int >::const_iterator iter = rowIndexes.constFind( key );
+        if ( iter == rowIndexes.constEnd() ) {
+            iter = rowIndexes.insert( key, m_summaryRows.size() );
+            SummaryRow row;
+            row.shape = shape;
+            row.value = key.second;
+            m_laneRows[ RankBar == shape ? key.second : BAND_KEY ] << m_summaryRows.size();
+            m_summaryRows << row;
+            rowCounts << 0;
+        }
+
+        rows[i] = iter.value();
+        rowCounts[ iter.value() ]++;
+    }
+
+    // allocate finest level of each row
+    for ( int r=0; r<m_summaryRows.size(); ++r ) {
+        int bucketCount( 1 );
+        while ( bucketCount * 4 < rowCounts[r] && bucketCount < MAX_SUMMARY_BUCKETS ) {
+            bucketCount <<= 1;
+        }
+
+        SummaryLevel level;
+        level.busy.fill( 0.0f, bucketCount );
+        level.count.fill( 0, bucketCount );
+        level.dominant.fill( -1, bucketCount );
+        level.dominantTime.fill( 0.0f, bucketCount );
+        level.maxValue.fill( 0.0f, bucketCount );
+
+        m_summaryRows[r].levels << level;
+    }
+
+    // accumulate events into the buckets of the finest level they overlap
+    for ( int i=0; i<count; ++i ) {
+        SummaryLevel& level = m_summaryRows[ rows[i] ].levels.first();
+        const int bucketCount = level.busy.size();
+        const double width = span / bucketCount;
+
+        const int firstBucket = qBound( 0, (int) ( ( m_begin[i] - m_summaryLower ) / width ), bucketCount - 1 );
+        const int lastBucket = qBound( 0, (int) ( ( m_end[i] - m_summaryLower ) / width ), bucketCount - 1 );
+
+        for ( int b=firstBucket; b<=lastBucket; ++b ) {
+            const double bucketLower = m_summaryLower + b * width;
+            const double overlap = qMax( 0.0, qMin( m_end[i], bucketLower + width ) - qMax( m_begin[i], bucketLower ) );
+
+            level.busy[b] += overlap / width;
+            level.count[b]++;
+            if ( -1 == level.dominant[b] || overlap > level.dominantTime[b] ) {
+                level.dominant[b] = m_style[i];
+                level.dominantTime[b] = overlap;
+            }
+            level.maxValue[b] = qMax( level.maxValue[b], (float) m_value[i] );
+        }
+    }
+
+    // overlapping events may cover a bucket more than once
+    for ( int r=0; r<m_summaryRows.size(); ++r ) {
+        QVector< float >& busy = m_summaryRows[r].levels.first().busy;
+        for ( int b=0; b<busy.size(); ++b ) {
+            busy[b] = qMin( busy[b], 1.0f );
+        }
+    }
+
+    // build each coarser level from pairs of buckets of the previous level
+    for ( int r=0; r<m_summaryRows.size(); ++r ) {
+        QVector< SummaryLevel >& levels = m_summaryRows[r].levels;
+
+        while ( levels.last().busy.size() > 1 ) {
+            const SummaryLevel& finer = levels.last();
+            const int bucketCount = finer.busy.size() / 2;
+
+            SummaryLevel level;
+            level.busy.resize( bucketCount );
+            level.count.resize( bucketCount );
+            level.dominant.resize( bucketCount );
+            level.dominantTime.resize( bucketCount );
+            level.maxValue.resize( bucketCount );
+
+            for ( int b=0; b<bucketCount; ++b ) {
+                const int left = 2 * b;
+                const int right = left + 1;
+                level.busy[b] = ( finer.busy[left] + finer.busy[right] ) / 2.0f;
+                // an event overlapping both buckets is counted twice
+                level.count[b] = finer.count[left] + finer.count[right];
+                const int dominant = ( finer.dominantTime[right] > finer.dominantTime[left] || -1 == finer.dominant[left] ) ? right : left;
+                level.dominant[b] = finer.dominant[dominant];
+                level.dominantTime[b] = finer.dominantTime[dominant];
+                level.maxValue[b] = qMax( finer.maxValue[left], finer.maxValue[right] );
+            }
+
+            levels << level;
+        }
+    }
+}
+
+
+} // GUI
+} // ArgoNavis
@@ -0,0 +1,194 @@
+/*!
+   \file OSSEventLanePlottable.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OSSEVENTLANEPLOTTABLE_H
+#define OSSEVENTLANEPLOTTABLE_H
+
+#include "qcustomplot.h"
+
+#include "common/openss-gui-config.h"
+
+#include "managers/EventIntervalIndex.h"
+#include "managers/TraceEventStore.h"
+
+#include <QVector>
+#include <QHash>
+#include <QMap>
+#include <QString>
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/*!
+ * \brief The OSSEventLanePlottable class
+ *
+ * One plottable holding all CUDA events, trace events and periodic samples shown in an axis rect of the timeline.
+ * Each event is stored as a row of contiguous begin, end, value and style arrays instead of a QCPItemRect instance.
+ * The rows are kept sorted by begin time and an interval index of the rows answers which events overlap a time window,
+ * optionally on one rank, so that drawing and hit-testing only visit the events overlapping the visible key range.
+ * Events having the same appearance share one interned style.  When too many events are visible to be told apart,
+ * density bars from a multi-resolution summary of the events are drawn instead.  While the key range is changing the
+ * lane can be set coarse so that only a cheap approximation is drawn until the exact drawing is requested.
+ *
+ * The trace events are drawn in one lane per rank and only the lanes of the ranks within the visible value range are
+ * visited.  When rank folding is enabled and the visible ranks are too close to be told apart, groups of adjacent ranks
+ * are folded into the lanes of the ranks with the minimum, median and maximum total time in traced functions.
+ */
+
+class OSSEventLanePlottable : public QCPAbstractPlottable
+{
+    Q_OBJECT
+
+public:
+
+    explicit OSSEventLanePlottable(QCPAxisRect* axisRect);
+    virtual ~OSSEventLanePlottable();
+
+    void addDataTransfer(double timeBegin, double timeEnd);
+    void addKernelExecution(double timeBegin, double timeEnd);
+    void addPeriodicSample(double timeBegin, double timeEnd, double count);
+    void addTraceEvents(const QString& functionName, const TraceEventStore& store);
+
+    int eventCount() const;
+
+    void setCoarse(bool coarse);
+    bool isCoarse() const;
+
+    void setRankFolding(bool enabled);
+    bool hasRankFolding() const;
+    int eventAt(const QPointF& pos) const;
+    QVector< int > findEvents(double lower, double upper) const;
+    QVector< int > findEvents(int rank, double lower, double upper) const;
+
+    double timeBegin(int index) const;
+    double timeEnd(int index) const;
+    double value(int index) const;
+    QString styleName(int index) const;
+
+    static QColor getTraceColor(const QString& functionName);
+
+    static double s_halfHeight;
+
+#if !defined(HAS_QCUSTOMPLOT_V2)
+    virtual void clearData() Q_DECL_OVERRIDE;
+#endif
+    virtual double selectTest(const QPointF &pos, bool onlySelectable, QVariant *details = 0) const Q_DECL_OVERRIDE;
+
+protected:
+
+    virtual void draw(QCPPainter *painter) Q_DECL_OVERRIDE;
+    virtual void drawLegendIcon(QCPPainter *painter, const QRectF &rect) const Q_DECL_OVERRIDE;
+#if defined(HAS_QCUSTOMPLOT_V2)
+    virtual QCPRange getKeyRange(bool &foundRange, QCP::SignDomain inSignDomain = QCP::sdBoth) const Q_DECL_OVERRIDE;
+    virtual QCPRange getValueRange(bool &foundRange, QCP::SignDomain inSignDomain = QCP::sdBoth, const QCPRange &inKeyRange = QCPRange()) const Q_DECL_OVERRIDE;
+#else
+    virtual QCPRange getKeyRange(bool &foundRange, SignDomain inSignDomain = sdBoth) const Q_DECL_OVERRIDE;
+    virtual QCPRange getValueRange(bool &foundRange, SignDomain inSignDomain = sdBoth) const Q_DECL_OVERRIDE;
+#endif
+
+private:
+
+    enum Shape {
+        AxisRectBand,       // vertical extent is a fixed ratio of the axis rect height
+        RankBar,            // vertical extent is centered on the rank value
+        CountBar            // vertical extent is from zero to the counter value
+    };
+
+    typedef struct {
+        QVector< float > busy;          // fraction of the bucket covered by events
+        QVector< quint32 > count;       // number of events overlapping the bucket
+        QVector< int > dominant;        // style of the longest event portion within the bucket (-1 if empty)
+        QVector< float > dominantTime;  // length of that event portion
+        QVector< float > maxValue;      // largest rank or counter value in the bucket
+    } SummaryLevel;
+
+    typedef struct {
+        Shape shape;
+        double value;                       // the rank of a trace event row
+        QVector< SummaryLevel > levels;     // each next level has half the buckets of the previous level
+    } SummaryRow;
+
+    typedef struct {
+        int rank;                           // the rank of the trace events in the lane (or the key of the other events)
+        double center;                      // the value axis position of the lane
+        double halfHeight;                  // half the height of the lane in value axis units
+    } RankLane;
+
+    typedef struct {
+        QString name;
+        Shape shape;
+        QBrush brush;
+        QPen pen;
+        bool rounded;
+        QString label;
+    } EventStyle;
+
+    int getStyleIndex(const QString& name, Shape shape, const QColor& color, bool rounded, bool hasPen, const QString& label = QString());
+    void appendEvent(double timeBegin, double timeEnd, double value, int style);
+    void updateIndex() const;
+    void sortEvents() const;
+    QVector< RankLane > getRankLanes() const;
+    void updateFoldGroups(int foldSize) const;
+    QRectF getEventRect(int index, const RankLane& lane) const;
+    void getExtent(const RankLane& lane, Shape shape, double value, double& y1, double& y2) const;
+    void drawEvents(QCPPainter* painter, const RankLane& lane, const QVector< int >& events, bool drawLabels) const;
+    void buildSummary() const;
+    void drawSummary(QCPPainter* painter, const QVector< RankLane >& lanes, double lower, double upper, double minBucketPixels) const;
+
+    // the event rows are sorted and indexed lazily on the next draw or query after events were appended
+    mutable QVector< double > m_begin;
+    mutable QVector< double > m_end;
+    mutable QVector< double > m_value;
+    mutable QVector< int > m_style;
+    mutable bool m_sorted;
+
+    mutable EventIntervalIndex m_index;
+    mutable bool m_indexValid;
+
+    // the ranks are found when the index is rebuilt and the folded groups when the fold size changes
+    mutable QVector< int > m_ranks;                 // distinct ranks of the trace events in ascending order
+    mutable QVector< double > m_rankBusy;           // total time of the trace events of each rank
+    mutable QMap< int, QVector< int > > m_foldGroups;   // map group to the ranks with the minimum, median and maximum time
+    mutable int m_foldSize;                         // number of ranks in each group of m_foldGroups (0 if not built)
+    bool m_rankFolding;
+
+    QVector< EventStyle > m_styles;
+    QHash< QString, int > m_styleIndexes;
+
+    // the level-of-detail summary is rebuilt lazily on the next draw needing it after events were appended
+    mutable QVector< SummaryRow > m_summaryRows;
+    mutable QHash< int, QVector< int > > m_laneRows;    // map lane rank to its summary rows
+    mutable bool m_summaryValid;
+    mutable double m_summaryLower;
+    mutable double m_summaryUpper;
+
+    bool m_coarse;                      // draw the cheap approximation while the key range is changing
+
+};
+
+
+} // GUI
+} // ArgoNavis
+
+#endif // OSSEVENTLANEPLOTTABLE_H
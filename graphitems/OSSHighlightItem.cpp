@@ -23,7 +23,9 @@
 
 #include "OSSHighlightItem.h"
 
-#include "OSSTraceItem.h"
+#include "OSSEventLanePlottable.h"
+
+#include "managers/TraceEventStore.h"
 
 #include <QTimer>
 
@@ -80,12 +82,15 @@ OSSHighlightItem::~OSSHighlightItem()
  * depend on the rank value.  If rank is not equal to -1, then this signifies an event plotted over a periodic sample background
  * and the y-axis values are fixed ratio values; otherwise it is an MPI trace event and the rank is the y-axis value.  Once the
  * axis coordinates are set and the item is made visible, the graph is replotted.  A single-shot timer is started to hide the
- * highlight item after an appropriate delay.
+ * highlight item after an appropriate delay.  For a trace event the times are snapped to the matching event of the event lane.
  */
 void OSSHighlightItem::setData(const QString &annotation, double timeBegin, double timeEnd, int rank)
 {
     m_annotation = annotation;
 
+    if ( -1 != rank )
+        snapToTraceEvent( annotation, timeBegin, timeEnd, rank );
+
     // set brushes and pens for normal (non-selected) appearance
     setBrush( QBrush( OUTLINE_BRUSH_COLOR ) );
 
@@ -106,8 +111,8 @@ void OSSHighlightItem::setData(const QString &annotation, double timeBegin, doub
         bottomRight->setCoords( timeEnd, 0.60 );
     }
     else {
-        topLeft->setCoords( timeBegin, (double) rank + OSSTraceItem::s_halfHeight + 0.1 );
-        bottomRight->setCoords( timeEnd, (double) rank - OSSTraceItem::s_halfHeight - 0.1 );
+        topLeft->setCoords( timeBegin, (double) rank + OSSEventLanePlottable::s_halfHeight + 0.1 );
+        bottomRight->setCoords( timeEnd, (double) rank - OSSEventLanePlottable::s_halfHeight - 0.1 );
     }
 
     // make visible
@@ -123,6 +128,48 @@ void OSSHighlightItem::setData(const QString &annotation, double timeBegin, doub
     parentPlot()->replot();
 }
 
+/**
+ * @brief OSSHighlightItem::snapToTraceEvent
+ * @param functionLabel - the function column value of the details view (function name and defining location)
+ * @param timeBegin - the starting time of the event (as shown in the details view)
+ * @param timeEnd - the ending time of the event (as shown in the details view)
+ * @param rank - the rank of the event
+ *
+ * The times shown in the details view are rounded.  Query the interval index of the event lane of the axis rect for the
+ * events of the function on the rank overlapping the time window and replace the times with those of the closest event.
+ * The events of the lane are named by function name only, so the defining location is removed from the function label.
+ */
+void OSSHighlightItem::snapToTraceEvent(const QString &functionLabel, double &timeBegin, double &timeEnd, int rank) const
+{
+    const QString functionName = TraceEventStore::getFunctionName( functionLabel );
+
+    foreach ( QCPAbstractPlottable* plottable, m_axisRect->plottables() ) {
+        OSSEventLanePlottable* lane = qobject_cast< OSSEventLanePlottable* >( plottable );
+
+        if ( Q_NULLPTR == lane )
+            continue;
+
+        int closest( -1 );
+        double closestDistance( 0.0 );
+
+        foreach ( int index, lane->findEvents( rank, timeBegin, timeEnd ) ) {
+            if ( lane->styleName( index ) != functionName )
+                continue;
+            const double distance = qAbs( lane->timeBegin( index ) - timeBegin ) + qAbs( lane->timeEnd( index ) - timeEnd );
+            if ( -1 == closest || distance < closestDistance ) {
+                closest = index;
+                closestDistance = distance;
+            }
+        }
+
+        if ( -1 != closest ) {
+            timeBegin = lane->timeBegin( closest );
+            timeEnd = lane->timeEnd( closest );
+            return;
+        }
+    }
+}
+
 /**
  * @brief OSSHighlightItem::draw
  * @param painter - the painter used for drawing
@@ -58,6 +58,8 @@ private slots:
 
 private:
 
+    void snapToTraceEvent(const QString& functionLabel, double& timeBegin, double& timeEnd, int rank) const;
+
     QCPAxisRect* m_axisRect;
 
     QString m_annotation;
@@ -111,6 +111,7 @@ MainWindow::MainWindow(QWidget *parent)
         connect( dataMgr, &PerformanceDataManager::removeCluster, this, &MainWindow::handleRemoveCluster );
         connect( dataMgr, &PerformanceDataManager::addMetricView, ui->widget_SourceCodeViewer, &SourceView::addMetricView );
         connect( dataMgr, &PerformanceDataManager::addMetricViewData, ui->widget_SourceCodeViewer, &SourceView::addMetricViewData );
+        connect( dataMgr, &PerformanceDataManager::addMetricViewDataBlock, ui->widget_SourceCodeViewer, &SourceView::addMetricViewDataBlock );
         connect( ui->widget_MetricTableView, &PerformanceDataMetricView::signalMetricViewChanged, ui->widget_SourceCodeViewer, &SourceView::handleMetricViewChanged );
         connect( dataMgr, &PerformanceDataManager::signalSetDefaultMetricView, ui->widget_MetricViewManager, &MetricViewManager::handleSwitchView );
         connect( dataMgr, &PerformanceDataManager::signalSetDefaultMetricView, this, &MainWindow::handleSetDefaultMetricView );
@@ -149,6 +150,8 @@ MainWindow::MainWindow(QWidget *parent)
                  ui->widget_SourceCodeViewer, SIGNAL(addMetricView(QString,QString,QString,QString,QStringList)) );
         connect( dataMgr, SIGNAL(addMetricViewData(QString,QString,QString,QString,QVariantList,QStringList)),
                  ui->widget_SourceCodeViewer, SIGNAL(addMetricViewData(QString,QString,QString,QString,QVariantList,QStringList)) );
+        connect( dataMgr, SIGNAL(addMetricViewDataBlock(QString,QString,QString,QString,MetricViewDataBlock,QStringList)),
+                 ui->widget_SourceCodeViewer, SIGNAL(addMetricViewDataBlock(QString,QString,QString,QString,MetricViewDataBlock,QStringList)) );
         connect( ui->widget_MetricTableView, SIGNAL(signalMetricViewChanged(QString)),
                  ui->widget_SourceCodeViewer, SLOT(handleMetricViewChanged(QString)) );
         connect( dataMgr, SIGNAL(signalSetDefaultMetricView(MetricViewTypes,bool,bool,bool,bool,bool)),
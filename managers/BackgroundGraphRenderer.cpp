@@ -26,18 +26,29 @@
 #include "BackgroundGraphRendererBackend.h"
 #include "ApplicationOverrideCursorManager.h"
 
-#include "QCustomPlot/CustomPlot.h"
-
-#include "graphitems/OSSDataTransferItem.h"
-#include "graphitems/OSSKernelExecutionItem.h"
-
 #include <QImage>
-#include <QtConcurrentRun>
+#include <QDebug>
 
 
 namespace ArgoNavis { namespace GUI {
 
 
+// maximum number of tiles rendered before returning to the event loop
+const int TILES_PER_PASS = 16;
+
+// height of the CUDA event strip relative to the plot axis rectangle
+const double STRIP_HEIGHT_RATIO = 0.10;
+
+// maximum period between snapshot updates while the user keeps changing the graph range
+const int RANGE_CHANGE_MAX_WAIT = 1000;
+
+// number of coarser zoom levels searched for cached tiles when a coarse snapshot is needed
+const int COARSE_LEVELS = 4;
+
+// ratio of the plot width to the width of a coarse snapshot rasterized directly
+const int COARSE_DOWNSAMPLE = 4;
+
+
 /**
  * @brief BackgroundGraphRenderer::BackgroundGraphRenderer
  * @param parent - the parent QObject instance
@@ -46,21 +57,25 @@ namespace ArgoNavis { namespace GUI {
  */
 BackgroundGraphRenderer::BackgroundGraphRenderer(QObject *parent)
     : QObject( parent )
+    , m_pendingTilesScheduled( false )
 {
 #ifdef HAS_CONCURRENT_PROCESSING_VIEW_DEBUG
     qDebug() << "BackgroundGraphRenderer::BackgroundGraphRenderer: thread=" << QString::number((long long)QThread::currentThread(), 16);
     qDebug() << "BackgroundGraphRenderer::BackgroundGraphRenderer: &m_thread=" << QString::number((long long)&m_thread, 16);
 #endif
 
-    // setup signal-to-slot connection for creating QCustomPlot instance in the GUI thread
+    // setup signal-to-slot connection for creating the CUDA event rasterizer in the thread of this instance
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
-    connect( this, &BackgroundGraphRenderer::createPlotForClustering, this, &BackgroundGraphRenderer::handleCreatePlotForClustering, Qt::QueuedConnection );
+    connect( this, &BackgroundGraphRenderer::createRasterizerForClustering, this, &BackgroundGraphRenderer::handleCreateRasterizerForClustering, Qt::QueuedConnection );
     connect( &m_userChangeMgr, &UserGraphRangeChangeManager::timeout, this, &BackgroundGraphRenderer::handleGraphRangeChangedTimeout );
 #else
-    connect( this, SIGNAL(createPlotForClustering(QString,QString)), this, SLOT(handleCreatePlotForClustering(QString,QString)), Qt::QueuedConnection );
+    connect( this, SIGNAL(createRasterizerForClustering(QString,QString)), this, SLOT(handleCreateRasterizerForClustering(QString,QString)), Qt::QueuedConnection );
     connect( &m_userChangeMgr, SIGNAL(timeout(QString,QString,double,double,QSize)), this, SLOT(handleGraphRangeChangedTimeout(QString,QString,double,double,QSize)) );
 #endif
 
+    // tile rendering is cheap enough to refresh the snapshot periodically during long zoom and pan operations
+    m_userChangeMgr.setMaxWait( RANGE_CHANGE_MAX_WAIT );
+
     // start thread for backend processing
     m_thread.start();
 }
@@ -75,6 +90,8 @@ BackgroundGraphRenderer::~BackgroundGraphRenderer()
     // stop thread and wait for termination
     m_thread.quit();
     m_thread.wait();
+
+    qDeleteAll( m_rasterizer );
 }
 
 /**
@@ -84,7 +101,7 @@ BackgroundGraphRenderer::~BackgroundGraphRenderer()
  * @param data - the CUDA performance data object for the clustering criteria
  *
  * Create a new background graph renderer backend, which when signalled, will process the CUDA events maintained in the performance data object and
- * emit signals to be handled by this class to add CUDA event information to the QCustomPlot for the associated cluster.  These signal connections
+ * emit signals to be handled by this class to add CUDA event information to the rasterizer for the associated cluster.  These signal connections
  * are setup by this method.
  */
 void BackgroundGraphRenderer::setPerformanceData(const QString& clusteringCriteriaName, const QVector< QString >& clusterNames, const CUDA::PerformanceData& data)
@@ -92,10 +109,10 @@ void BackgroundGraphRenderer::setPerformanceData(const QString& clusteringCriter
     BackgroundGraphRendererBackend* backend = new BackgroundGraphRendererBackend( clusteringCriteriaName, data );
 
     if ( backend ) {
-        // emit signal to create QCustomPlot for each cluster
-        // NOTE: signal will be handled in the GUI thread were the QCustomPlot instance needs to live
+        // emit signal to create rasterizer for each cluster
+        // NOTE: signal will be handled in the thread of this instance where the events are added and rasterized
         foreach(const QString& clusterName, clusterNames) {
-            emit createPlotForClustering( clusteringCriteriaName, clusterName );
+            emit createRasterizerForClustering( clusteringCriteriaName, clusterName );
         }
 
         // set backend object name to clustering criteria name (so it can be identified in timer handlers) and move to backend thread
@@ -105,13 +122,11 @@ void BackgroundGraphRenderer::setPerformanceData(const QString& clusteringCriter
         // setup signal-to-signal and signal-to-slot connectionsthread
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
         connect( this, &BackgroundGraphRenderer::signalProcessCudaEventView, backend, &BackgroundGraphRendererBackend::signalProcessCudaEventViewStart );
-        connect( backend, &BackgroundGraphRendererBackend::addDataTransfer, this, &BackgroundGraphRenderer::processDataTransferEvent, Qt::QueuedConnection );
-        connect( backend, &BackgroundGraphRendererBackend::addKernelExecution, this, &BackgroundGraphRenderer::processKernelExecutionEvent, Qt::QueuedConnection );
+        connect( backend, &BackgroundGraphRendererBackend::addCudaEvents, this, &BackgroundGraphRenderer::processCudaEvents, Qt::QueuedConnection );
         connect( backend, &BackgroundGraphRendererBackend::signalProcessCudaEventViewDone, this, &BackgroundGraphRenderer::handleProcessCudaEventViewDone, Qt::QueuedConnection );
 #else
         connect( this, SIGNAL(signalProcessCudaEventView()), backend, SIGNAL(signalProcessCudaEventViewStart()) );
-        connect( backend, SIGNAL(addDataTransfer(QString,Base::Time,CUDA::DataTransfer)), this, SLOT(processDataTransferEvent(QString,Base::Time,CUDA::DataTransfer)), Qt::QueuedConnection );
-        connect( backend, SIGNAL(addKernelExecution(QString,Base::Time,CUDA::KernelExecution)), this, SLOT(processKernelExecutionEvent(QString,Base::Time,CUDA::KernelExecution)), Qt::QueuedConnection );
+        connect( backend, SIGNAL(addCudaEvents(QString,CudaEventSpansPtr)), this, SLOT(processCudaEvents(QString,CudaEventSpansPtr)), Qt::QueuedConnection );
         connect( backend, SIGNAL(signalProcessCudaEventViewDone()), this, SLOT(handleProcessCudaEventViewDone()), Qt::QueuedConnection );
 #endif
 
@@ -125,20 +140,28 @@ void BackgroundGraphRenderer::setPerformanceData(const QString& clusteringCriter
  * @param clusteringCriteriaName - the clustering criteria name associated with the cluster group
  * @param clusterNames - the list of associated clusters
  *
- * Delete the QCustomPlot instances associated with the provided list of clusters and remove from plot map.
+ * Delete the rasterizer instances associated with the provided list of clusters and remove from rasterizer map.
+ * The cached tiles and pending snapshot requests of the clusters are discarded.
  */
 void BackgroundGraphRenderer::unloadCudaViews(const QString &clusteringCriteriaName, const QStringList &clusterNames)
 {
     Q_UNUSED( clusteringCriteriaName )
 
-    // remove the associated plots
-    QMutableMapIterator< QString, CustomPlot* > piter( m_plot );
-    while ( piter.hasNext() ) {
-        piter.next();
-        if ( clusterNames.contains( piter.key() ) ) {
-            QCustomPlot* plot( piter.value() );
-            delete plot;
-            piter.remove();
+    foreach ( const QString& clusterName, clusterNames ) {
+        if ( m_requests.contains( clusterName ) ) {
+            finishRequest( m_requests[ clusterName ] );
+            m_requests.remove( clusterName );
+        }
+        m_tiles.remove( clusterName );
+    }
+
+    // remove the associated rasterizers
+    QMutableMapIterator< QString, CudaEventRasterizer* > riter( m_rasterizer );
+    while ( riter.hasNext() ) {
+        riter.next();
+        if ( clusterNames.contains( riter.key() ) ) {
+            delete riter.value();
+            riter.remove();
         }
     }
 }
@@ -151,30 +174,30 @@ void BackgroundGraphRenderer::unloadCudaViews(const QString &clusteringCriteriaN
  * @param upper - the new X-axis upper range
  * @param size - the size of the plot axis rectangle
  *
- * This method handles graph range changed events so that the processing of the CUDA events for the new view can be initiated after a waiting period.
- * The waiting period is handled by a timer run in a thread and allows processing only if the user has stopped manipulating the graph view (zoom and pan).
+ * This method handles graph range changed events.  A coarse snapshot of the new range is emitted immediately and any exact
+ * rendering still in progress for the previous range is abandoned.  The processing of the exact snapshot for the new view is
+ * initiated after a waiting period.  The waiting period allows processing only if the user has stopped manipulating the graph
+ * view (zoom and pan), or periodically during long drags.
  */
 void BackgroundGraphRenderer::handleGraphRangeChanged(const QString& clusteringCriteriaName, const QString& clusterName, double lower, double upper, const QSize& size)
 {
-    m_userChangeMgr.cancel( clusterName );
-
-    if ( ! m_plot.contains( clusterName ) )
+    if ( ! m_rasterizer.contains( clusterName ) )
         return;
 
 #ifdef HAS_CONCURRENT_PROCESSING_VIEW_DEBUG
     qDebug() << "BackgroundGraphRenderer::handleGraphRangeChanged: clusterName=" << clusterName << "lower=" << lower << "upper=" << upper;
 #endif
 
-    QCustomPlot* plot( m_plot.value( clusterName ) );
-    if ( plot ) {
-        QCPAxisRect* axisRect = plot->axisRect();
-        if ( axisRect ) {
-            QCPAxis* xAxis = axisRect->axis( QCPAxis::atBottom );
-            if ( xAxis ) {
-                m_userChangeMgr.create( clusteringCriteriaName, clusterName, lower, upper, size );
-            }
-        }
+    if ( updateRequest( clusteringCriteriaName, clusterName, lower, upper, size ) ) {
+        SnapshotRequest& request = m_requests[ clusterName ];
+
+        // the exact snapshot is rendered again once the range changes have settled
+        finishRequest( request );
+
+        emitCoarseSnapshot( clusterName, request, size.width() );
     }
+
+    m_userChangeMgr.create( clusteringCriteriaName, clusterName, lower, upper, size );
 }
 
 /**
@@ -186,120 +209,69 @@ void BackgroundGraphRenderer::handleGraphRangeChanged(const QString& clusteringC
  * @param size - the size of the plot axis rectangle
  *
  * This handler in invoked when the waiting period has benn reached and actual processing of the CUDA events can proceed.
+ * The snapshot is composed from the cached tiles of the zoom level matching the new range.  Only tiles not yet cached
+ * are rendered, so panning renders just the newly exposed tiles.
  */
 void BackgroundGraphRenderer::handleGraphRangeChangedTimeout(const QString& clusteringCriteriaName, const QString& clusterName, double lower, double upper, const QSize& size)
 {
-    Q_UNUSED( clusteringCriteriaName )
 #ifdef HAS_CONCURRENT_PROCESSING_VIEW_DEBUG
     qDebug() << "BackgroundGraphRenderer::handleGraphRangeChangedTimeout: clusterName=" << clusterName << "lower=" << lower << "upper=" << upper;
 #endif
-    if ( ! m_plot.contains( clusterName ) )
+    if ( ! m_rasterizer.contains( clusterName ) )
         return;
 
-    CustomPlot* plot( m_plot.value( clusterName ) );
-    if ( plot ) {
-        QCPAxisRect* axisRect = plot->axisRect();
-        if ( axisRect ) {
-            QCPAxis* xAxis = axisRect->axis( QCPAxis::atBottom );
-            if ( xAxis ) {
-                if ( 0 != size.width() && 0 != size.height() && lower != upper ) {
-                    ApplicationOverrideCursorManager* cursorManager = ApplicationOverrideCursorManager::instance();
-                    if ( cursorManager ) {
-                        cursorManager->startWaitingOperation( QStringLiteral("cuda-events") );
-                    }
-                    plot->setProperty( "imageWidth", size.width() );
-                    plot->setProperty( "imageHeight", size.height() );
-                    xAxis->setRange( lower, upper );
-                    // force graph replot
-            #if defined(HAS_QCUSTOMPLOT_V2)
-                    plot->replot( QCustomPlot::rpQueuedReplot );
-            #else
-                    plot->replot();
-            #endif
-                }
-            }
-        }
-    }
+    if ( ! updateRequest( clusteringCriteriaName, clusterName, lower, upper, size ) )
+        return;
+
+    m_requests[ clusterName ].complete = false;
+
+    processCudaEventSnapshot( clusterName );
 }
 
 /**
- * @brief BackgroundGraphRenderer::processDataTransferEvent
- * @param clusteringName - the cluster group name
- * @param time_origin - the time origin of the experiment
- * @param details - the details of the data transfer event
+ * @brief BackgroundGraphRenderer::updateRequest
+ * @param clusteringCriteriaName - the clustering criteria name associated with the cluster group
+ * @param clusterName - the cluster group name
+ * @param lower - the new X-axis lower range
+ * @param upper - the new X-axis upper range
+ * @param size - the size of the plot axis rectangle
+ * @return - indicates whether the range and size are valid and the snapshot request of the cluster was updated
  *
- * Create the data transfer graph item from the details using the associated axis rect.
- * Add graph item to QCustomPlot instance.
+ * Set the range, zoom level and strip height of the snapshot request of the cluster.  The completion state is unchanged.
  */
-void BackgroundGraphRenderer::processDataTransferEvent(const QString& clusteringName,
-                                                       const Base::Time &time_origin,
-                                                       const CUDA::DataTransfer &details)
+bool BackgroundGraphRenderer::updateRequest(const QString &clusteringCriteriaName, const QString &clusterName, double lower, double upper, const QSize &size)
 {
-    if ( ! m_plot.contains( clusteringName ) )
-        return;
+    const int height = size.height() * STRIP_HEIGHT_RATIO;
 
-    QCustomPlot* plot = m_plot.value( clusteringName );
+    if ( 0 == size.width() || 0 == height || lower >= upper )
+        return false;
 
-    if ( Q_NULLPTR == plot )
-        return;
-
-    OSSDataTransferItem* dataXferItem = new OSSDataTransferItem( plot->axisRect(), plot );
-
-    if ( ! dataXferItem )
-        return;
+    SnapshotRequest& request = m_requests[ clusterName ];
 
-    dataXferItem->setData( time_origin, details );
+    request.clusteringCriteriaName = clusteringCriteriaName;
+    request.lower = lower;
+    request.upper = upper;
+    request.level = CudaEventTileCache::getZoomLevel( lower, upper, size.width() );
+    request.height = height;
 
-#if !defined(HAS_QCUSTOMPLOT_V2)
-    plot->addItem( dataXferItem );
-#endif
-
-#ifdef HAS_PROCESS_EVENT_DEBUG
-    QString line;
-    QTextStream output(&line);
-    output << "Data Transfer: " << *dataXferItem;
-    qDebug() << line;
-#endif
+    return true;
 }
 
 /**
- * @brief BackgroundGraphRenderer::processKernelExecutionEvent
+ * @brief BackgroundGraphRenderer::processCudaEvents
  * @param clusteringName - the cluster group name
- * @param time_origin - the time origin of the experiment
- * @param details - the details of the kernel execution event
+ * @param events - the CUDA event arrays of one thread of the cluster
  *
- * Find the axis rect associated with the specified metric group and metric name.  Create the kernel execution graph item from the details using the associated axis rect.
- * Add graph item to QCustomPlot instance.
+ * Add the CUDA events of the thread to the rasterizer of the cluster.
  */
-void BackgroundGraphRenderer::processKernelExecutionEvent(const QString& clusteringName,
-                                                          const Base::Time &time_origin,
-                                                          const CUDA::KernelExecution &details)
+void BackgroundGraphRenderer::processCudaEvents(const QString &clusteringName, const CudaEventSpansPtr &events)
 {
-    if ( ! m_plot.contains( clusteringName ) )
-        return;
+    CudaEventRasterizer* rasterizer = m_rasterizer.value( clusteringName );
 
-    QCustomPlot* plot = m_plot.value( clusteringName );
-
-    if ( Q_NULLPTR == plot )
-        return;
-
-    OSSKernelExecutionItem* kernelExecItem = new OSSKernelExecutionItem( plot->axisRect(), plot );
-
-    if ( ! kernelExecItem )
+    if ( Q_NULLPTR == rasterizer || events.isNull() )
         return;
 
-    kernelExecItem->setData( time_origin, details );
-
-#if !defined(HAS_QCUSTOMPLOT_V2)
-    plot->addItem( kernelExecItem );
-#endif
-
-#ifdef HAS_PROCESS_EVENT_DEBUG
-    QString line;
-    QTextStream output(&line);
-    output << "Kernel Execution: " << *kernelExecItem;
-    qDebug() << line;
-#endif
+    rasterizer->addEvents( *events );
 }
 
 /**
@@ -320,15 +292,13 @@ void BackgroundGraphRenderer::handleProcessCudaEventViewDone()
         // get the associated clustering criteria name
         QString clusteringCriteriaName( backend->objectName() );
 
-        QMap< QString, CustomPlot* >::iterator iter( m_plot.begin() );
-        while ( iter != m_plot.end() ) {
-            CustomPlot* plot( iter.value() );
-            if ( plot ) {
-#ifdef HAS_EXPERIMENTAL_CONCURRENT_PLOT_TO_IMAGE
-                QtConcurrent::run( this, &BackgroundGraphRenderer::processCudaEventSnapshot, plot );
-#else
-                processCudaEventSnapshot( plot );
-#endif
+        // the cached tiles no longer reflect all events so discard them and render the current snapshots again
+        QMap< QString, CudaEventRasterizer* >::iterator iter( m_rasterizer.begin() );
+        while ( iter != m_rasterizer.end() ) {
+            m_tiles.remove( iter.key() );
+            if ( m_requests.contains( iter.key() ) ) {
+                m_requests[ iter.key() ].complete = false;
+                processCudaEventSnapshot( iter.key() );
             }
             iter++;
         }
@@ -341,98 +311,208 @@ void BackgroundGraphRenderer::handleProcessCudaEventViewDone()
 }
 
 /**
- * @brief BackgroundGraphRenderer::processCudaEventSnapshots
+ * @brief BackgroundGraphRenderer::processCudaEventSnapshot
+ * @param clusterName - the cluster group name
  *
- * Handle QCustomPlot afterReplot() signal.  Determine QCustomPlot emitting signal and further process in a different thread.
+ * Emits the snapshot for the latest request of the cluster when all exact tiles are cached.  Otherwise the missing exact
+ * tiles are rendered while the coarse snapshot emitted for the range change remains shown.
  */
-void BackgroundGraphRenderer::processCudaEventSnapshot()
+void BackgroundGraphRenderer::processCudaEventSnapshot(const QString &clusterName)
 {
 #ifdef HAS_CONCURRENT_PROCESSING_VIEW_DEBUG
     qDebug() << "BackgroundGraphRenderer::processCudaEventSnapshot: thread=" << QString::number((long long)QThread::currentThread(), 16);
 #endif
-    CustomPlot* plot = qobject_cast< CustomPlot* >( sender() );
+    SnapshotRequest& request = m_requests[ clusterName ];
 
-    if ( plot ) {
-#ifdef HAS_EXPERIMENTAL_CONCURRENT_PLOT_TO_IMAGE
-        QtConcurrent::run( this, &BackgroundGraphRenderer::processCudaEventSnapshot, plot );
-#else
-        processCudaEventSnapshot( plot );
-#endif
+    if ( emitCudaEventSnapshot( clusterName, request, request.level ) ) {
+        finishRequest( request );
+        return;
+    }
+
+    if ( ! request.waiting ) {
+        ApplicationOverrideCursorManager* cursorManager = ApplicationOverrideCursorManager::instance();
+        if ( cursorManager ) {
+            cursorManager->startWaitingOperation( QStringLiteral("cuda-events") );
+        }
+        request.waiting = true;
     }
+
+    schedulePendingTiles();
 }
 
 /**
- * @brief BackgroundGraphRenderer::processCudaEventSnapshot
- * @param plot - the plot to be rendered to image
+ * @brief BackgroundGraphRenderer::emitCudaEventSnapshot
+ * @param clusterName - the cluster group name
+ * @param request - the snapshot request
+ * @param level - the zoom level of the tiles to use
+ * @return - indicates whether all tiles covering the requested range were cached and the snapshot was emitted
  *
- * Renders plot to image and emits signal to provide image to consumers.
+ * The emitted range is the range covered by the tiles, which contains the requested range.
  */
-void BackgroundGraphRenderer::processCudaEventSnapshot(CustomPlot* plot)
+bool BackgroundGraphRenderer::emitCudaEventSnapshot(const QString &clusterName, const SnapshotRequest &request, int level)
 {
-#ifdef HAS_CONCURRENT_PROCESSING_VIEW_DEBUG
-    qDebug() << "BackgroundGraphRenderer::processCudaEventSnapshot: thread=" << QString::number((long long)QThread::currentThread(), 16);
-#endif
-    // get the associated clustering criteria / cluster name
-    QString clusteringName( plot->property( "clusteringName" ).toString() );
-    QString clusteringCriteriaName( plot->property( "clusteringCriteriaName" ).toString() );
-    int width( plot->property( "imageWidth" ).toInt() );
-    int height( plot->property( "imageHeight" ).toInt() );
-    QCPRange range = plot->axisRect()->axis( QCPAxis::atBottom )->range();
-
-    if ( 0 != width && 0 != height && range.lower != range.upper ) {
-        // setup image and QCPPainter instance rendering to the image
-        QImage image( width, height, QImage::Format_ARGB32 );
-        image.fill( Qt::transparent );
-        QCPPainter* painter = new QCPPainter( &image );
-        if ( painter ) {
-            plot->setBackground( Qt::transparent );
-            // start the rendering to the image
-            plot->toPainter( painter, width, height );
-
-            // generate a cropped image with just the CUDA event portion
-            QImage croppedImage = image.copy( 0, height * 0.45 + 1, width, height * 0.10 );
-
-            // signal the new CUDA event snapshot
-            emit signalCudaEventSnapshot( clusteringCriteriaName, clusteringName, range.lower, range.upper, croppedImage );
-
-            // cleanup painter instance
-            delete painter;
-
-            ApplicationOverrideCursorManager* cursorManager = ApplicationOverrideCursorManager::instance();
-            if ( cursorManager ) {
-                cursorManager->finishWaitingOperation( QStringLiteral("cuda-events") );
+    const qint64 first = CudaEventTileCache::getTileIndex( level, request.lower );
+    const qint64 last = CudaEventTileCache::getTileIndex( level, request.upper );
+
+    QImage image;
+
+    if ( ! m_tiles.compose( clusterName, level, first, last, request.height, image ) )
+        return false;
+
+    const double span = CudaEventTileCache::getTileSpan( level );
+
+    // signal the new CUDA event snapshot
+    emit signalCudaEventSnapshot( request.clusteringCriteriaName, clusterName, first * span, ( last + 1 ) * span, image );
+
+    return true;
+}
+
+/**
+ * @brief BackgroundGraphRenderer::emitCoarseSnapshot
+ * @param clusterName - the cluster group name
+ * @param request - the snapshot request
+ * @param width - the width of the plot axis rectangle
+ *
+ * Emits an approximate snapshot of the requested range without rendering any tiles.  The cached tiles of the exact zoom
+ * level are preferred, then those of the coarser levels (fewer tiles) and then those of the next finer level.  When none
+ * cover the range the snapshot is rasterized directly at a fraction of the plot width.
+ */
+void BackgroundGraphRenderer::emitCoarseSnapshot(const QString &clusterName, const SnapshotRequest &request, int width)
+{
+    for ( int level = request.level; level <= request.level + COARSE_LEVELS; ++level ) {
+        if ( emitCudaEventSnapshot( clusterName, request, level ) )
+            return;
+    }
+
+    if ( emitCudaEventSnapshot( clusterName, request, request.level - 1 ) )
+        return;
+
+    const CudaEventRasterizer* rasterizer = m_rasterizer.value( clusterName );
+
+    if ( Q_NULLPTR == rasterizer )
+        return;
+
+    QImage image( qMax( 1, width / COARSE_DOWNSAMPLE ), request.height, QImage::Format_ARGB32_Premultiplied );
+
+    rasterizer->rasterize( image, request.lower, request.upper );
+
+    emit signalCudaEventSnapshot( request.clusteringCriteriaName, clusterName, request.lower, request.upper, image );
+}
+
+/**
+ * @brief BackgroundGraphRenderer::renderTile
+ * @param rasterizer - the rasterizer containing the CUDA events of the cluster
+ * @param level - the zoom level
+ * @param index - the tile index
+ * @param request - the snapshot request providing the strip height
+ * @return - the image of the CUDA event strip for the tile
+ */
+QImage BackgroundGraphRenderer::renderTile(const CudaEventRasterizer *rasterizer, int level, qint64 index, const SnapshotRequest &request) const
+{
+    const double span = CudaEventTileCache::getTileSpan( level );
+
+    QImage tile( CudaEventTileCache::TILE_WIDTH, request.height, QImage::Format_ARGB32_Premultiplied );
+
+    rasterizer->rasterize( tile, index * span, ( index + 1 ) * span );
+
+    return tile;
+}
+
+/**
+ * @brief BackgroundGraphRenderer::processPendingTiles
+ *
+ * Renders a limited number of the missing tiles of the incomplete snapshot requests and emits the snapshots that became
+ * complete.  Returning to the event loop between passes keeps the GUI responsive and lets newer requests replace older ones
+ * before their tiles are rendered.
+ */
+void BackgroundGraphRenderer::processPendingTiles()
+{
+    m_pendingTilesScheduled = false;
+
+    int budget( TILES_PER_PASS );
+    bool pending( false );
+
+    QMutableMapIterator< QString, SnapshotRequest > iter( m_requests );
+    while ( iter.hasNext() ) {
+        iter.next();
+
+        SnapshotRequest& request = iter.value();
+        if ( request.complete )
+            continue;
+
+        const CudaEventRasterizer* rasterizer = m_rasterizer.value( iter.key() );
+        if ( Q_NULLPTR == rasterizer ) {
+            finishRequest( request );
+            continue;
+        }
+
+        const qint64 first = CudaEventTileCache::getTileIndex( request.level, request.lower );
+        const qint64 last = CudaEventTileCache::getTileIndex( request.level, request.upper );
+
+        for ( qint64 index = first; index <= last && budget > 0; ++index ) {
+            if ( ! m_tiles.contains( iter.key(), request.level, index, request.height ) ) {
+                m_tiles.insert( iter.key(), request.level, index, renderTile( rasterizer, request.level, index, request ) );
+                --budget;
             }
         }
-        else {
-            qWarning() << "Not able to allocate QCPPainter";
+
+        if ( emitCudaEventSnapshot( iter.key(), request, request.level ) )
+            finishRequest( request );
+        else
+            pending = true;
+    }
+
+    if ( pending )
+        schedulePendingTiles();
+}
+
+/**
+ * @brief BackgroundGraphRenderer::schedulePendingTiles
+ *
+ * Queue a pass over the incomplete snapshot requests unless one is already queued.
+ */
+void BackgroundGraphRenderer::schedulePendingTiles()
+{
+    if ( m_pendingTilesScheduled )
+        return;
+
+    m_pendingTilesScheduled = true;
+
+    QMetaObject::invokeMethod( this, "processPendingTiles", Qt::QueuedConnection );
+}
+
+/**
+ * @brief BackgroundGraphRenderer::finishRequest
+ * @param request - the snapshot request
+ *
+ * Mark the request complete and finish the waiting operation started for it.
+ */
+void BackgroundGraphRenderer::finishRequest(SnapshotRequest &request)
+{
+    request.complete = true;
+
+    if ( request.waiting ) {
+        ApplicationOverrideCursorManager* cursorManager = ApplicationOverrideCursorManager::instance();
+        if ( cursorManager ) {
+            cursorManager->finishWaitingOperation( QStringLiteral("cuda-events") );
         }
+        request.waiting = false;
     }
 }
 
 /**
- * @brief BackgroundGraphRenderer::handleCreatePlotForClustering
+ * @brief BackgroundGraphRenderer::handleCreateRasterizerForClustering
  * @param clusteringCriteriaName - the clustering criteria name associated with the cluster group
  * @param clusteringName - the cluster group name
  *
- * This handler creates a new QCustomPlot in the GUI thread to be used for background (non-display) rendering of CUDA events.
+ * This handler creates a new rasterizer in the thread of this instance to be used for background (non-display) rendering of CUDA events.
  */
-void BackgroundGraphRenderer::handleCreatePlotForClustering(const QString& clusteringCriteriaName, const QString &clusteringName)
+void BackgroundGraphRenderer::handleCreateRasterizerForClustering(const QString& clusteringCriteriaName, const QString &clusteringName)
 {
-    CustomPlot* plot = new CustomPlot;
-    if ( plot ) {
-        plot->setProperty( "clusteringCriteriaName", clusteringCriteriaName );
-        plot->setProperty( "clusteringName", clusteringName );
-        connect( plot, SIGNAL(afterReplot()), this, SLOT(processCudaEventSnapshot()) );
-        QCPAxisRect* axisRect = plot->axisRect();
-        if ( axisRect ) {
-            axisRect->setAutoMargins( QCP::msNone );
-            axisRect->setMargins( QMargins(0,0,0,0) );
-            QCPAxis* xAxis = axisRect->axis( QCPAxis::atBottom );
-            QCPAxis* yAxis = axisRect->axis( QCPAxis::atLeft );
-            if ( xAxis ) xAxis->setVisible( false );
-            if ( yAxis ) yAxis->setVisible( false );
-        }
-        m_plot.insert( clusteringName, plot );
+    Q_UNUSED( clusteringCriteriaName )
+
+    if ( ! m_rasterizer.contains( clusteringName ) ) {
+        m_rasterizer.insert( clusteringName, new CudaEventRasterizer );
     }
 }
 
@@ -35,8 +35,8 @@
 #include <ArgoNavis/CUDA/PerformanceData.hpp>
 
 #include "UserGraphRangeChangeManager.h"
-
-class CustomPlot;
+#include "CudaEventTileCache.h"
+#include "CudaEventRasterizer.h"
 
 
 namespace ArgoNavis { namespace GUI {
@@ -61,7 +61,7 @@ signals:
 
     void signalProcessCudaEventView();
     void signalCudaEventSnapshot(const QString& clusteringCriteriaName, const QString& clusteringName, double lower, double upper, const QImage& image);
-    void createPlotForClustering(const QString& clusteringCriteriaName, const QString& clusteringName);
+    void createRasterizerForClustering(const QString& clusteringCriteriaName, const QString& clusteringName);
 
 public slots:
 
@@ -69,24 +69,39 @@ public slots:
 
 private slots:
 
-    void processDataTransferEvent(const QString& clusteringName,
-                                  const Base::Time &time_origin,
-                                  const CUDA::DataTransfer &details);
-    void processKernelExecutionEvent(const QString& clusteringName,
-                                     const Base::Time &time_origin,
-                                     const CUDA::KernelExecution &details);
+    void processCudaEvents(const QString& clusteringName, const CudaEventSpansPtr& events);
     void handleProcessCudaEventViewDone();
-    void handleCreatePlotForClustering(const QString& clusteringCriteriaName, const QString& clusteringName);
-    void processCudaEventSnapshot();
+    void handleCreateRasterizerForClustering(const QString& clusteringCriteriaName, const QString& clusteringName);
     void handleGraphRangeChangedTimeout(const QString& clusteringCriteriaName, const QString& clusterName, double lower, double upper, const QSize& size);
+    void processPendingTiles();
 
 private:
 
-    void processCudaEventSnapshot(CustomPlot* plot);
+    struct SnapshotRequest {
+        QString clusteringCriteriaName;
+        double lower;
+        double upper;
+        int level;                  // zoom level of the exact tiles
+        int height;                 // height of the CUDA event strip
+        bool complete;              // exact snapshot has been emitted
+        bool waiting;               // waiting operation has been started for the request
+    };
+
+    bool updateRequest(const QString& clusteringCriteriaName, const QString& clusterName, double lower, double upper, const QSize& size);
+    void processCudaEventSnapshot(const QString& clusterName);
+    bool emitCudaEventSnapshot(const QString& clusterName, const SnapshotRequest& request, int level);
+    void emitCoarseSnapshot(const QString& clusterName, const SnapshotRequest& request, int width);
+    QImage renderTile(const CudaEventRasterizer* rasterizer, int level, qint64 index, const SnapshotRequest& request) const;
+    void schedulePendingTiles();
+    void finishRequest(SnapshotRequest& request);
 
 private:
 
-    QMap< QString, CustomPlot* > m_plot;
+    QMap< QString, CudaEventRasterizer* > m_rasterizer;
+
+    QMap< QString, SnapshotRequest > m_requests;    // latest snapshot request for each cluster
+    CudaEventTileCache m_tiles;
+    bool m_pendingTilesScheduled;
 
     QThread m_thread;
 
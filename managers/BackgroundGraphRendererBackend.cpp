@@ -69,38 +69,62 @@ BackgroundGraphRendererBackend::~BackgroundGraphRendererBackend()
 
 /**
  * @brief BackgroundGraphRenderer::processDataTransferEvent
- * @param clusterName - the cluster group name
+ * @param events - the event arrays of the thread being visited
  * @param time_origin - the time origin of the experiment
  * @param details - the details of the data transfer event
  *
- * Emit a signal so a handler in the GUI thread can generate the data transfer graph item from the details.
+ * Append the data transfer event to the event arrays of the thread.
  */
-bool BackgroundGraphRendererBackend::processDataTransferEvent(const QString& clusteringName,
+bool BackgroundGraphRendererBackend::processDataTransferEvent(CudaEventSpans* events,
                                                               const Base::Time &time_origin,
                                                               const CUDA::DataTransfer &details)
 {
-    emit addDataTransfer( clusteringName, time_origin, details );
+    addEvent( events, CudaEventRasterizer::DataTransfer, time_origin, details.time_begin, details.time_end );
 
     return true; // continue the visitation
 }
 
 /**
  * @brief BackgroundGraphRenderer::processKernelExecutionEvent
- * @param clusteringName - the cluster group name
+ * @param events - the event arrays of the thread being visited
  * @param time_origin - the time origin of the experiment
  * @param details - the details of the kernel execution event
  *
- * Emit a signal so a handler in the GUI thread can generate the kernel execution graph item from the details.
+ * Append the kernel execution event to the event arrays of the thread.
  */
-bool BackgroundGraphRendererBackend::processKernelExecutionEvent(const QString& clusteringName,
+bool BackgroundGraphRendererBackend::processKernelExecutionEvent(CudaEventSpans* events,
                                                                  const Base::Time &time_origin,
                                                                  const CUDA::KernelExecution &details)
 {
-    emit addKernelExecution( clusteringName, time_origin, details );
+    addEvent( events, CudaEventRasterizer::KernelExecution, time_origin, details.time_begin, details.time_end );
 
     return true; // continue the visitation
 }
 
+/**
+ * @brief BackgroundGraphRendererBackend::addEvent
+ * @param events - the event arrays of the thread being visited
+ * @param kind - the kind of event
+ * @param time_origin - the time origin of the experiment
+ * @param time_begin - the begin time of the event
+ * @param time_end - the end time of the event
+ *
+ * Append the event converted to timeline units (milliseconds from the time origin).  Only the arrays of the kind are
+ * modified so the data transfer and kernel execution visitations of a thread can run concurrently.
+ */
+void BackgroundGraphRendererBackend::addEvent(CudaEventSpans *events, CudaEventRasterizer::EventKind kind, const Base::Time &time_origin, const Base::Time &time_begin, const Base::Time &time_end)
+{
+    double timeBegin = static_cast<uint64_t>( time_begin - time_origin ) / 1000000.0;
+    double timeEnd = static_cast<uint64_t>( time_end - time_origin ) / 1000000.0;
+#if defined(USE_DISCRETE_SAMPLES)
+    timeBegin /= 10.0;
+    timeEnd /= 10.0;
+#endif
+
+    events->begin[ kind ] << timeBegin;
+    events->end[ kind ] << qMax( timeBegin, timeEnd );
+}
+
 /**
  * @brief BackgroundGraphRenderer::handleProcessCudaEventView
  *
@@ -164,21 +188,26 @@ bool BackgroundGraphRendererBackend::processThreadCudaEvents(const Base::ThreadN
         cursorManager->startWaitingOperation( QStringLiteral("backend-cuda-events-")+clusterName );
     }
 
+    QSharedPointer< CudaEventSpans > events( new CudaEventSpans );
+
     // concurrently initiate visitations of the CUDA data transfer and kernel execution events
     QFutureSynchronizer<void> synchronizer;
     QFuture<void> future1 = QtConcurrent::run( &m_data, &CUDA::PerformanceData::visitDataTransfers, thread, m_data.interval(),
                                                boost::bind( &BackgroundGraphRendererBackend::processDataTransferEvent, this,
-                                                            boost::cref(clusterName), boost::cref(m_data.interval().begin()), _1 ) );
+                                                            events.data(), boost::cref(m_data.interval().begin()), _1 ) );
     synchronizer.addFuture( future1 );
 
     QFuture<void> future2 = QtConcurrent::run( &m_data, &CUDA::PerformanceData::visitKernelExecutions, thread, m_data.interval(),
                                                boost::bind( &BackgroundGraphRendererBackend::processKernelExecutionEvent, this,
-                                                            boost::cref(clusterName), boost::cref(m_data.interval().begin()), _1 ) );
+                                                            events.data(), boost::cref(m_data.interval().begin()), _1 ) );
     synchronizer.addFuture( future2 );
 
     // wait for the visitations to complete
     synchronizer.waitForFinished();
 
+    // hand the event arrays of the thread to the renderer in a single message
+    emit addCudaEvents( clusterName, events );
+
 #ifdef HAS_CONCURRENT_PROCESSING_VIEW_DEBUG
     qDebug() << "BackgroundGraphRendererBackend::processThreadCudaEvents: DONE: clusterName=" << clusterName;
 #endif
@@ -31,7 +31,7 @@
 #include <ArgoNavis/CUDA/DataTransfer.hpp>
 #include <ArgoNavis/CUDA/KernelExecution.hpp>
 
-class QCustomPlot;
+#include "CudaEventRasterizer.h"
 
 
 namespace ArgoNavis { namespace GUI {
@@ -51,15 +51,7 @@ signals:
     void signalProcessCudaEventViewStart();
     void signalProcessCudaEventViewDone();
 
-    void addDataTransfer(const QString& clusteringName,
-                         const Base::Time &time_origin,
-                         const CUDA::DataTransfer &details,
-                         bool last = false);
-
-    void addKernelExecution(const QString& clusteringName,
-                            const Base::Time& time_origin,
-                            const CUDA::KernelExecution& details,
-                            bool last = false);
+    void addCudaEvents(const QString& clusteringName, const CudaEventSpansPtr& events);
 
 private slots:
 
@@ -69,8 +61,10 @@ private slots:
 private:
 
     bool processThreadCudaEvents(const Base::ThreadName& thread);
-    bool processDataTransferEvent(const QString& clusteringName, const Base::Time &time_origin, const CUDA::DataTransfer &details);
-    bool processKernelExecutionEvent(const QString& clusteringName, const Base::Time &time_origin, const CUDA::KernelExecution &details);
+    bool processDataTransferEvent(CudaEventSpans* events, const Base::Time &time_origin, const CUDA::DataTransfer &details);
+    bool processKernelExecutionEvent(CudaEventSpans* events, const Base::Time &time_origin, const CUDA::KernelExecution &details);
+
+    static void addEvent(CudaEventSpans* events, CudaEventRasterizer::EventKind kind, const Base::Time& time_origin, const Base::Time& time_begin, const Base::Time& time_end);
 
 private:
 
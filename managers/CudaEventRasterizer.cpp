@@ -0,0 +1,368 @@
+/*!
+   \file CudaEventRasterizer.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "CudaEventRasterizer.h"
+
+#include <QThread>
+#include <QtConcurrentRun>
+#include <QFutureSynchronizer>
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+// minimum number of pixel columns rasterized by one task
+const int MIN_TASK_COLUMNS = 1024;
+
+// minimum coverage of a pixel column touched by an event so that short events remain visible
+const float MIN_COVERAGE = 0.25f;
+
+
+/**
+ * @brief CudaEventRasterizer::CudaEventRasterizer
+ *
+ * Constructs a CudaEventRasterizer instance without events.
+ */
+CudaEventRasterizer::CudaEventRasterizer()
+{
+    for ( int kind = 0; kind < EventKindCount; ++kind ) {
+        m_spans[ kind ].sorted = true;
+        m_spans[ kind ].prepared = true;
+    }
+}
+
+/**
+ * @brief CudaEventRasterizer::~CudaEventRasterizer
+ *
+ * Destroys the CudaEventRasterizer instance.
+ */
+CudaEventRasterizer::~CudaEventRasterizer()
+{
+
+}
+
+/**
+ * @brief CudaEventRasterizer::addEvent
+ * @param kind - the kind of event
+ * @param timeBegin - the begin time of the event
+ * @param timeEnd - the end time of the event
+ *
+ * Appends the event.  Events may be added in any order; the merged intervals are rebuilt before the next rasterization.
+ */
+void CudaEventRasterizer::addEvent(EventKind kind, double timeBegin, double timeEnd)
+{
+    Spans& spans = m_spans[ kind ];
+
+    if ( spans.sorted && ! spans.begin.isEmpty() && timeBegin < spans.begin.last() )
+        spans.sorted = false;
+
+    spans.begin << timeBegin;
+    spans.end << qMax( timeBegin, timeEnd );
+    spans.prepared = false;
+}
+
+/**
+ * @brief CudaEventRasterizer::addEvents
+ * @param events - the events of one thread
+ *
+ * Appends the events of each kind.  When no events of a kind were added yet the arrays are shared rather than copied.
+ */
+void CudaEventRasterizer::addEvents(const CudaEventSpans &events)
+{
+    for ( int kind = 0; kind < EventKindCount; ++kind ) {
+        const QVector< double >& begin = events.begin[ kind ];
+        const QVector< double >& end = events.end[ kind ];
+
+        if ( begin.isEmpty() )
+            continue;
+
+        Spans& spans = m_spans[ kind ];
+
+        const bool ordered = std::is_sorted( begin.constBegin(), begin.constEnd() );
+
+        if ( spans.begin.isEmpty() ) {
+            spans.begin = begin;
+            spans.end = end;
+            spans.sorted = ordered;
+        }
+        else {
+            spans.sorted = spans.sorted && ordered && spans.begin.last() <= begin.first();
+            spans.begin += begin;
+            spans.end += end;
+        }
+
+        spans.prepared = false;
+    }
+}
+
+/**
+ * @brief CudaEventRasterizer::clear
+ *
+ * Removes all events.
+ */
+void CudaEventRasterizer::clear()
+{
+    for ( int kind = 0; kind < EventKindCount; ++kind ) {
+        Spans& spans = m_spans[ kind ];
+        spans.begin.clear();
+        spans.end.clear();
+        spans.unionBegin.clear();
+        spans.unionEnd.clear();
+        spans.covered.clear();
+        spans.sorted = true;
+        spans.prepared = true;
+    }
+}
+
+/**
+ * @brief CudaEventRasterizer::eventCount
+ * @return - the number of events of all kinds
+ */
+int CudaEventRasterizer::eventCount() const
+{
+    int count( 0 );
+
+    for ( int kind = 0; kind < EventKindCount; ++kind ) {
+        count += m_spans[ kind ].begin.size();
+    }
+
+    return count;
+}
+
+/**
+ * @brief CudaEventRasterizer::rasterize
+ * @param image - the image receiving the strip (must have format QImage::Format_ARGB32_Premultiplied)
+ * @param lower - the time at the left edge of the image
+ * @param upper - the time at the right edge of the image
+ *
+ * Rasterizes the events in the range [lower..upper] into the image.  The events span the full height of the strip so
+ * the first scanline is computed and copied to the remaining scanlines.
+ */
+void CudaEventRasterizer::rasterize(QImage &image, double lower, double upper) const
+{
+    Q_ASSERT( image.format() == QImage::Format_ARGB32_Premultiplied );
+
+    if ( image.isNull() || lower >= upper )
+        return;
+
+    prepare();
+
+    const int width = image.width();
+    const double scale = width / ( upper - lower );
+
+    QRgb* line = reinterpret_cast< QRgb* >( image.scanLine( 0 ) );
+
+    const int taskCount = qBound( 1, width / MIN_TASK_COLUMNS, QThread::idealThreadCount() );
+
+    if ( 1 == taskCount ) {
+        rasterizeColumns( line, lower, scale, 0, width - 1 );
+    }
+    else {
+        // each task writes a disjoint range of pixel columns of the first scanline
+        QFutureSynchronizer<void> synchronizer;
+
+        for ( int task = 0; task < taskCount; ++task ) {
+            const int first = width * task / taskCount;
+            const int last = width * ( task + 1 ) / taskCount - 1;
+            synchronizer.addFuture( QtConcurrent::run( this, &CudaEventRasterizer::rasterizeColumns, line, lower, scale, first, last ) );
+        }
+
+        synchronizer.waitForFinished();
+    }
+
+    for ( int y = 1; y < image.height(); ++y ) {
+        std::memcpy( image.scanLine( y ), line, width * sizeof( QRgb ) );
+    }
+}
+
+/**
+ * @brief CudaEventRasterizer::getColor
+ * @param kind - the kind of event
+ * @return - the color used for events of the kind
+ */
+QColor CudaEventRasterizer::getColor(EventKind kind)
+{
+    if ( KernelExecution == kind )
+        return QColor( 0xaf, 0xdb, 0xaf );
+
+    return QColor( 0xff, 0xbf, 0xbf );
+}
+
+/**
+ * @brief CudaEventRasterizer::prepare
+ *
+ * Sorts the events of each kind by begin time (if they were not added in order) and merges overlapping events into
+ * disjoint intervals along with the prefix sum of the interval lengths.
+ */
+void CudaEventRasterizer::prepare() const
+{
+    for ( int kind = 0; kind < EventKindCount; ++kind ) {
+        Spans& spans = m_spans[ kind ];
+
+        if ( spans.prepared )
+            continue;
+
+        const int count = spans.begin.size();
+
+        if ( ! spans.sorted ) {
+            QVector< int > order( count );
+            for ( int i = 0; i < count; ++i ) {
+                order[ i ] = i;
+            }
+
+            const QVector< double >& begin = spans.begin;
+            std::sort( order.begin(), order.end(), [&begin](int a, int b) { return begin[ a ] < begin[ b ]; } );
+
+            QVector< double > sortedBegin( count );
+            QVector< double > sortedEnd( count );
+
+            for ( int i = 0; i < count; ++i ) {
+                sortedBegin[ i ] = spans.begin[ order[ i ] ];
+                sortedEnd[ i ] = spans.end[ order[ i ] ];
+            }
+
+            spans.begin.swap( sortedBegin );
+            spans.end.swap( sortedEnd );
+            spans.sorted = true;
+        }
+
+        spans.unionBegin.clear();
+        spans.unionEnd.clear();
+        spans.covered.clear();
+
+        for ( int i = 0; i < count; ++i ) {
+            if ( ! spans.unionEnd.isEmpty() && spans.begin[ i ] <= spans.unionEnd.last() ) {
+                spans.unionEnd.last() = qMax( spans.unionEnd.last(), spans.end[ i ] );
+            }
+            else {
+                spans.unionBegin << spans.begin[ i ];
+                spans.unionEnd << spans.end[ i ];
+            }
+        }
+
+        double covered( 0.0 );
+
+        spans.covered.reserve( spans.unionBegin.size() );
+
+        for ( int k = 0; k < spans.unionBegin.size(); ++k ) {
+            spans.covered << covered;
+            covered += spans.unionEnd[ k ] - spans.unionBegin[ k ];
+        }
+
+        spans.prepared = true;
+    }
+}
+
+/**
+ * @brief CudaEventRasterizer::rasterizeColumns
+ * @param line - the first scanline of the image
+ * @param lower - the time at the left edge of the image
+ * @param scale - the number of pixel columns per time unit
+ * @param first - the first pixel column to rasterize
+ * @param last - the last pixel column to rasterize
+ *
+ * Computes the coverage of the pixel columns [first..last] for each kind of event and writes the blended colors.
+ */
+void CudaEventRasterizer::rasterizeColumns(QRgb *line, double lower, double scale, int first, int last) const
+{
+    const int n = last - first + 1;
+
+    if ( n <= 0 )
+        return;
+
+    QVector< float > transfers( n );
+    QVector< float > kernels( n );
+
+    getCoverage( m_spans[ DataTransfer ], lower, scale, first, last, transfers.data() );
+    getCoverage( m_spans[ KernelExecution ], lower, scale, first, last, kernels.data() );
+
+    const QColor transferColor = getColor( DataTransfer );
+    const QColor kernelColor = getColor( KernelExecution );
+
+    const float tr( transferColor.red() ), tg( transferColor.green() ), tb( transferColor.blue() );
+    const float kr( kernelColor.red() ), kg( kernelColor.green() ), kb( kernelColor.blue() );
+
+    const float* transferCoverage = transfers.constData();
+    const float* kernelCoverage = kernels.constData();
+    QRgb* pixels = line + first;
+
+    // premultiplied colors with kernel executions composed over data transfers
+    for ( int c = 0; c < n; ++c ) {
+        const float ak = qMin( kernelCoverage[ c ], 1.0f );
+        const float at = qMin( transferCoverage[ c ], 1.0f ) * ( 1.0f - ak );
+        pixels[ c ] = qRgba( int( kr * ak + tr * at + 0.5f ),
+                             int( kg * ak + tg * at + 0.5f ),
+                             int( kb * ak + tb * at + 0.5f ),
+                             int( 255.0f * ( ak + at ) + 0.5f ) );
+    }
+}
+
+/**
+ * @brief CudaEventRasterizer::getCoverage
+ * @param spans - the prepared event intervals
+ * @param lower - the time at the left edge of the image
+ * @param scale - the number of pixel columns per time unit
+ * @param first - the first pixel column
+ * @param last - the last pixel column
+ * @param coverage - the fraction of each pixel column [first..last] covered by the events
+ *
+ * The covered time up to each column edge is the prefix sum of the merged intervals beginning before the edge plus the
+ * part of the last such interval before the edge.  A column in which an interval begins is covered at least MIN_COVERAGE.
+ */
+void CudaEventRasterizer::getCoverage(const Spans &spans, double lower, double scale, int first, int last, float *coverage)
+{
+    const int n = last - first + 1;
+    const int count = spans.unionBegin.size();
+
+    const double* unionBegin = spans.unionBegin.constData();
+    const double* unionEnd = spans.unionEnd.constData();
+    const double* covered = spans.covered.constData();
+
+    double previousCovered( 0.0 );
+    int previousStarted( 0 );
+
+    for ( int c = -1; c < n; ++c ) {
+        const double t = lower + ( first + c + 1 ) / scale;
+
+        // number of intervals beginning before the column edge
+        const int started = std::lower_bound( unionBegin, unionBegin + count, t ) - unionBegin;
+        const double coveredAtEdge = ( 0 == started ) ? 0.0 : covered[ started - 1 ] + qMin( t, unionEnd[ started - 1 ] ) - unionBegin[ started - 1 ];
+
+        if ( c >= 0 ) {
+            float fraction = float( ( coveredAtEdge - previousCovered ) * scale );
+            if ( fraction > 0.0f || started > previousStarted )
+                fraction = qMax( fraction, MIN_COVERAGE );
+            coverage[ c ] = fraction;
+        }
+
+        previousCovered = coveredAtEdge;
+        previousStarted = started;
+    }
+}
+
+
+} // GUI
+} // ArgoNavis
@@ -0,0 +1,120 @@
+/*!
+   \file CudaEventRasterizer.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CUDAEVENTRASTERIZER_H
+#define CUDAEVENTRASTERIZER_H
+
+#include <QVector>
+#include <QImage>
+#include <QColor>
+#include <QSharedPointer>
+#include <QMetaType>
+
+#include "common/openss-gui-config.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+struct CudaEventSpans;
+
+
+/*!
+ * \brief The CudaEventRasterizer class
+ *
+ * Rasterizes the CUDA data transfer and kernel execution events of one cluster into an image strip.  Before rasterizing,
+ * the events of each kind are sorted by begin time and merged into disjoint intervals together with the prefix sum of
+ * the interval lengths.  The time covered by events within a pixel column is then the difference of the covered time
+ * at the column edges, each found by binary search, so the cost depends on the image width and not on the number of
+ * events.  Each pixel column is shaded with the fraction covered by events of each kind (kernel executions over data
+ * transfers).  Wide images are rasterized concurrently by pixel column range.
+ */
+
+class CudaEventRasterizer
+{
+public:
+
+    enum EventKind {
+        DataTransfer = 0,
+        KernelExecution,
+        EventKindCount
+    };
+
+    explicit CudaEventRasterizer();
+    virtual ~CudaEventRasterizer();
+
+    void addEvent(EventKind kind, double timeBegin, double timeEnd);
+    void addEvents(const CudaEventSpans& events);
+    void clear();
+
+    int eventCount() const;
+
+    void rasterize(QImage& image, double lower, double upper) const;
+
+    static QColor getColor(EventKind kind);
+
+private:
+
+    struct Spans {
+        QVector< double > begin;        // begin times in the order added
+        QVector< double > end;          // end times in the order added
+        QVector< double > unionBegin;   // begin times of the disjoint merged intervals
+        QVector< double > unionEnd;     // end times of the disjoint merged intervals
+        QVector< double > covered;      // total length of the merged intervals preceding each interval
+        bool sorted;                    // events were added in begin time order
+        bool prepared;                  // merged intervals reflect all events
+    };
+
+    void prepare() const;
+    void rasterizeColumns(QRgb* line, double lower, double scale, int first, int last) const;
+
+    static void getCoverage(const Spans& spans, double lower, double scale, int first, int last, float* coverage);
+
+    mutable Spans m_spans[ EventKindCount ];
+
+};
+
+
+/*!
+ * \brief The CudaEventSpans struct
+ *
+ * The begin and end times (in timeline units) of the CUDA events of one thread for each kind of event.  The backend
+ * fills one instance per thread and hands it to the renderer as a shared pointer to const, so the arrays are neither
+ * copied by the queued signal nor modified once published.
+ */
+
+struct CudaEventSpans {
+    QVector< double > begin[ CudaEventRasterizer::EventKindCount ];
+    QVector< double > end[ CudaEventRasterizer::EventKindCount ];
+};
+
+typedef QSharedPointer< const CudaEventSpans > CudaEventSpansPtr;
+
+
+} // GUI
+} // ArgoNavis
+
+Q_DECLARE_METATYPE( ArgoNavis::GUI::CudaEventSpansPtr )
+
+
+#endif // CUDAEVENTRASTERIZER_H
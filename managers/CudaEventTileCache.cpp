@@ -0,0 +1,198 @@
+/*!
+   \file CudaEventTileCache.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "CudaEventTileCache.h"
+
+#include <QPainter>
+
+#include <qmath.h>
+
+#include <cmath>
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/**
+ * @brief qHash
+ * @param key - the tile key
+ * @return - the hash value of the tile key
+ */
+uint qHash(const CudaEventTileCache::TileKey& key)
+{
+    return ::qHash( key.clusterName ) ^ ::qHash( key.index ) ^ ( uint( key.level ) * 2654435761U );
+}
+
+/**
+ * @brief CudaEventTileCache::CudaEventTileCache
+ * @param maxBytes - the memory budget for the cached tiles
+ *
+ * Constructs an empty CudaEventTileCache instance.
+ */
+CudaEventTileCache::CudaEventTileCache(int maxBytes)
+    : m_tiles( maxBytes )
+{
+
+}
+
+/**
+ * @brief CudaEventTileCache::~CudaEventTileCache
+ *
+ * Destroys the CudaEventTileCache instance.
+ */
+CudaEventTileCache::~CudaEventTileCache()
+{
+
+}
+
+/**
+ * @brief CudaEventTileCache::getZoomLevel
+ * @param lower - the lower value of the view range
+ * @param upper - the upper value of the view range
+ * @param width - the width of the view in pixels
+ * @return - the finest zoom level whose pixel span is at least the pixel span of the view
+ */
+int CudaEventTileCache::getZoomLevel(double lower, double upper, int width)
+{
+    const double pixelSpan = ( upper - lower ) / qMax( 1, width );
+
+    return qFloor( std::log( pixelSpan ) / std::log( 2.0 ) );
+}
+
+/**
+ * @brief CudaEventTileCache::getTileSpan
+ * @param level - the zoom level
+ * @return - the time span of one tile of the zoom level
+ */
+double CudaEventTileCache::getTileSpan(int level)
+{
+    return TILE_WIDTH * std::ldexp( 1.0, level );
+}
+
+/**
+ * @brief CudaEventTileCache::getTileIndex
+ * @param level - the zoom level
+ * @param time - the time value
+ * @return - the index of the tile of the zoom level containing the time value
+ */
+qint64 CudaEventTileCache::getTileIndex(int level, double time)
+{
+    return qint64( std::floor( time / getTileSpan( level ) ) );
+}
+
+/**
+ * @brief CudaEventTileCache::contains
+ * @param clusterName - the cluster name
+ * @param level - the zoom level
+ * @param index - the tile index
+ * @param height - the strip height in pixels
+ * @return - indicates whether the tile is cached with the requested height
+ */
+bool CudaEventTileCache::contains(const QString &clusterName, int level, qint64 index, int height) const
+{
+    const TileKey key = { clusterName, level, index };
+
+    const QImage* tile = m_tiles.object( key );
+
+    return tile && tile->height() == height;
+}
+
+/**
+ * @brief CudaEventTileCache::insert
+ * @param clusterName - the cluster name
+ * @param level - the zoom level
+ * @param index - the tile index
+ * @param tile - the rasterized tile
+ *
+ * Insert the tile into the cache replacing any previous tile with the same key.  Least recently used tiles are discarded as needed to stay within the budget.
+ */
+void CudaEventTileCache::insert(const QString &clusterName, int level, qint64 index, const QImage &tile)
+{
+    const TileKey key = { clusterName, level, index };
+
+    m_tiles.insert( key, new QImage( tile ), tile.bytesPerLine() * tile.height() );
+}
+
+/**
+ * @brief CudaEventTileCache::compose
+ * @param clusterName - the cluster name
+ * @param level - the zoom level
+ * @param first - the index of the first tile
+ * @param last - the index of the last tile
+ * @param height - the strip height in pixels
+ * @param image - the composed strip covering the tiles [first..last]
+ * @return - indicates whether all tiles were cached and the strip was composed
+ */
+bool CudaEventTileCache::compose(const QString &clusterName, int level, qint64 first, qint64 last, int height, QImage &image)
+{
+    QVector< QImage* > tiles;
+
+    tiles.reserve( last - first + 1 );
+
+    for ( qint64 index = first; index <= last; ++index ) {
+        const TileKey key = { clusterName, level, index };
+        QImage* tile = m_tiles.object( key );
+        if ( Q_NULLPTR == tile || tile->height() != height )
+            return false;
+        tiles << tile;
+    }
+
+    image = QImage( tiles.size() * TILE_WIDTH, height, QImage::Format_ARGB32_Premultiplied );
+
+    QPainter painter( &image );
+    painter.setCompositionMode( QPainter::CompositionMode_Source );
+
+    for ( int i = 0; i < tiles.size(); ++i ) {
+        painter.drawImage( i * TILE_WIDTH, 0, *tiles[ i ] );
+    }
+
+    return true;
+}
+
+/**
+ * @brief CudaEventTileCache::remove
+ * @param clusterName - the cluster name
+ *
+ * Discard all tiles of the cluster.
+ */
+void CudaEventTileCache::remove(const QString &clusterName)
+{
+    foreach ( const TileKey& key, m_tiles.keys() ) {
+        if ( key.clusterName == clusterName )
+            m_tiles.remove( key );
+    }
+}
+
+/**
+ * @brief CudaEventTileCache::clear
+ *
+ * Discard all tiles.
+ */
+void CudaEventTileCache::clear()
+{
+    m_tiles.clear();
+}
+
+
+} // GUI
+} // ArgoNavis
@@ -0,0 +1,90 @@
+/*!
+   \file CudaEventTileCache.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CUDAEVENTTILECACHE_H
+#define CUDAEVENTTILECACHE_H
+
+#include <QString>
+#include <QImage>
+#include <QCache>
+#include <QHash>
+
+#include "common/openss-gui-config.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/*!
+ * \brief The CudaEventTileCache class
+ *
+ * Cache of pre-rasterized CUDA event strip tiles.  The time axis is divided into zoom levels where one pixel of level N
+ * spans 2^N time units, and each level is divided into tiles of TILE_WIDTH pixels.  A tile is identified by cluster name,
+ * zoom level and tile index.  The least recently used tiles are discarded once the memory used by the tiles exceeds the
+ * budget.  The strip for a view range is composed from the tiles of the level whose pixel span does not exceed the pixel
+ * span of the view, so the composed image has at least the resolution of the view.
+ */
+
+class CudaEventTileCache
+{
+public:
+
+    static const int TILE_WIDTH = 256;
+
+    explicit CudaEventTileCache(int maxBytes = 64 * 1024 * 1024);
+    virtual ~CudaEventTileCache();
+
+    static int getZoomLevel(double lower, double upper, int width);
+    static double getTileSpan(int level);
+    static qint64 getTileIndex(int level, double time);
+
+    bool contains(const QString& clusterName, int level, qint64 index, int height) const;
+    void insert(const QString& clusterName, int level, qint64 index, const QImage& tile);
+    bool compose(const QString& clusterName, int level, qint64 first, qint64 last, int height, QImage& image);
+
+    void remove(const QString& clusterName);
+    void clear();
+
+private:
+
+    struct TileKey {
+        QString clusterName;
+        int level;
+        qint64 index;
+
+        bool operator==(const TileKey& other) const {
+            return level == other.level && index == other.index && clusterName == other.clusterName;
+        }
+    };
+
+    friend uint qHash(const TileKey& key);
+
+    QCache< TileKey, QImage > m_tiles;          // cost of each tile is its size in bytes
+
+};
+
+
+} // GUI
+} // ArgoNavis
+
+#endif // CUDAEVENTTILECACHE_H
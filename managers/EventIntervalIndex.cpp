@@ -0,0 +1,299 @@
+/*!
+   \file EventIntervalIndex.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "EventIntervalIndex.h"
+
+#include <algorithm>
+#include <limits>
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+// the number of sorted events summarized by each leaf of the max-end tree
+const int BLOCK_SIZE = 32;
+
+
+/**
+ * @brief EventIntervalIndex::EventIntervalIndex
+ *
+ * Constructs an empty EventIntervalIndex instance.
+ */
+EventIntervalIndex::EventIntervalIndex()
+{
+
+}
+
+/**
+ * @brief EventIntervalIndex::~EventIntervalIndex
+ *
+ * Destroys the EventIntervalIndex instance.
+ */
+EventIntervalIndex::~EventIntervalIndex()
+{
+
+}
+
+/**
+ * @brief EventIntervalIndex::build
+ * @param begin - the begin time of each event
+ * @param end - the end time of each event
+ * @param keys - the key of each event (optional)
+ *
+ * Build the index for the specified events replacing any previous content.  The id of an event is its position in the
+ * specified vectors.  Events having the same begin time keep their relative order.
+ */
+void EventIntervalIndex::build(const QVector<double> &begin, const QVector<double> &end, const QVector<int> &keys)
+{
+    clear();
+
+    const int count = qMin( begin.size(), end.size() );
+
+    m_ids.resize( count );
+    for ( int i=0; i<count; ++i ) {
+        m_ids[i] = i;
+    }
+
+    // the events are usually already in begin time order
+    if ( ! std::is_sorted( begin.constBegin(), begin.constBegin() + count ) ) {
+        std::stable_sort( m_ids.begin(), m_ids.end(), [&begin](int a, int b) { return begin[a] < begin[b]; } );
+    }
+
+    m_begin.resize( count );
+    m_end.resize( count );
+    for ( int i=0; i<count; ++i ) {
+        m_begin[i] = begin[ m_ids[i] ];
+        m_end[i] = end[ m_ids[i] ];
+    }
+
+    buildTree( m_all );
+
+    if ( keys.size() >= count ) {
+        for ( int i=0; i<count; ++i ) {
+            m_keys[ keys[ m_ids[i] ] ].positions << i;
+        }
+
+        for ( QHash< int, Partition >::iterator iter = m_keys.begin(); iter != m_keys.end(); ++iter ) {
+            buildTree( iter.value() );
+        }
+    }
+}
+
+/**
+ * @brief EventIntervalIndex::clear
+ *
+ * Remove all events from the index.
+ */
+void EventIntervalIndex::clear()
+{
+    m_ids.clear();
+    m_begin.clear();
+    m_end.clear();
+    m_all = Partition();
+    m_keys.clear();
+}
+
+/**
+ * @brief EventIntervalIndex::size
+ * @return - the number of events in the index
+ */
+int EventIntervalIndex::size() const
+{
+    return m_ids.size();
+}
+
+/**
+ * @brief EventIntervalIndex::isEmpty
+ * @return - whether the index has no events
+ */
+bool EventIntervalIndex::isEmpty() const
+{
+    return m_ids.isEmpty();
+}
+
+/**
+ * @brief EventIntervalIndex::findOverlapping
+ * @param lower - the lower bound of the time window
+ * @param upper - the upper bound of the time window
+ * @return - the ids of the events overlapping the time window sorted by begin time
+ *
+ * An event overlaps the time window when it begins no later than the upper bound and ends no earlier than the lower bound.
+ */
+QVector<int> EventIntervalIndex::findOverlapping(double lower, double upper) const
+{
+    QVector< int > result;
+
+    findOverlapping( m_all, lower, upper, result );
+
+    return result;
+}
+
+/**
+ * @brief EventIntervalIndex::findOverlapping
+ * @param key - the key of the events
+ * @param lower - the lower bound of the time window
+ * @param upper - the upper bound of the time window
+ * @return - the ids of the events having the key and overlapping the time window sorted by begin time
+ */
+QVector<int> EventIntervalIndex::findOverlapping(int key, double lower, double upper) const
+{
+    QVector< int > result;
+
+    QHash< int, Partition >::const_iterator iter = m_keys.constFind( key );
+
+    if ( iter != m_keys.constEnd() )
+        findOverlapping( iter.value(), lower, upper, result );
+
+    return result;
+}
+
+/**
+ * @brief EventIntervalIndex::countBeginning
+ * @param key - the key of the events
+ * @param lower - the lower bound of the time window
+ * @param upper - the upper bound of the time window
+ * @return - the number of events having the key and beginning within the time window
+ *
+ * The count is found by two binary searches without visiting the events, so it is a cheap estimate of the event density.
+ */
+int EventIntervalIndex::countBeginning(int key, double lower, double upper) const
+{
+    QHash< int, Partition >::const_iterator iter = m_keys.constFind( key );
+
+    if ( iter == m_keys.constEnd() || lower > upper )
+        return 0;
+
+    const QVector< int >& positions = iter.value().positions;
+    const QVector< double >& begin = m_begin;
+
+    const int first = std::lower_bound( positions.constBegin(), positions.constEnd(), lower,
+                                        [&begin](int position, double time) { return begin[ position ] < time; } ) - positions.constBegin();
+    const int last = std::upper_bound( positions.constBegin(), positions.constEnd(), upper,
+                                       [&begin](double time, int position) { return time < begin[ position ]; } ) - positions.constBegin();
+
+    return last - first;
+}
+
+/**
+ * @brief EventIntervalIndex::buildTree
+ * @param partition - the partition for which to build the max-end tree
+ *
+ * The tree is stored as an array with the root at index 1 and the leaves at indexes [leafCount .. 2*leafCount).  Unused
+ * leaves hold the lowest possible time so that they are always skipped.
+ */
+void EventIntervalIndex::buildTree(Partition &partition) const
+{
+    const int count = partition.positions.isEmpty() ? m_ids.size() : partition.positions.size();
+    const int blockCount = ( count + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+
+    partition.leafCount = 1;
+    while ( partition.leafCount < blockCount ) {
+        partition.leafCount <<= 1;
+    }
+
+    partition.maxEnd.fill( -std::numeric_limits<double>::max(), 2 * partition.leafCount );
+
+    for ( int j=0; j<count; ++j ) {
+        const int position = partition.positions.isEmpty() ? j : partition.positions[j];
+        double& maxEnd = partition.maxEnd[ partition.leafCount + j / BLOCK_SIZE ];
+        maxEnd = qMax( maxEnd, m_end[ position ] );
+    }
+
+    for ( int node=partition.leafCount-1; node>0; --node ) {
+        partition.maxEnd[ node ] = qMax( partition.maxEnd[ 2 * node ], partition.maxEnd[ 2 * node + 1 ] );
+    }
+}
+
+/**
+ * @brief EventIntervalIndex::findOverlapping
+ * @param partition - the partition to search
+ * @param lower - the lower bound of the time window
+ * @param upper - the upper bound of the time window
+ * @param result - the ids of the overlapping events are appended in begin time order
+ *
+ * Binary search the number of partition events beginning no later than the upper bound.  Then descend the max-end tree
+ * left to right visiting only the blocks before that point having an event ending no earlier than the lower bound.
+ */
+void EventIntervalIndex::findOverlapping(const Partition &partition, double lower, double upper, QVector<int> &result) const
+{
+    const bool all = partition.positions.isEmpty();
+    const int count = all ? m_ids.size() : partition.positions.size();
+
+    if ( 0 == count || lower > upper )
+        return;
+
+    // find number of partition events beginning no later than the upper bound
+    int last( count );
+    if ( all ) {
+        last = std::upper_bound( m_begin.constBegin(), m_begin.constEnd(), upper ) - m_begin.constBegin();
+    }
+    else {
+        int low( 0 );
+        while ( low < last ) {
+            const int middle = low + ( last - low ) / 2;
+            if ( m_begin[ partition.positions[ middle ] ] <= upper )
+                low = middle + 1;
+            else
+                last = middle;
+        }
+    }
+
+    if ( 0 == last )
+        return;
+
+    const int lastBlock = ( last - 1 ) / BLOCK_SIZE;
+
+    // explicit stack of (node, first block, block count) for a left to right descent of the tree
+    QVector< int > stack;
+    stack << 1 << 0 << partition.leafCount;
+
+    while ( ! stack.isEmpty() ) {
+        const int size = stack.size();
+        const int node = stack[ size - 3 ];
+        const int firstBlock = stack[ size - 2 ];
+        const int blocks = stack[ size - 1 ];
+        stack.resize( size - 3 );
+
+        if ( firstBlock > lastBlock || partition.maxEnd[ node ] < lower )
+            continue;
+
+        if ( 1 == blocks ) {
+            const int endPosition = qMin( last, ( firstBlock + 1 ) * BLOCK_SIZE );
+            for ( int j=firstBlock*BLOCK_SIZE; j<endPosition; ++j ) {
+                const int position = all ? j : partition.positions[j];
+                if ( m_end[ position ] >= lower )
+                    result << m_ids[ position ];
+            }
+        }
+        else {
+            const int half = blocks / 2;
+            // push right child first so that the left child is visited first
+            stack << 2 * node + 1 << firstBlock + half << half;
+            stack << 2 * node << firstBlock << half;
+        }
+    }
+}
+
+
+} // GUI
+} // ArgoNavis
@@ -0,0 +1,90 @@
+/*!
+   \file EventIntervalIndex.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef EVENTINTERVALINDEX_H
+#define EVENTINTERVALINDEX_H
+
+#include <QVector>
+#include <QHash>
+
+#include "common/openss-gui-config.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/*!
+ * \brief The EventIntervalIndex class
+ *
+ * Index of a set of events having a begin and end time built once when the events are known.  The events are kept in
+ * arrays sorted by begin time.  The sorted events are grouped in fixed size blocks and a max-end tree over the blocks
+ * records the latest end time within each range of blocks.  The events overlapping a time window are found by a binary
+ * search for the last event beginning within the window followed by a descent of the tree that skips all blocks ending
+ * before the window.  Events may have an integer key (for example the rank) and an index of the events having each key
+ * is kept as well.  Results are the ids of the events in the order passed to build() sorted by begin time.
+ */
+
+class EventIntervalIndex
+{
+public:
+
+    explicit EventIntervalIndex();
+    virtual ~EventIntervalIndex();
+
+    void build(const QVector< double >& begin, const QVector< double >& end, const QVector< int >& keys = QVector< int >());
+    void clear();
+
+    int size() const;
+    bool isEmpty() const;
+
+    QVector< int > findOverlapping(double lower, double upper) const;
+    QVector< int > findOverlapping(int key, double lower, double upper) const;
+
+    int countBeginning(int key, double lower, double upper) const;
+
+private:
+
+    struct Partition {
+        Partition() : leafCount( 0 ) { }
+        QVector< int > positions;       // sorted positions of the partition events (empty for the partition of all events)
+        QVector< double > maxEnd;       // max-end tree: node i has children 2i and 2i+1, leaves are the blocks
+        int leafCount;
+    };
+
+    void buildTree(Partition& partition) const;
+    void findOverlapping(const Partition& partition, double lower, double upper, QVector< int >& result) const;
+
+    QVector< int > m_ids;               // id of the event at each sorted position
+    QVector< double > m_begin;          // begin time of the event at each sorted position
+    QVector< double > m_end;            // end time of the event at each sorted position
+
+    Partition m_all;
+    QHash< int, Partition > m_keys;     // map key to the partition of the events having that key
+
+};
+
+
+} // GUI
+} // ArgoNavis
+
+#endif // EVENTINTERVALINDEX_H
@@ -0,0 +1,188 @@
+/*!
+   \file MetricReduction.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef METRICREDUCTION_H
+#define METRICREDUCTION_H
+
+#include <QtConcurrentRun>
+#include <QFutureSynchronizer>
+#include <QThread>
+
+#include <map>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/*!
+ * \brief The MetricReductionResult struct
+ *
+ * Struct-of-arrays result of a fused metric reduction.  Element 'i' of each array pertains to the i-th key of
+ * the reduced map (in map order).  The thread pointers refer into the reduced map and are only valid while
+ * that map exists; they are null for keys without any thread values.
+ */
+template <typename TS, typename TT, typename TM>
+struct MetricReductionResult
+{
+    std::vector< TS > keys;
+    std::vector< TM > sum;
+    std::vector< TM > minimum;
+    std::vector< TM > maximum;
+    std::vector< TM > mean;
+    std::vector< const TT* > minimumThread;       // first thread holding the minimum value
+    std::vector< const TT* > maximumThread;       // first thread holding the maximum value
+    std::vector< const TT* > meanThread;          // thread with value closest to the mean (if requested)
+
+    std::size_t size() const { return keys.size(); }
+};
+
+
+/**
+ * @brief reduceMetricValuesRange
+ * @param values - the per-key thread value maps (index aligned with the result arrays)
+ * @param result - the result arrays (already sized)
+ * @param findMeanThread - whether to determine the thread with value closest to the mean
+ * @param begin - index of first key to reduce
+ * @param end - index past the last key to reduce
+ *
+ * Computes sum, minimum, maximum and mean (plus minimum and maximum threads) for the keys in the range [begin, end)
+ * in a single pass over each thread value map.  Each invocation writes only the result elements of its own range.
+ */
+template <typename TS, typename TT, typename TM>
+void reduceMetricValuesRange(const std::vector< const std::map< TT, TM >* >* values,
+                             MetricReductionResult< TS, TT, TM >* result,
+                             bool findMeanThread,
+                             std::size_t begin,
+                             std::size_t end)
+{
+    for ( std::size_t i=begin; i<end; ++i ) {
+        const std::map< TT, TM >& threadValues( *values->at( i ) );
+
+        TM sum( 0 );
+        TM min( 0 );
+        TM max( 0 );
+        const TT* minThread( 0 );
+        const TT* maxThread( 0 );
+
+        for ( typename std::map< TT, TM >::const_iterator iter = threadValues.begin(); iter != threadValues.end(); ++iter ) {
+            const TM& value( iter->second );
+            sum += value;
+            if ( 0 == minThread || value < min ) {
+                min = value;
+                minThread = &iter->first;
+            }
+            if ( 0 == maxThread || value > max ) {
+                max = value;
+                maxThread = &iter->first;
+            }
+        }
+
+        const TM mean = threadValues.empty() ? TM( 0 ) : sum / static_cast< TM >( threadValues.size() );
+
+        result->sum[ i ] = sum;
+        result->minimum[ i ] = min;
+        result->maximum[ i ] = max;
+        result->mean[ i ] = mean;
+        result->minimumThread[ i ] = minThread;
+        result->maximumThread[ i ] = maxThread;
+
+        if ( findMeanThread ) {
+            const TT* meanThread( 0 );
+            double diff( 0.0 );
+            for ( typename std::map< TT, TM >::const_iterator iter = threadValues.begin(); iter != threadValues.end(); ++iter ) {
+                const double temp_diff = std::fabs( static_cast< double >( mean ) - static_cast< double >( iter->second ) );
+                if ( 0 == meanThread || temp_diff < diff ) {
+                    meanThread = &iter->first;
+                    diff = temp_diff;
+                }
+            }
+            result->meanThread[ i ] = meanThread;
+        }
+    }
+}
+
+/**
+ * @brief reduceMetricValues
+ * @param individual - the map of per-thread metric values for each key
+ * @param result - the struct-of-arrays result
+ * @param findMeanThread - whether to determine the thread with value closest to the mean for each key
+ * @param minimumKeysPerTask - the minimum number of keys reduced by each concurrent task
+ *
+ * Replaces separate Summation, Minimum, Maximum and ArithmeticMean reductions over the same map by one fused reduction.
+ * When there are enough keys the reduction is split into contiguous key ranges which are reduced concurrently.
+ */
+template <typename TS, typename TT, typename TM>
+void reduceMetricValues(const std::map< TS, std::map< TT, TM > >& individual,
+                        MetricReductionResult< TS, TT, TM >& result,
+                        bool findMeanThread = false,
+                        std::size_t minimumKeysPerTask = 64)
+{
+    const std::size_t count = individual.size();
+
+    std::vector< const std::map< TT, TM >* > values;
+    values.reserve( count );
+
+    result.keys.clear();
+    result.keys.reserve( count );
+
+    for ( typename std::map< TS, std::map< TT, TM > >::const_iterator iter = individual.begin(); iter != individual.end(); ++iter ) {
+        result.keys.push_back( iter->first );
+        values.push_back( &iter->second );
+    }
+
+    result.sum.assign( count, TM( 0 ) );
+    result.minimum.assign( count, TM( 0 ) );
+    result.maximum.assign( count, TM( 0 ) );
+    result.mean.assign( count, TM( 0 ) );
+    result.minimumThread.assign( count, 0 );
+    result.maximumThread.assign( count, 0 );
+    result.meanThread.assign( count, 0 );
+
+    const std::size_t idealThreadCount = std::max( QThread::idealThreadCount(), 1 );
+    const std::size_t taskCount = std::min( idealThreadCount, count / std::max( minimumKeysPerTask, std::size_t( 1 ) ) );
+
+    if ( taskCount < 2 ) {
+        reduceMetricValuesRange< TS, TT, TM >( &values, &result, findMeanThread, 0, count );
+        return;
+    }
+
+    const std::size_t keysPerTask = ( count + taskCount - 1 ) / taskCount;
+
+    QFutureSynchronizer<void> synchronizer;
+
+    for ( std::size_t begin=0; begin<count; begin+=keysPerTask ) {
+        const std::size_t end = std::min( begin + keysPerTask, count );
+        synchronizer.addFuture( QtConcurrent::run( reduceMetricValuesRange< TS, TT, TM >, &values, &result, findMeanThread, begin, end ) );
+    }
+
+    synchronizer.waitForFinished();
+}
+
+
+} // GUI
+} // ArgoNavis
+
+#endif // METRICREDUCTION_H
@@ -0,0 +1,701 @@
+/*!
+   \file MetricViewCache.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "MetricViewCache.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QDataStream>
+#include <QCryptographicHash>
+#include <QVector>
+#include <QVariant>
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 1, 0))
+#include <QSaveFile>
+#else
+#include <QTemporaryFile>
+#endif
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
+#include <QStandardPaths>
+#else
+#include <QDesktopServices>
+#endif
+
+#include <cstring>
+#include <cstdio>
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+// identifies a metric view cache entry file
+const quint32 METRIC_VIEW_CACHE_MAGIC = 0x4F53564D;
+
+// increment whenever the layout of the entry files or the contents of the cached views change
+const quint32 METRIC_VIEW_CACHE_VERSION = 2;
+
+// written in native byte order ahead of the blocks - the typed arrays of the blocks are stored in native byte order
+const quint32 BYTE_ORDER_MARK = 0x01020304;
+
+// number of bytes hashed at the beginning and end of the database file for the fingerprint
+const qint64 FINGERPRINT_SAMPLE_SIZE = 1024 * 1024;
+
+const QString DATABASE_INFO_FILENAME = QStringLiteral("database.info");
+const QString ENTRY_FILE_SUFFIX = QStringLiteral(".mvc");
+
+
+/**
+ * @brief writeBytes
+ * @param device - the device written to
+ * @param data - the bytes to write
+ * @param size - the number of bytes to write
+ * @return - indicates whether all bytes were written
+ */
+static bool writeBytes(QIODevice& device, const void* data, qint64 size)
+{
+    return size == 0 || device.write( static_cast< const char* >( data ), size ) == size;
+}
+
+/**
+ * @brief writePadding
+ * @param device - the device written to
+ * @param alignment - the alignment of the next value written
+ * @return - indicates whether the padding was written
+ */
+static bool writePadding(QIODevice& device, int alignment)
+{
+    static const char padding[8] = { 0 };
+
+    return writeBytes( device, padding, ( alignment - device.pos() % alignment ) % alignment );
+}
+
+/**
+ * @brief writeInt
+ * @param device - the device written to
+ * @param value - the value to write aligned to four bytes
+ * @return - indicates whether the value was written
+ */
+static bool writeInt(QIODevice& device, qint32 value)
+{
+    return writePadding( device, sizeof(value) ) && writeBytes( device, &value, sizeof(value) );
+}
+
+/**
+ * @brief writeArray
+ * @param device - the device written to
+ * @param values - the values to write aligned to the size of a value
+ * @return - indicates whether the values were written
+ */
+template <typename T>
+static bool writeArray(QIODevice& device, const QVector< T >& values)
+{
+    return writePadding( device, sizeof(T) ) && writeBytes( device, values.constData(), values.size() * sizeof(T) );
+}
+
+/**
+ * @brief readBytes
+ * @param data - the memory-mapped entry file
+ * @param size - the size of the entry file
+ * @param offset - the offset of the next unread byte (advanced past the bytes read)
+ * @param bytes - the number of bytes to read
+ * @param alignment - the alignment of the bytes to read
+ * @return - pointer to the bytes in the memory-mapped file or null if the file is too short
+ */
+static const char* readBytes(const char* data, qint64 size, qint64& offset, qint64 bytes, int alignment = 1)
+{
+    const qint64 begin = ( offset + alignment - 1 ) / alignment * alignment;
+
+    if ( bytes < 0 || begin + bytes > size )
+        return Q_NULLPTR;
+
+    offset = begin + bytes;
+
+    return data + begin;
+}
+
+/**
+ * @brief readInt
+ * @param data - the memory-mapped entry file
+ * @param size - the size of the entry file
+ * @param offset - the offset of the next unread byte (advanced past the value read)
+ * @param value - returns the value read
+ * @return - indicates whether the value was read
+ */
+static bool readInt(const char* data, qint64 size, qint64& offset, qint32& value)
+{
+    const char* bytes = readBytes( data, size, offset, sizeof(value), sizeof(value) );
+
+    if ( Q_NULLPTR == bytes )
+        return false;
+
+    std::memcpy( &value, bytes, sizeof(value) );
+
+    return true;
+}
+
+/**
+ * @brief readArray
+ * @param data - the memory-mapped entry file
+ * @param size - the size of the entry file
+ * @param offset - the offset of the next unread byte (advanced past the values read)
+ * @param count - the number of values to read
+ * @param values - returns the values read
+ * @return - indicates whether the values were read
+ *
+ * The values are copied out of the memory-mapped file with a single copy of the array.
+ */
+template <typename T>
+static bool readArray(const char* data, qint64 size, qint64& offset, int count, QVector< T >& values)
+{
+    const char* bytes = readBytes( data, size, offset, (qint64) count * sizeof(T), sizeof(T) );
+
+    if ( Q_NULLPTR == bytes )
+        return false;
+
+    values.resize( count );
+
+    if ( count > 0 )
+        std::memcpy( values.data(), bytes, count * sizeof(T) );
+
+    return true;
+}
+
+
+/**
+ * @brief MetricViewCache::MetricViewCache
+ *
+ * Constructs a MetricViewCache instance.
+ */
+MetricViewCache::MetricViewCache()
+    : m_cacheRootDirectory( getCacheRootDirectory() )
+{
+
+}
+
+/**
+ * @brief MetricViewCache::~MetricViewCache
+ *
+ * Destroys the MetricViewCache instance.
+ */
+MetricViewCache::~MetricViewCache()
+{
+
+}
+
+/**
+ * @brief MetricViewCache::setDatabase
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @param databasePath - the path of the experiment database
+ *
+ * Associates the experiment database with the clustering criteria name.  If the database changed since the cache entries
+ * for it were created, all those entries are removed.
+ */
+void MetricViewCache::setDatabase(const QString &clusteringCriteriaName, const QString &databasePath)
+{
+    if ( m_cacheRootDirectory.isEmpty() )
+        return;
+
+    const QString absolutePath = QFileInfo( databasePath ).absoluteFilePath();
+
+    const QByteArray fingerprint = getDatabaseFingerprint( absolutePath );
+
+    if ( fingerprint.isEmpty() )
+        return;
+
+    const QByteArray pathHash = QCryptographicHash::hash( absolutePath.toUtf8(), QCryptographicHash::Sha1 ).toHex();
+
+    QDir dir( m_cacheRootDirectory );
+
+    if ( ! dir.mkpath( QString( pathHash ) ) || ! dir.cd( QString( pathHash ) ) )
+        return;
+
+    // validate the entries of the cache directory against the fingerprint of the database
+    QFile infoFile( dir.filePath( DATABASE_INFO_FILENAME ) );
+
+    QByteArray storedFingerprint;
+
+    if ( infoFile.open( QIODevice::ReadOnly ) ) {
+        QDataStream stream( &infoFile );
+        stream.setVersion( QDataStream::Qt_4_6 );
+        quint32 version;
+        QString path;
+        stream >> version >> path >> storedFingerprint;
+        if ( stream.status() != QDataStream::Ok || version != METRIC_VIEW_CACHE_VERSION || path != absolutePath )
+            storedFingerprint.clear();
+        infoFile.close();
+    }
+
+    if ( storedFingerprint != fingerprint ) {
+        // stale entries - remove them all
+        foreach ( const QString& filename, dir.entryList( QStringList() << QStringLiteral("*") + ENTRY_FILE_SUFFIX, QDir::Files ) ) {
+            dir.remove( filename );
+        }
+
+        if ( ! infoFile.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+            return;
+
+        QDataStream stream( &infoFile );
+        stream.setVersion( QDataStream::Qt_4_6 );
+        stream << METRIC_VIEW_CACHE_VERSION << absolutePath << fingerprint;
+        infoFile.close();
+    }
+
+    DatabaseInfo info;
+    info.directory = dir.absolutePath();
+    info.fingerprint = fingerprint;
+
+    QMutexLocker guard( &m_mutex );
+
+    m_databases[ clusteringCriteriaName ] = info;
+}
+
+/**
+ * @brief MetricViewCache::removeDatabase
+ * @param clusteringCriteriaName - the clustering criteria name
+ *
+ * Removes the association of the clustering criteria name with an experiment database.  The cache entries are kept on disk.
+ */
+void MetricViewCache::removeDatabase(const QString &clusteringCriteriaName)
+{
+    QMutexLocker guard( &m_mutex );
+
+    m_databases.remove( clusteringCriteriaName );
+}
+
+/**
+ * @brief MetricViewCache::hasDatabase
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @return - indicates whether an experiment database is associated with the clustering criteria name
+ *
+ * Producers of metric views only build cache keys and entries when this returns true.
+ */
+bool MetricViewCache::hasDatabase(const QString &clusteringCriteriaName) const
+{
+    QMutexLocker guard( &m_mutex );
+
+    return m_databases.contains( clusteringCriteriaName );
+}
+
+/**
+ * @brief MetricViewCache::getKey
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @param viewDescription - strings identifying the view (eg. view type, metric name and view name)
+ * @param intervalBegin - the begin of the time interval of the view
+ * @param intervalEnd - the end of the time interval of the view
+ * @param threadNames - the names of the threads contributing to the view
+ * @return - the cache key or an empty key if no database is associated with the clustering criteria name
+ *
+ * Computes the key of a cache entry from the database fingerprint and the specified view parameters.
+ */
+QByteArray MetricViewCache::getKey(const QString &clusteringCriteriaName, const QStringList &viewDescription, quint64 intervalBegin, quint64 intervalEnd, const QStringList &threadNames) const
+{
+    DatabaseInfo info;
+
+    if ( ! getDatabaseInfo( clusteringCriteriaName, info ) )
+        return QByteArray();
+
+    QByteArray keyData;
+
+    {
+        QDataStream stream( &keyData, QIODevice::WriteOnly );
+        stream.setVersion( QDataStream::Qt_4_6 );
+        stream << METRIC_VIEW_CACHE_VERSION << info.fingerprint << viewDescription << intervalBegin << intervalEnd << threadNames;
+    }
+
+    return QCryptographicHash::hash( keyData, QCryptographicHash::Sha1 ).toHex();
+}
+
+/**
+ * @brief MetricViewCache::lookup
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @param key - the cache key
+ * @param entry - returns the cached metric view
+ * @return - indicates whether the metric view was found in the cache
+ *
+ * Reads the specified entry from the cache.  The header of the entry is deserialized and the columnar blocks following it
+ * are read in place from the memory-mapped file - each typed array is copied into its block at once without converting the
+ * values to QVariant.  Entries that can't be read or don't match the current database are removed.
+ */
+bool MetricViewCache::lookup(const QString &clusteringCriteriaName, const QByteArray &key, Entry &entry) const
+{
+    DatabaseInfo info;
+
+    if ( key.isEmpty() || ! getDatabaseInfo( clusteringCriteriaName, info ) )
+        return false;
+
+    QFile file( QDir( info.directory ).filePath( QString( key ) + ENTRY_FILE_SUFFIX ) );
+
+    if ( ! file.open( QIODevice::ReadOnly ) )
+        return false;
+
+    const qint64 size = file.size();
+
+    uchar* mapped = file.map( 0, size );
+
+    if ( Q_NULLPTR == mapped ) {
+        file.close();
+        return false;
+    }
+
+    bool valid( false );
+
+    {
+        const char* data = reinterpret_cast< const char* >( mapped );
+
+        QDataStream stream( QByteArray::fromRawData( data, size ) );
+        stream.setVersion( QDataStream::Qt_4_6 );
+
+        quint32 magic, version, blockCount;
+        QByteArray fingerprint, entryKey;
+
+        stream >> magic >> version >> fingerprint >> entryKey;
+
+        if ( stream.status() == QDataStream::Ok && METRIC_VIEW_CACHE_MAGIC == magic && METRIC_VIEW_CACHE_VERSION == version &&
+             fingerprint == info.fingerprint && entryKey == key ) {
+            stream >> entry.columnHeaders >> entry.attributes >> blockCount;
+
+            qint64 offset = stream.device()->pos();
+            qint32 byteOrderMark;
+
+            valid = ( stream.status() == QDataStream::Ok ) &&
+                    readInt( data, size, offset, byteOrderMark ) && (quint32) byteOrderMark == BYTE_ORDER_MARK;
+
+            for ( quint32 i=0; valid && i<blockCount; ++i ) {
+                MetricViewDataBlock block;
+                valid = readBlock( data, size, offset, block );
+                entry.blocks << block;
+            }
+        }
+    }
+
+    file.unmap( mapped );
+    file.close();
+
+    if ( ! valid ) {
+        entry = Entry();
+        file.remove();
+    }
+
+    return valid;
+}
+
+/**
+ * @brief MetricViewCache::insert
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @param key - the cache key
+ * @param entry - the metric view to cache
+ *
+ * Writes the metric view to the cache.  The header is serialized and followed by the columnar blocks in the layout read
+ * by MetricViewCache::readBlock.  The entry is written to a uniquely named temporary file in the cache directory which
+ * then atomically replaces the entry, so readers either observe the previous entry or the complete new entry and an
+ * interrupted write leaves the previous entry in place.
+ */
+void MetricViewCache::insert(const QString &clusteringCriteriaName, const QByteArray &key, const Entry &entry)
+{
+    DatabaseInfo info;
+
+    if ( key.isEmpty() || ! getDatabaseInfo( clusteringCriteriaName, info ) )
+        return;
+
+    const QString filename = QDir( info.directory ).filePath( QString( key ) + ENTRY_FILE_SUFFIX );
+
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 1, 0))
+    QSaveFile file( filename );
+
+    if ( ! file.open( QIODevice::WriteOnly ) )
+        return;
+#else
+    QTemporaryFile file( filename + QStringLiteral(".XXXXXX") );
+
+    if ( ! file.open() )
+        return;
+#endif
+
+    QDataStream stream( &file );
+    stream.setVersion( QDataStream::Qt_4_6 );
+
+    stream << METRIC_VIEW_CACHE_MAGIC << METRIC_VIEW_CACHE_VERSION << info.fingerprint << key;
+    stream << entry.columnHeaders << entry.attributes << (quint32) entry.blocks.size();
+
+    bool ok = ( stream.status() == QDataStream::Ok ) && writeInt( file, BYTE_ORDER_MARK );
+
+    foreach ( const MetricViewDataBlock& block, entry.blocks ) {
+        if ( ! ok )
+            break;
+        ok = writeBlock( file, block );
+    }
+
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 1, 0))
+    // the temporary file is discarded unless it replaces the entry
+    if ( ok )
+        file.commit();
+    else
+        file.cancelWriting();
+#else
+    ok = ok && file.flush();
+
+    file.close();
+
+    // rename() replaces an existing entry atomically - the temporary file is removed when it isn't renamed
+    if ( ok && 0 == std::rename( QFile::encodeName( file.fileName() ).constData(), QFile::encodeName( filename ).constData() ) )
+        file.setAutoRemove( false );
+#endif
+}
+
+/**
+ * @brief MetricViewCache::writeBlock
+ * @param device - the entry file
+ * @param block - the block to write
+ * @return - indicates whether the block was written
+ *
+ * Writes the row and column counts of the block followed by each column: its storage type and user type and then the
+ * typed array of the column values (aligned to the size of a value), the string table and the dictionary index of each
+ * value of a string column or the serialized values of a QVariant column.
+ */
+bool MetricViewCache::writeBlock(QIODevice &device, const MetricViewDataBlock &block)
+{
+    bool ok = writeInt( device, block.rowCount() ) && writeInt( device, block.columnCount() );
+
+    for ( int column=0; ok && column<block.columnCount(); ++column ) {
+        const MetricViewDataBlock::ColumnType type = block.columnType( column );
+
+        ok = writeInt( device, type ) && writeInt( device, block.columnUserType( column ) );
+
+        if ( ! ok )
+            break;
+
+        switch ( type ) {
+        case MetricViewDataBlock::Double:
+            ok = writeArray( device, block.doubleColumn( column ) );
+            break;
+        case MetricViewDataBlock::SignedInteger:
+            ok = writeArray( device, block.signedColumn( column ) );
+            break;
+        case MetricViewDataBlock::UnsignedInteger:
+            ok = writeArray( device, block.unsignedColumn( column ) );
+            break;
+        case MetricViewDataBlock::String:
+        {
+            const QStringList& dictionary = block.stringDictionary( column );
+            ok = writeInt( device, dictionary.size() );
+            for ( int i=0; ok && i<dictionary.size(); ++i ) {
+                const QString& str = dictionary.at( i );
+                ok = writeInt( device, str.size() ) && writeBytes( device, str.constData(), str.size() * sizeof(QChar) );
+            }
+            ok = ok && writeArray( device, block.stringIndexColumn( column ) );
+            break;
+        }
+        default:
+        {
+            QByteArray values;
+            {
+                QDataStream stream( &values, QIODevice::WriteOnly );
+                stream.setVersion( QDataStream::Qt_4_6 );
+                stream << block.variantColumn( column );
+            }
+            ok = writeInt( device, values.size() ) && writeBytes( device, values.constData(), values.size() );
+            break;
+        }
+        }
+    }
+
+    return ok;
+}
+
+/**
+ * @brief MetricViewCache::readBlock
+ * @param data - the memory-mapped entry file
+ * @param size - the size of the entry file
+ * @param offset - the offset of the block in the entry file (advanced past the block)
+ * @param block - returns the block read
+ * @return - indicates whether a valid block was read
+ *
+ * Reads a block written by MetricViewCache::writeBlock directly from the memory-mapped entry file.
+ */
+bool MetricViewCache::readBlock(const char *data, qint64 size, qint64 &offset, MetricViewDataBlock &block)
+{
+    qint32 rowCount, columnCount;
+
+    if ( ! readInt( data, size, offset, rowCount ) || ! readInt( data, size, offset, columnCount ) || rowCount < 0 || columnCount < 0 )
+        return false;
+
+    block = MetricViewDataBlock( qMax( rowCount, 1 ) );
+
+    for ( int column=0; column<columnCount; ++column ) {
+        qint32 type, userType;
+
+        if ( ! readInt( data, size, offset, type ) || ! readInt( data, size, offset, userType ) )
+            return false;
+
+        switch ( type ) {
+        case MetricViewDataBlock::Double:
+        {
+            QVector< double > values;
+            if ( ! readArray( data, size, offset, rowCount, values ) )
+                return false;
+            block.appendDoubleColumn( values, userType );
+            break;
+        }
+        case MetricViewDataBlock::SignedInteger:
+        {
+            QVector< qint64 > values;
+            if ( ! readArray( data, size, offset, rowCount, values ) )
+                return false;
+            block.appendSignedColumn( values, userType );
+            break;
+        }
+        case MetricViewDataBlock::UnsignedInteger:
+        {
+            QVector< quint64 > values;
+            if ( ! readArray( data, size, offset, rowCount, values ) )
+                return false;
+            block.appendUnsignedColumn( values, userType );
+            break;
+        }
+        case MetricViewDataBlock::String:
+        {
+            qint32 dictionarySize;
+            if ( ! readInt( data, size, offset, dictionarySize ) || dictionarySize < 0 )
+                return false;
+            QStringList dictionary;
+            dictionary.reserve( dictionarySize );
+            for ( int i=0; i<dictionarySize; ++i ) {
+                qint32 length;
+                const char* chars = Q_NULLPTR;
+                if ( ! readInt( data, size, offset, length ) || length < 0 ||
+                     Q_NULLPTR == ( chars = readBytes( data, size, offset, (qint64) length * sizeof(QChar), sizeof(QChar) ) ) )
+                    return false;
+                dictionary << QString( reinterpret_cast< const QChar* >( chars ), length );
+            }
+            QVector< int > indexes;
+            if ( ! readArray( data, size, offset, rowCount, indexes ) )
+                return false;
+            foreach ( int index, indexes ) {
+                if ( index < 0 || index >= dictionarySize )
+                    return false;
+            }
+            block.appendStringColumn( indexes, dictionary );
+            break;
+        }
+        case MetricViewDataBlock::Variant:
+        {
+            qint32 length;
+            const char* bytes = Q_NULLPTR;
+            if ( ! readInt( data, size, offset, length ) || Q_NULLPTR == ( bytes = readBytes( data, size, offset, length ) ) )
+                return false;
+            QDataStream stream( QByteArray::fromRawData( bytes, length ) );
+            stream.setVersion( QDataStream::Qt_4_6 );
+            QVector< QVariant > values;
+            stream >> values;
+            if ( stream.status() != QDataStream::Ok || values.size() != rowCount )
+                return false;
+            block.appendVariantColumn( values, userType );
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief MetricViewCache::getCacheRootDirectory
+ * @return - the root directory of the metric view cache
+ */
+QString MetricViewCache::getCacheRootDirectory()
+{
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
+    const QString location = QStandardPaths::writableLocation( QStandardPaths::CacheLocation );
+#else
+    const QString location = QDesktopServices::storageLocation( QDesktopServices::CacheLocation );
+#endif
+
+    if ( location.isEmpty() )
+        return QString();
+
+    return QDir( location ).filePath( QStringLiteral("metric-views") );
+}
+
+/**
+ * @brief MetricViewCache::getDatabaseFingerprint
+ * @param databasePath - the path of the experiment database
+ * @return - the fingerprint of the database or an empty array if the database file can't be read
+ *
+ * Computes a fingerprint of the database from its size, its modification time and a hash of the content at the beginning
+ * and end of the file.  Hashing the entire database would take too long for large experiments.
+ */
+QByteArray MetricViewCache::getDatabaseFingerprint(const QString &databasePath)
+{
+    QFile file( databasePath );
+
+    if ( ! file.open( QIODevice::ReadOnly ) )
+        return QByteArray();
+
+    const QFileInfo fileInfo( file );
+
+    QCryptographicHash hash( QCryptographicHash::Sha1 );
+
+    QByteArray header;
+
+    {
+        QDataStream stream( &header, QIODevice::WriteOnly );
+        stream.setVersion( QDataStream::Qt_4_6 );
+        stream << (quint64) fileInfo.size() << (qint64) fileInfo.lastModified().toMSecsSinceEpoch();
+    }
+
+    hash.addData( header );
+    hash.addData( file.read( FINGERPRINT_SAMPLE_SIZE ) );
+
+    if ( file.size() > FINGERPRINT_SAMPLE_SIZE && file.seek( qMax( FINGERPRINT_SAMPLE_SIZE, file.size() - FINGERPRINT_SAMPLE_SIZE ) ) ) {
+        hash.addData( file.read( FINGERPRINT_SAMPLE_SIZE ) );
+    }
+
+    file.close();
+
+    return hash.result();
+}
+
+/**
+ * @brief MetricViewCache::getDatabaseInfo
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @param info - returns the cache information of the database associated with the clustering criteria name
+ * @return - indicates whether a database is associated with the clustering criteria name
+ */
+bool MetricViewCache::getDatabaseInfo(const QString &clusteringCriteriaName, DatabaseInfo &info) const
+{
+    QMutexLocker guard( &m_mutex );
+
+    if ( ! m_databases.contains( clusteringCriteriaName ) )
+        return false;
+
+    info = m_databases.value( clusteringCriteriaName );
+
+    return true;
+}
+
+
+} // GUI
+} // ArgoNavis
@@ -0,0 +1,107 @@
+/*!
+   \file MetricViewCache.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef METRICVIEWCACHE_H
+#define METRICVIEWCACHE_H
+
+#include <QString>
+#include <QStringList>
+#include <QByteArray>
+#include <QList>
+#include <QVariantMap>
+#include <QMap>
+#include <QMutex>
+#include <QIODevice>
+
+#include "common/openss-gui-config.h"
+
+#include "MetricViewDataBlock.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/*!
+ * \brief The MetricViewCache class
+ *
+ * Persistent on-disk cache of finished metric view tables.  Each experiment database has its own cache directory
+ * which is validated against a fingerprint of the database (size, modification time and a hash of the content at
+ * the beginning and end of the file) when the database is registered.  The entries of a database whose fingerprint
+ * changed are removed.  Each entry is stored in one binary file holding the columnar blocks of the view in the layout
+ * of MetricViewDataBlock - typed arrays and string tables - which are read directly from the memory-mapped file.
+ */
+
+class MetricViewCache
+{
+public:
+
+    struct Entry {
+        QStringList columnHeaders;                // metric view column headers
+        QList< MetricViewDataBlock > blocks;      // metric view rows in emission order
+        QVariantMap attributes;                   // additional view specific data
+    };
+
+    explicit MetricViewCache();
+    virtual ~MetricViewCache();
+
+    void setDatabase(const QString& clusteringCriteriaName, const QString& databasePath);
+    void removeDatabase(const QString& clusteringCriteriaName);
+    bool hasDatabase(const QString& clusteringCriteriaName) const;
+
+    QByteArray getKey(const QString& clusteringCriteriaName,
+                      const QStringList& viewDescription,
+                      quint64 intervalBegin,
+                      quint64 intervalEnd,
+                      const QStringList& threadNames) const;
+
+    bool lookup(const QString& clusteringCriteriaName, const QByteArray& key, Entry& entry) const;
+    void insert(const QString& clusteringCriteriaName, const QByteArray& key, const Entry& entry);
+
+private:
+
+    struct DatabaseInfo {
+        QString directory;
+        QByteArray fingerprint;
+    };
+
+    static QString getCacheRootDirectory();
+    static QByteArray getDatabaseFingerprint(const QString& databasePath);
+
+    static bool writeBlock(QIODevice& device, const MetricViewDataBlock& block);
+    static bool readBlock(const char* data, qint64 size, qint64& offset, MetricViewDataBlock& block);
+
+    bool getDatabaseInfo(const QString& clusteringCriteriaName, DatabaseInfo& info) const;
+
+    QString m_cacheRootDirectory;
+
+    QMap< QString, DatabaseInfo > m_databases;    // map clustering criteria name to database cache information
+
+    mutable QMutex m_mutex;
+
+};
+
+
+} // GUI
+} // ArgoNavis
+
+#endif // METRICVIEWCACHE_H
@@ -0,0 +1,520 @@
+/*!
+   \file MetricViewDataBlock.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "MetricViewDataBlock.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/**
+ * @brief MetricViewDataBlock::MetricViewDataBlock
+ * @param capacity - the number of rows after which the block is considered full
+ *
+ * Constructs an empty MetricViewDataBlock instance.  The block stores the rows of a metric view in columnar
+ * form: numeric columns in native typed vectors and string columns dictionary-encoded.
+ */
+MetricViewDataBlock::MetricViewDataBlock(int capacity)
+    : m_rowCount( 0 )
+    , m_capacity( capacity )
+{
+
+}
+
+/**
+ * @brief MetricViewDataBlock::appendRow
+ * @param data - the row data to append
+ *
+ * Appends one row to the block.  The type of each column is determined by the first row appended.  A column
+ * receiving a value whose type differs from the column type is converted to a generic QVariant column.
+ */
+void MetricViewDataBlock::appendRow(const QVariantList &data)
+{
+    if ( 0 == m_rowCount ) {
+        m_columns.resize( data.size() );
+        for ( int i=0; i<data.size(); ++i ) {
+            Column& column = m_columns[ i ];
+            column.userType = data.at( i ).userType();
+            column.type = getColumnType( column.userType );
+        }
+    }
+    else if ( data.size() > m_columns.size() ) {
+        // extra columns are backfilled with invalid values for the previous rows
+        const int oldSize = m_columns.size();
+        m_columns.resize( data.size() );
+        for ( int i=oldSize; i<data.size(); ++i ) {
+            Column& column = m_columns[ i ];
+            column.userType = QVariant::Invalid;
+            column.type = Variant;
+            column.variants.fill( QVariant(), m_rowCount );
+        }
+    }
+
+    for ( int i=0; i<m_columns.size(); ++i ) {
+        appendValue( m_columns[ i ], i < data.size() ? data.at( i ) : QVariant() );
+    }
+
+    ++m_rowCount;
+}
+
+/**
+ * @brief MetricViewDataBlock::appendDoubleColumn
+ * @param values - the values of the column
+ * @param userType - the QVariant user type reported for the values
+ *
+ * Appends a column of floating-point values to a block built column by column.
+ */
+void MetricViewDataBlock::appendDoubleColumn(const QVector<double> &values, int userType)
+{
+    appendColumn( Double, userType, values.size() ).doubles = values;
+}
+
+/**
+ * @brief MetricViewDataBlock::appendSignedColumn
+ * @param values - the values of the column
+ * @param userType - the QVariant user type reported for the values
+ *
+ * Appends a column of signed integer values to a block built column by column.
+ */
+void MetricViewDataBlock::appendSignedColumn(const QVector<qint64> &values, int userType)
+{
+    appendColumn( SignedInteger, userType, values.size() ).signedValues = values;
+}
+
+/**
+ * @brief MetricViewDataBlock::appendUnsignedColumn
+ * @param values - the values of the column
+ * @param userType - the QVariant user type reported for the values
+ *
+ * Appends a column of unsigned integer values to a block built column by column.
+ */
+void MetricViewDataBlock::appendUnsignedColumn(const QVector<quint64> &values, int userType)
+{
+    appendColumn( UnsignedInteger, userType, values.size() ).unsignedValues = values;
+}
+
+/**
+ * @brief MetricViewDataBlock::appendStringColumn
+ * @param indexes - the dictionary index of the value in each row
+ * @param dictionary - the dictionary of strings
+ *
+ * Appends a dictionary-encoded string column to a block built column by column.  The dictionary is shared with the
+ * caller and may contain strings not referenced by the block.
+ */
+void MetricViewDataBlock::appendStringColumn(const QVector<int> &indexes, const QStringList &dictionary)
+{
+    Column& column = appendColumn( String, QMetaType::QString, indexes.size() );
+
+    column.stringIndexes = indexes;
+    column.dictionary = dictionary;
+
+    for ( int i=0; i<dictionary.size(); ++i ) {
+        column.dictionaryIndex.insert( dictionary.at( i ), i );
+    }
+}
+
+/**
+ * @brief MetricViewDataBlock::appendVariantColumn
+ * @param values - the values of the column
+ * @param userType - the QVariant user type reported for the column
+ *
+ * Appends a column of generic QVariant values to a block built column by column.
+ */
+void MetricViewDataBlock::appendVariantColumn(const QVector<QVariant> &values, int userType)
+{
+    appendColumn( Variant, userType, values.size() ).variants = values;
+}
+
+/**
+ * @brief MetricViewDataBlock::clear
+ *
+ * Removes all rows and columns from the block.
+ */
+void MetricViewDataBlock::clear()
+{
+    m_columns.clear();
+    m_rowCount = 0;
+}
+
+/**
+ * @brief MetricViewDataBlock::rowCount
+ * @return - the number of rows in the block
+ */
+int MetricViewDataBlock::rowCount() const
+{
+    return m_rowCount;
+}
+
+/**
+ * @brief MetricViewDataBlock::columnCount
+ * @return - the number of columns in the block
+ */
+int MetricViewDataBlock::columnCount() const
+{
+    return m_columns.size();
+}
+
+/**
+ * @brief MetricViewDataBlock::capacity
+ * @return - the number of rows after which the block is considered full
+ */
+int MetricViewDataBlock::capacity() const
+{
+    return m_capacity;
+}
+
+/**
+ * @brief MetricViewDataBlock::isEmpty
+ * @return - whether the block contains no rows
+ */
+bool MetricViewDataBlock::isEmpty() const
+{
+    return 0 == m_rowCount;
+}
+
+/**
+ * @brief MetricViewDataBlock::isFull
+ * @return - whether the block has reached its capacity and should be emitted
+ */
+bool MetricViewDataBlock::isFull() const
+{
+    return m_rowCount >= m_capacity;
+}
+
+/**
+ * @brief MetricViewDataBlock::value
+ * @param row - the row index
+ * @param column - the column index
+ * @return - the value at the specified row and column as a QVariant of the originally appended type
+ */
+QVariant MetricViewDataBlock::value(int row, int column) const
+{
+    if ( row < 0 || row >= m_rowCount || column < 0 || column >= m_columns.size() )
+        return QVariant();
+
+    return columnValue( m_columns.at( column ), row );
+}
+
+/**
+ * @brief MetricViewDataBlock::row
+ * @param row - the row index
+ * @return - the values of the specified row
+ */
+QVariantList MetricViewDataBlock::row(int row) const
+{
+    QVariantList data;
+
+    if ( row < 0 || row >= m_rowCount )
+        return data;
+
+    for ( int i=0; i<m_columns.size(); ++i ) {
+        data << columnValue( m_columns.at( i ), row );
+    }
+
+    return data;
+}
+
+/**
+ * @brief MetricViewDataBlock::columnType
+ * @param column - the column index
+ * @return - the storage type of the specified column
+ */
+MetricViewDataBlock::ColumnType MetricViewDataBlock::columnType(int column) const
+{
+    return m_columns.at( column ).type;
+}
+
+/**
+ * @brief MetricViewDataBlock::columnUserType
+ * @param column - the column index
+ * @return - the QVariant user type of the values appended to the specified column
+ */
+int MetricViewDataBlock::columnUserType(int column) const
+{
+    return m_columns.at( column ).userType;
+}
+
+/**
+ * @brief MetricViewDataBlock::doubleColumn
+ * @param column - the column index
+ * @return - the values of a column of type MetricViewDataBlock::Double
+ */
+const QVector<double> &MetricViewDataBlock::doubleColumn(int column) const
+{
+    return m_columns.at( column ).doubles;
+}
+
+/**
+ * @brief MetricViewDataBlock::signedColumn
+ * @param column - the column index
+ * @return - the values of a column of type MetricViewDataBlock::SignedInteger
+ */
+const QVector<qint64> &MetricViewDataBlock::signedColumn(int column) const
+{
+    return m_columns.at( column ).signedValues;
+}
+
+/**
+ * @brief MetricViewDataBlock::unsignedColumn
+ * @param column - the column index
+ * @return - the values of a column of type MetricViewDataBlock::UnsignedInteger
+ */
+const QVector<quint64> &MetricViewDataBlock::unsignedColumn(int column) const
+{
+    return m_columns.at( column ).unsignedValues;
+}
+
+/**
+ * @brief MetricViewDataBlock::stringIndexColumn
+ * @param column - the column index
+ * @return - the dictionary indexes of a column of type MetricViewDataBlock::String
+ */
+const QVector<int> &MetricViewDataBlock::stringIndexColumn(int column) const
+{
+    return m_columns.at( column ).stringIndexes;
+}
+
+/**
+ * @brief MetricViewDataBlock::stringDictionary
+ * @param column - the column index
+ * @return - the dictionary of distinct strings of a column of type MetricViewDataBlock::String
+ */
+const QStringList &MetricViewDataBlock::stringDictionary(int column) const
+{
+    return m_columns.at( column ).dictionary;
+}
+
+/**
+ * @brief MetricViewDataBlock::variantColumn
+ * @param column - the column index
+ * @return - the values of a column of type MetricViewDataBlock::Variant
+ */
+const QVector<QVariant> &MetricViewDataBlock::variantColumn(int column) const
+{
+    return m_columns.at( column ).variants;
+}
+
+/**
+ * @brief MetricViewDataBlock::getColumnType
+ * @param userType - the QVariant user type
+ * @return - the column storage type used for values of the specified type
+ */
+MetricViewDataBlock::ColumnType MetricViewDataBlock::getColumnType(int userType)
+{
+    switch ( userType ) {
+    case QMetaType::Double:
+    case QMetaType::Float:
+        return Double;
+    case QMetaType::Short:
+    case QMetaType::Int:
+    case QMetaType::Long:
+    case QMetaType::LongLong:
+        return SignedInteger;
+    case QMetaType::UShort:
+    case QMetaType::UInt:
+    case QMetaType::ULong:
+    case QMetaType::ULongLong:
+        return UnsignedInteger;
+    case QMetaType::QString:
+        return String;
+    default:
+        return Variant;
+    }
+}
+
+/**
+ * @brief MetricViewDataBlock::toVariant
+ * @param value - the floating-point value
+ * @param userType - the QVariant user type of the originally appended value
+ * @return - the value as a QVariant of the specified type
+ */
+QVariant MetricViewDataBlock::toVariant(double value, int userType)
+{
+    if ( QMetaType::Float == userType )
+        return QVariant::fromValue< float >( value );
+
+    return QVariant( value );
+}
+
+/**
+ * @brief MetricViewDataBlock::toVariant
+ * @param value - the signed integer value
+ * @param userType - the QVariant user type of the originally appended value
+ * @return - the value as a QVariant of the specified type
+ */
+QVariant MetricViewDataBlock::toVariant(qint64 value, int userType)
+{
+    switch ( userType ) {
+    case QMetaType::Short:
+        return QVariant::fromValue< short >( value );
+    case QMetaType::Int:
+        return QVariant( (int) value );
+    case QMetaType::Long:
+        return QVariant::fromValue< long >( value );
+    default:
+        return QVariant( value );
+    }
+}
+
+/**
+ * @brief MetricViewDataBlock::toVariant
+ * @param value - the unsigned integer value
+ * @param userType - the QVariant user type of the originally appended value
+ * @return - the value as a QVariant of the specified type
+ */
+QVariant MetricViewDataBlock::toVariant(quint64 value, int userType)
+{
+    switch ( userType ) {
+    case QMetaType::UShort:
+        return QVariant::fromValue< ushort >( value );
+    case QMetaType::UInt:
+        return QVariant( (uint) value );
+    case QMetaType::ULong:
+        return QVariant::fromValue< ulong >( value );
+    default:
+        return QVariant( value );
+    }
+}
+
+/**
+ * @brief MetricViewDataBlock::appendColumn
+ * @param type - the storage type of the column
+ * @param userType - the QVariant user type of the column values
+ * @param rowCount - the number of values in the column
+ * @return - the new column
+ *
+ * Adds an empty column to a block built column by column.  The first column determines the row count of the block
+ * and each further column must have the same number of values.
+ */
+MetricViewDataBlock::Column &MetricViewDataBlock::appendColumn(ColumnType type, int userType, int rowCount)
+{
+    if ( m_columns.isEmpty() )
+        m_rowCount = rowCount;
+
+    Q_ASSERT( rowCount == m_rowCount );
+
+    m_columns.resize( m_columns.size() + 1 );
+
+    Column& column = m_columns.last();
+
+    column.type = type;
+    column.userType = userType;
+
+    return column;
+}
+
+/**
+ * @brief MetricViewDataBlock::appendValue
+ * @param column - the column to append to
+ * @param value - the value to append
+ *
+ * Appends the value to the typed storage of the column.
+ */
+void MetricViewDataBlock::appendValue(Column &column, const QVariant &value)
+{
+    if ( column.type != Variant && value.userType() != column.userType ) {
+        convertToVariantColumn( column );
+    }
+
+    switch ( column.type ) {
+    case Double:
+        column.doubles.push_back( value.toDouble() );
+        break;
+    case SignedInteger:
+        column.signedValues.push_back( value.toLongLong() );
+        break;
+    case UnsignedInteger:
+        column.unsignedValues.push_back( value.toULongLong() );
+        break;
+    case String:
+    {
+        const QString str = value.toString();
+        QHash< QString, int >::const_iterator iter = column.dictionaryIndex.constFind( str );
+        if ( iter == column.dictionaryIndex.constEnd() ) {
+            const int index = column.dictionary.size();
+            column.dictionary << str;
+            column.dictionaryIndex.insert( str, index );
+            column.stringIndexes.push_back( index );
+        }
+        else {
+            column.stringIndexes.push_back( iter.value() );
+        }
+        break;
+    }
+    default:
+        column.variants.push_back( value );
+        break;
+    }
+}
+
+/**
+ * @brief MetricViewDataBlock::convertToVariantColumn
+ * @param column - the column to convert
+ *
+ * Moves the values already stored in the typed storage of the column into generic QVariant storage.
+ */
+void MetricViewDataBlock::convertToVariantColumn(Column &column)
+{
+    QVector< QVariant > variants;
+    variants.reserve( m_capacity );
+
+    for ( int i=0; i<m_rowCount; ++i ) {
+        variants.push_back( columnValue( column, i ) );
+    }
+
+    column.doubles.clear();
+    column.signedValues.clear();
+    column.unsignedValues.clear();
+    column.stringIndexes.clear();
+    column.dictionary.clear();
+    column.dictionaryIndex.clear();
+
+    column.variants = variants;
+    column.type = Variant;
+}
+
+/**
+ * @brief MetricViewDataBlock::columnValue
+ * @param column - the column
+ * @param row - the row index
+ * @return - the value of the column at the specified row converted back to the originally appended type
+ */
+QVariant MetricViewDataBlock::columnValue(const Column &column, int row) const
+{
+    switch ( column.type ) {
+    case Double:
+        return toVariant( column.doubles.at( row ), column.userType );
+    case SignedInteger:
+        return toVariant( column.signedValues.at( row ), column.userType );
+    case UnsignedInteger:
+        return toVariant( column.unsignedValues.at( row ), column.userType );
+    case String:
+        return QVariant( column.dictionary.at( column.stringIndexes.at( row ) ) );
+    default:
+        return column.variants.at( row );
+    }
+}
+
+
+} // GUI
+} // ArgoNavis
@@ -0,0 +1,121 @@
+/*!
+   \file MetricViewDataBlock.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef METRICVIEWDATABLOCK_H
+#define METRICVIEWDATABLOCK_H
+
+#include <QVector>
+#include <QVariant>
+#include <QVariantList>
+#include <QStringList>
+#include <QHash>
+#include <QMetaType>
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+class MetricViewDataBlock
+{
+public:
+
+    // number of rows accumulated by producers before a block is emitted
+    static const int DEFAULT_BLOCK_SIZE = 4096;
+
+    enum ColumnType {
+        Double,         // QVector<double>
+        SignedInteger,  // QVector<qint64>
+        UnsignedInteger,// QVector<quint64>
+        String,         // dictionary-encoded: QVector<int> of indexes into QStringList
+        Variant         // fallback for mixed or unsupported value types
+    };
+
+    explicit MetricViewDataBlock(int capacity = DEFAULT_BLOCK_SIZE);
+
+    void appendRow(const QVariantList& data);
+
+    void appendDoubleColumn(const QVector< double >& values, int userType = QMetaType::Double);
+    void appendSignedColumn(const QVector< qint64 >& values, int userType = QMetaType::LongLong);
+    void appendUnsignedColumn(const QVector< quint64 >& values, int userType = QMetaType::ULongLong);
+    void appendStringColumn(const QVector< int >& indexes, const QStringList& dictionary);
+    void appendVariantColumn(const QVector< QVariant >& values, int userType = QVariant::Invalid);
+
+    void clear();
+
+    int rowCount() const;
+    int columnCount() const;
+    int capacity() const;
+    bool isEmpty() const;
+    bool isFull() const;
+
+    QVariant value(int row, int column) const;
+    QVariantList row(int row) const;
+
+    ColumnType columnType(int column) const;
+    int columnUserType(int column) const;
+    const QVector< double >& doubleColumn(int column) const;
+    const QVector< qint64 >& signedColumn(int column) const;
+    const QVector< quint64 >& unsignedColumn(int column) const;
+    const QVector< int >& stringIndexColumn(int column) const;
+    const QStringList& stringDictionary(int column) const;
+    const QVector< QVariant >& variantColumn(int column) const;
+
+    static QVariant toVariant(double value, int userType);
+    static QVariant toVariant(qint64 value, int userType);
+    static QVariant toVariant(quint64 value, int userType);
+
+private:
+
+    struct Column {
+        ColumnType type;
+        int userType;                       // QVariant user type of the original values
+        QVector< double > doubles;
+        QVector< qint64 > signedValues;
+        QVector< quint64 > unsignedValues;
+        QVector< int > stringIndexes;
+        QStringList dictionary;
+        QHash< QString, int > dictionaryIndex;
+        QVector< QVariant > variants;
+    };
+
+    static ColumnType getColumnType(int userType);
+
+    Column& appendColumn(ColumnType type, int userType, int rowCount);
+    void appendValue(Column& column, const QVariant& value);
+    void convertToVariantColumn(Column& column);
+    QVariant columnValue(const Column& column, int row) const;
+
+    QVector< Column > m_columns;
+    int m_rowCount;
+    int m_capacity;
+
+};
+
+
+} // GUI
+} // ArgoNavis
+
+Q_DECLARE_METATYPE( ArgoNavis::GUI::MetricViewDataBlock )
+
+
+#endif // METRICVIEWDATABLOCK_H
@@ -28,6 +28,7 @@
 #include "managers/BackgroundGraphRenderer.h"
 #include "managers/ApplicationOverrideCursorManager.h"
 #include "managers/DerivedMetricsSolver.h"
+#include "managers/MetricReduction.h"
 #include "widgets/PerformanceDataMetricView.h"
 #include "CBTF-ArgoNavis-Ext/DataTransferDetails.h"
 #include "CBTF-ArgoNavis-Ext/KernelExecutionDetails.h"
@@ -36,6 +37,7 @@
 
 #include <cstdint>
 #include <numeric>
+#include <algorithm>
 #include <utility>
 #include <iostream>
 #include <iomanip>
@@ -214,6 +216,36 @@ void PerformanceDataManager::xmlDump(const QString &filePath)
 }
 #endif
 
+/**
+ * @brief sortGraphPoints
+ * @param times - the times of the graph points
+ * @param values - the values of the graph points
+ *
+ * Sort the graph points by time.  Points having the same time keep their relative order.
+ */
+static void sortGraphPoints(QVector< double >& times, QVector< double >& values)
+{
+    const int count = times.size();
+
+    QVector< int > permutation( count );
+    for ( int i=0; i<count; ++i ) {
+        permutation[i] = i;
+    }
+
+    std::stable_sort( permutation.begin(), permutation.end(), [&times](int a, int b) { return times[a] < times[b]; } );
+
+    QVector< double > sortedTimes( count );
+    QVector< double > sortedValues( count );
+
+    for ( int i=0; i<count; ++i ) {
+        sortedTimes[i] = times[ permutation[i] ];
+        sortedValues[i] = values[ permutation[i] ];
+    }
+
+    times.swap( sortedTimes );
+    values.swap( sortedValues );
+}
+
 /**
  * @brief Get_Subextents_To_Object
  * @param tgrp - the set of threads
@@ -328,6 +360,10 @@ PerformanceDataManager::PerformanceDataManager(QObject *parent)
     qRegisterMetaType< CUDA::KernelExecution >("CUDA::KernelExecution");
     qRegisterMetaType< QVector< QString > >("QVector< QString >");
     qRegisterMetaType< QVector< bool > >("QVector< bool >");
+    qRegisterMetaType< QVector< double > >("QVector< double >");
+    qRegisterMetaType< MetricViewDataBlock >("MetricViewDataBlock");
+    qRegisterMetaType< CudaEventSpansPtr >("CudaEventSpansPtr");
+    qRegisterMetaType< TraceEventStorePtr >("TraceEventStorePtr");
 
 #if defined(HAS_EXPERIMENTAL_CONCURRENT_PLOT_TO_IMAGE)
     m_thread.start();
@@ -357,6 +393,9 @@ PerformanceDataManager::PerformanceDataManager(QObject *parent)
  */
 PerformanceDataManager::~PerformanceDataManager()
 {
+    m_scheduler.cancelAll();
+    m_scheduler.waitForDone();
+
 #if defined(HAS_EXPERIMENTAL_CONCURRENT_PLOT_TO_IMAGE)
     m_thread.quit();
     m_thread.wait();
@@ -412,6 +451,20 @@ void PerformanceDataManager::destroy()
  * Handler for external request to produce metric view data for specified metric view.
  */
 void PerformanceDataManager::handleRequestMetricView(const QString& clusteringCriteriaName, const QString& metricName, const QString& viewName)
+{
+    requestMetricView( clusteringCriteriaName, metricName, viewName, ViewTaskScheduler::VisiblePriority );
+}
+
+/**
+ * @brief PerformanceDataManager::requestMetricView
+ * @param clusteringCriteriaName - the name of the clustering criteria
+ * @param metricName - the name of the metric requested in the metric view
+ * @param viewName - the name of the view requested in the metric view
+ * @param priority - the scheduling priority of the work for the metric view
+ *
+ * Submit the work units to produce metric view data for specified metric view to the view task scheduler.
+ */
+void PerformanceDataManager::requestMetricView(const QString &clusteringCriteriaName, const QString &metricName, const QString &viewName, ViewTaskScheduler::Priority priority)
 {
     if ( ! m_tableViewInfo.contains( clusteringCriteriaName ) || metricName.isEmpty() || viewName.isEmpty() )
         return;
@@ -439,38 +492,35 @@ void PerformanceDataManager::handleRequestMetricView(const QString& clusteringCr
 
         info.addMetricView( metricViewName );
 
-        QVector< QFuture<void> >* futures = allocateFutureVector( clusteringCriteriaName, metricViewName );
-
-        if ( ! futures )
-            return;
+        QList< ViewTaskScheduler::Task > tasks;
 
         const Collector& collector( *collectors.begin() );
         const QString collectorId( collector.getMetadata().getUniqueId().c_str() );
 
         if ( s_SAMPLING_EXPERIMENTS.contains( collectorId ) ) {
-            futures->append( QtConcurrent::run( this, &PerformanceDataManager::handleRequestSampleCountersView, clusteringCriteriaName, metricName, viewName ) );
+            tasks << std::bind( &PerformanceDataManager::handleRequestSampleCountersView, this, clusteringCriteriaName, metricName, viewName );
         }
         else {
-            loadCudaMetricViews(*futures,
+            loadCudaMetricViews(tasks,
                                 clusteringCriteriaName,
                                 QStringList() << metricName,
                                 QStringList() << viewName);
         }
 
-        if ( futures->size() > 0 ) {
-            // Determine full time interval extent of this experiment
-            const Extent extent = info.getExtent();
-            const Base::TimeInterval experimentInterval = ConvertToArgoNavis( extent.getTimeInterval() );
-            const TimeInterval interval = info.getInterval();
+        // Determine full time interval extent of this experiment
+        const Extent extent = info.getExtent();
+        const Base::TimeInterval experimentInterval = ConvertToArgoNavis( extent.getTimeInterval() );
+        const TimeInterval interval = info.getInterval();
 
-            const Base::TimeInterval graphInterval = ConvertToArgoNavis( interval );
+        const Base::TimeInterval graphInterval = ConvertToArgoNavis( interval );
 
-            const double lower = ( graphInterval.begin() - experimentInterval.begin() ) / 1000000.0;
-            const double upper = ( graphInterval.end() - experimentInterval.begin() ) / 1000000.0;
+        const double lower = ( graphInterval.begin() - experimentInterval.begin() ) / 1000000.0;
+        const double upper = ( graphInterval.end() - experimentInterval.begin() ) / 1000000.0;
 
-            QtConcurrent::run( boost::bind( &PerformanceDataManager::monitorMetricViewComplete, this,
-                                            futures, clusteringCriteriaName, modeName, metricName, viewName, lower, upper ) );
-        }
+        // any work still in progress for an earlier request of this metric view is canceled by the scheduler
+        m_scheduler.submit( clusteringCriteriaName, metricViewName, priority, tasks,
+                            std::bind( &PerformanceDataManager::handleMetricViewComplete, this, std::placeholders::_1,
+                                       clusteringCriteriaName, modeName, metricName, viewName, lower, upper ) );
     }
 }
 
@@ -527,33 +577,22 @@ void PerformanceDataManager::handleRequestDerivedMetricView(const QString &clust
 }
 
 /**
- * @brief PerformanceDataManager::monitorMetricViewComplete
- * @param futures - pointer to a vector of futures that this method takes ownership of (and thus needs to delete)
+ * @brief PerformanceDataManager::handleMetricViewComplete
+ * @param canceled - indicates whether the work for the metric view was canceled
  * @param clusteringCriteriaName - the name of the clustering criteria
  * @param modeName - the mode name
  * @param metricName - the name of the metric requested in the metric view
  * @param viewName - the name of the view requested in the metric view
  * @param lower - the lower value of the interval to process
  * @param upper - the upper value of the interval to process
- * 
- * This method takes the vector of futures and adds them to a future sychronizer which is used to wait for all futures to complete.
- * The vector of futures represents the work units required to complete the metric view specified by the combination of mode, metric and view names.
- * Upon completion the signal 'requestMetricViewComplete' is emitted and the cursor manager is called to indicate the operation has finished.
- * The vector of futures is destroyed.
+ *
+ * This is the completion handler for the task group of work units required to complete the metric view specified by the combination
+ * of mode, metric and view names.  It is invoked by the view task scheduler in the worker thread that finished the last work unit.
+ * Unless the work was canceled the signal 'requestMetricViewComplete' is emitted.  The cursor manager is called to indicate the operation has finished.
  */
-void PerformanceDataManager::monitorMetricViewComplete(const QVector< QFuture<void> >* futures, const QString& clusteringCriteriaName, const QString modeName, const QString metricName, const QString viewName, double lower, double upper)
+void PerformanceDataManager::handleMetricViewComplete(bool canceled, const QString& clusteringCriteriaName, const QString modeName, const QString metricName, const QString viewName, double lower, double upper)
 {
-    // initialize a future synchronizer with the set of futures required for the specified metric view
-    QFutureSynchronizer<void> synchronizer;
-
-    for ( int i=0; i<futures->size(); ++i ) {
-        synchronizer.addFuture( futures->at(i) );
-    }
-
-    // wait for the set of futures to complete
-    synchronizer.waitForFinished();
-
-    // if the user has exitted the application and cancellation of the futures caused the QFutureSynchronizer::waitForFinished() to complete,
+    // if the user has exitted the application and the work units were canceled,
     // then let's return from this method based on the state of the QApplication::closingDown() method.
     if ( qApp->closingDown() )
         return;
@@ -562,16 +601,9 @@ void PerformanceDataManager::monitorMetricViewComplete(const QVector< QFuture<vo
     const QString metricNameStr = ( viewName != CALLTREE_MODE_NAME ) ? metricName : QStringLiteral("None");
     const QString metricViewName = PerformanceDataMetricView::getMetricViewName( modeName, metricNameStr, viewName );
 
-    {
-        // delete the vector of futures instance since this method takes ownership
-        QMutexLocker guard( &m_futureMapMutex );
-
-        if ( m_futureMap.contains( clusteringCriteriaName ) ) {
-            delete m_futureMap[ clusteringCriteriaName ].take( metricViewName );
-
-            // indicate that the processing for the metric view has completed
-            emit requestMetricViewComplete( clusteringCriteriaName, modeName, metricNameStr, viewName, lower, upper );
-        }
+    if ( ! canceled ) {
+        // indicate that the processing for the metric view has completed
+        emit requestMetricViewComplete( clusteringCriteriaName, modeName, metricNameStr, viewName, lower, upper );
     }
 
     // indicate that the work associated with the generation of the metric view can be removed from monitoring by the application cursor manager
@@ -593,32 +625,45 @@ void PerformanceDataManager::monitorMetricViewComplete(const QVector< QFuture<vo
 }
 
 /**
- * @brief PerformanceDataManager::allocateFutureVector
- * @param clusteringCriteriaName
- * @param metricViewName
- * @return
+ * @brief PerformanceDataManager::getMetricViewCacheKey
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @param viewDescription - the strings describing the view (mode, metric, view name, etc)
+ * @param interval - the time interval for the view
+ * @param threadGroups - the thread groups for the view (each group is a column in the compare views)
+ * @return - the metric view cache key
+ *
+ * Build the key identifying the finished metric view in the metric view cache.  The key is derived from everything
+ * the view computation depends on other than the experiment database itself.
  */
-QVector< QFuture<void> > *PerformanceDataManager::allocateFutureVector(const QString &clusteringCriteriaName, const QString &metricViewName)
+QByteArray PerformanceDataManager::getMetricViewCacheKey(const QString &clusteringCriteriaName, const QStringList &viewDescription, const TimeInterval &interval, const QList<ThreadGroup> &threadGroups) const
 {
-    QMutexLocker guard( &m_futureMapMutex );
-
-    // if clusteringCriterianName not currently in map an entry will automatically be created
-    QMap< QString, QVector< QFuture<void> >* >& futureMap = m_futureMap[ clusteringCriteriaName ];
+    std::vector< QStringList > groupNames;
+    groupNames.reserve( threadGroups.size() );
 
-    // make sure the metric view isn't already in the map
-    if ( futureMap.contains( metricViewName ) ) {
-        qDebug() << Q_FUNC_INFO << "ERROR ENTRY EXISTS IN FUTURE MAP FOR metricViewName=" << metricViewName;
-        return Q_NULLPTR;
+    foreach ( const ThreadGroup& threadGroup, threadGroups ) {
+        QStringList names;
+        for ( ThreadGroup::const_iterator iter = threadGroup.begin(); iter != threadGroup.end(); ++iter ) {
+            names << ArgoNavis::CUDA::getUniqueClusterName( *iter );
+        }
+        names.sort();
+        groupNames.push_back( names );
     }
 
-    // create the vector of futures for this metric view
-    QVector< QFuture<void> >* futures = new QVector< QFuture<void> >();
+    // the thread groups of the compare views are built by iterating hashed sets whose order differs from process to
+    // process, so the groups are ordered by their sorted unique cluster names to keep the key stable across sessions
+    std::sort( groupNames.begin(), groupNames.end(), [](const QStringList& x, const QStringList& y)->bool {
+        return std::lexicographical_compare( x.begin(), x.end(), y.begin(), y.end() );
+    } );
+
+    QStringList threadNames;
 
-    // insert into the map
-    futureMap.insert( metricViewName, futures );
+    for ( std::vector< QStringList >::const_iterator iter = groupNames.begin(); iter != groupNames.end(); ++iter ) {
+        threadNames << *iter << QStringLiteral("|");
+    }
 
-    // return the vector
-    return futures;
+    return m_viewCache.getKey( clusteringCriteriaName, viewDescription,
+                               interval.getBegin().getValue(), interval.getEnd().getValue(),
+                               threadNames );
 }
 
 /**
@@ -711,7 +756,8 @@ void PerformanceDataManager::handleRequestLoadBalanceView(const QString &cluster
  * @param metricName - the name of the metric requested in the metric view
  * @param viewName - the name of the view requested in the metric view
  *
- * Handler for external request to produce compare view data for specified compare view.
+ * Handler for external request to produce compare view data for specified compare view.  The work unit producing the compare view
+ * is submitted to the view task scheduler.
  */
 void PerformanceDataManager::handleRequestCompareView(const QString &clusteringCriteriaName, const QString &compareMode, const QString &metricName, const QString &viewName)
 {
@@ -738,86 +784,122 @@ void PerformanceDataManager::handleRequestCompareView(const QString &clusteringC
     const Collector collector( *info.getCollectors().begin() );
     const QString collectorId( collector.getMetadata().getUniqueId().c_str() );
 
+    QList< ViewTaskScheduler::Task > tasks;
+
     if ( collectorId == "hwctime" ) {
         if ( viewName == s_functionsView ) {
-            processCompareThreadView<Function, std::map<OpenSpeedShop::Framework::StackTrace, OpenSpeedShop::Framework::HWTimeDetail>, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Function, std::map<OpenSpeedShop::Framework::StackTrace, OpenSpeedShop::Framework::HWTimeDetail>, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
         }
 
         else if ( viewName == s_statementsView ) {
-            processCompareThreadView<Statement, std::map<OpenSpeedShop::Framework::StackTrace, OpenSpeedShop::Framework::HWTimeDetail>, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Statement, std::map<OpenSpeedShop::Framework::StackTrace, OpenSpeedShop::Framework::HWTimeDetail>, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
         }
 
         else if ( viewName == s_linkedObjectsView ) {
-            processCompareThreadView<LinkedObject, std::map<OpenSpeedShop::Framework::StackTrace, OpenSpeedShop::Framework::HWTimeDetail>, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<LinkedObject, std::map<OpenSpeedShop::Framework::StackTrace, OpenSpeedShop::Framework::HWTimeDetail>, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
         }
 
         else if ( viewName == s_loopsView ) {
-            processCompareThreadView<Loop, std::map<OpenSpeedShop::Framework::StackTrace, OpenSpeedShop::Framework::HWTimeDetail>, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Loop, std::map<OpenSpeedShop::Framework::StackTrace, OpenSpeedShop::Framework::HWTimeDetail>, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
         }
     }
     else if ( collectorId == "hwcsamp" ) {
         if ( viewName == s_functionsView ) {
-            processCompareThreadView<Function, std::map<OpenSpeedShop::Framework::StackTrace, std::vector<OpenSpeedShop::Framework::HWCSampDetail>>, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Function, std::map<OpenSpeedShop::Framework::StackTrace, std::vector<OpenSpeedShop::Framework::HWCSampDetail>>, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
         }
 
         else if ( viewName == s_statementsView ) {
-            processCompareThreadView<Statement, std::map<OpenSpeedShop::Framework::StackTrace, std::vector<OpenSpeedShop::Framework::HWCSampDetail>>, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Statement, std::map<OpenSpeedShop::Framework::StackTrace, std::vector<OpenSpeedShop::Framework::HWCSampDetail>>, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
         }
 
         else if ( viewName == s_linkedObjectsView ) {
-            processCompareThreadView<LinkedObject, std::map<OpenSpeedShop::Framework::StackTrace, std::vector<OpenSpeedShop::Framework::HWCSampDetail>>, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<LinkedObject, std::map<OpenSpeedShop::Framework::StackTrace, std::vector<OpenSpeedShop::Framework::HWCSampDetail>>, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
         }
 
         else if ( viewName == s_loopsView ) {
-            processCompareThreadView<Loop, std::map<OpenSpeedShop::Framework::StackTrace, std::vector<OpenSpeedShop::Framework::HWCSampDetail>>, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Loop, std::map<OpenSpeedShop::Framework::StackTrace, std::vector<OpenSpeedShop::Framework::HWCSampDetail>>, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, COUNTER_COUNT );
         }
     }
     else if ( collectorId == "hwc" ) {
         if ( viewName == s_functionsView ) {
-            processCompareThreadView<Function, std::uint64_t, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Function, std::uint64_t, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
         }
 
         else if ( viewName == s_statementsView ) {
-            processCompareThreadView<Statement, std::uint64_t, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Statement, std::uint64_t, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
         }
 
         else if ( viewName == s_linkedObjectsView ) {
-            processCompareThreadView<LinkedObject, std::uint64_t, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<LinkedObject, std::uint64_t, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
         }
 
         else if ( viewName == s_loopsView ) {
-            processCompareThreadView<Loop, std::uint64_t, qulonglong>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Loop, std::uint64_t, qulonglong>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
         }
     }
     else {
         if ( viewName == s_functionsView ) {
-            processCompareThreadView<Function, double, double>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Function, double, double>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
         }
 
         else if ( viewName == s_statementsView ) {
-            processCompareThreadView<Statement, double, double>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Statement, double, double>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
         }
 
         else if ( viewName == s_linkedObjectsView ) {
-            processCompareThreadView<LinkedObject, double, double>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<LinkedObject, double, double>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
         }
 
         else if ( viewName == s_loopsView ) {
-            processCompareThreadView<Loop, double, double>( info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
+            tasks << std::bind( &PerformanceDataManager::processCompareThreadView<Loop, double, double>, this, info.getCollectors(), info.getThreads(), interval, clusteringCriteriaName, metricName, compareMode, TIME_UNIT_MSEC );
         }
     }
 
     // Determine full time interval extent of this experiment
-    Extent extent = info.getExtent();
-    Base::TimeInterval experimentInterval = ConvertToArgoNavis( extent.getTimeInterval() );
+    const Extent extent = info.getExtent();
+    const Base::TimeInterval experimentInterval = ConvertToArgoNavis( extent.getTimeInterval() );
 
-    Base::TimeInterval graphInterval = ConvertToArgoNavis( interval );
+    const Base::TimeInterval graphInterval = ConvertToArgoNavis( interval );
 
-    double lower = ( graphInterval.begin() - experimentInterval.begin() ) / 1000000.0;
-    double upper = ( graphInterval.end() - experimentInterval.begin() ) / 1000000.0;
+    const double lower = ( graphInterval.begin() - experimentInterval.begin() ) / 1000000.0;
+    const double upper = ( graphInterval.end() - experimentInterval.begin() ) / 1000000.0;
 
-    emit requestMetricViewComplete( clusteringCriteriaName, compareMode, metricName, viewName, lower, upper );
+    // any work still in progress for an earlier request of this compare view is canceled by the scheduler
+    m_scheduler.submit( clusteringCriteriaName, compareViewName, ViewTaskScheduler::VisiblePriority, tasks,
+                        std::bind( &PerformanceDataManager::handleCompareViewComplete, this, std::placeholders::_1,
+                                   clusteringCriteriaName, compareMode, metricName, viewName, lower, upper ) );
+}
 
+/**
+ * @brief PerformanceDataManager::handleCompareViewComplete
+ * @param canceled - indicates whether the work for the compare view was canceled
+ * @param clusteringCriteriaName - the name of the clustering criteria
+ * @param compareMode - the specific compare mode requested
+ * @param metricName - the name of the metric requested in the compare view
+ * @param viewName - the name of the view requested in the compare view
+ * @param lower - the lower value of the interval to process
+ * @param upper - the upper value of the interval to process
+ *
+ * This is the completion handler for the task group generating the compare view.  It is invoked by the view task scheduler
+ * in the worker thread that finished the work.  Unless the work was canceled the signal 'requestMetricViewComplete' is emitted.
+ * The cursor manager is called to indicate the operation has finished.
+ */
+void PerformanceDataManager::handleCompareViewComplete(bool canceled, const QString &clusteringCriteriaName, const QString compareMode, const QString metricName, const QString viewName, double lower, double upper)
+{
+    // if the user has exitted the application and the work units were canceled,
+    // then let's return from this method based on the state of the QApplication::closingDown() method.
+    if ( qApp->closingDown() )
+        return;
+
+    if ( ! canceled ) {
+        // indicate that the processing for the compare view has completed
+        emit requestMetricViewComplete( clusteringCriteriaName, compareMode, metricName, viewName, lower, upper );
+    }
+
+    const QString compareViewName = compareMode + QStringLiteral("-") + metricName + QStringLiteral("-") + viewName;
+
+    // indicate that the work associated with the generation of the compare view can be removed from monitoring by the application cursor manager
+    ApplicationOverrideCursorManager* cursorManager = ApplicationOverrideCursorManager::instance();
     if ( cursorManager ) {
         cursorManager->finishWaitingOperation( QString("generate-%1").arg(compareViewName) );
     }
@@ -1018,28 +1100,26 @@ void PerformanceDataManager::handleRequestTraceView(const QString &clusteringCri
 
         const QString metricViewName = PerformanceDataMetricView::getMetricViewName( TRACE_EVENT_DETAILS_METRIC, metric, viewName );
 
-        QVector< QFuture<void> >* futures = allocateFutureVector( clusteringCriteriaName, metricViewName );
-
-        if ( ! futures )
-            return;
+        QList< ViewTaskScheduler::Task > tasks;
 
         cursorManager->startWaitingOperation( QString("generate-%1").arg(metricViewName) );
 
         if ( collectorId == "mpit" ) {
-            futures->append( QtConcurrent::run( std::bind( &PerformanceDataManager::ShowTraceDetail< std::vector<Framework::MPITDetail> >, this,
-                                                clusteringCriteriaNameStr, collector, threadGroup, time_origin, lower, upper, interval, functions, metric ) ) );
+            tasks << std::bind( &PerformanceDataManager::ShowTraceDetail< std::vector<Framework::MPITDetail> >, this,
+                                clusteringCriteriaNameStr, collector, threadGroup, time_origin, lower, upper, interval, functions, metric );
         }
         else if ( collectorId == "mem" ) {
-            futures->append( QtConcurrent::run( std::bind( &PerformanceDataManager::ShowTraceDetail< std::vector<Framework::MemDetail> >, this,
-                                                clusteringCriteriaNameStr, collector, threadGroup, time_origin, lower, upper, interval, functions, metric ) ) );
+            tasks << std::bind( &PerformanceDataManager::ShowTraceDetail< std::vector<Framework::MemDetail> >, this,
+                                clusteringCriteriaNameStr, collector, threadGroup, time_origin, lower, upper, interval, functions, metric );
         }
         else if ( collectorId == "iot" ) {
-            futures->append( QtConcurrent::run( std::bind( &PerformanceDataManager::ShowTraceDetail< std::vector<Framework::IOTDetail> >, this,
-                                                clusteringCriteriaNameStr, collector, threadGroup, time_origin, lower, upper, interval, functions, metric ) ) );
+            tasks << std::bind( &PerformanceDataManager::ShowTraceDetail< std::vector<Framework::IOTDetail> >, this,
+                                clusteringCriteriaNameStr, collector, threadGroup, time_origin, lower, upper, interval, functions, metric );
         }
 
-        QtConcurrent::run( boost::bind( &PerformanceDataManager::monitorMetricViewComplete, this,
-                                        futures, clusteringCriteriaName, TRACE_EVENT_DETAILS_METRIC, metric, viewName, lower, upper ) );
+        m_scheduler.submit( clusteringCriteriaName, metricViewName, ViewTaskScheduler::VisiblePriority, tasks,
+                            std::bind( &PerformanceDataManager::handleMetricViewComplete, this, std::placeholders::_1,
+                                       clusteringCriteriaName, TRACE_EVENT_DETAILS_METRIC, metric, viewName, lower, upper ) );
     }
 }
 
@@ -1133,10 +1213,7 @@ void PerformanceDataManager::handleLoadCudaMetricViews(const QString &clustering
     if ( ! m_tableViewInfo.contains( clusteringCriteriaName ) || lower >= upper )
         return;
 
-    // cancel any active processing for this cluster
-    m_userChangeMgr.cancel( clusterName );
-
-    // initiate a new timed monitor for this cluster
+    // record the latest range for this cluster (coalesced with any pending change)
     m_userChangeMgr.create( clusteringCriteriaName, clusterName, lower, upper, size );
 }
 
@@ -1814,66 +1891,122 @@ void PerformanceDataManager::processCompareThreadView(const CollectorGroup& coll
     std::string metricStr = std::string( metric.toLatin1().data() );
 #endif
 
-    QStringList metricDesc;
-    metricDesc << s_functionTitle;
+    // the finished metric view is read from the metric view cache or computed and added to the cache if a cache is
+    // registered for the experiment database
+    const bool cacheEnabled = m_viewCache.hasDatabase( clusteringCriteriaName );
+    const QByteArray cacheKey = cacheEnabled ? getMetricViewCacheKey( clusteringCriteriaName, QStringList() << compareMode << metric << viewName << columnUnits, interval, threadGroupList ) : QByteArray();
 
-    QMap< TS, QVariantList > metricData;
+    MetricViewCache::Entry cacheEntry;
 
-    SmartPtr<std::map<TS, std::map<Thread, TM> > > individual;
+    if ( cacheEnabled && m_viewCache.lookup( clusteringCriteriaName, cacheKey, cacheEntry ) ) {
+        emit addMetricView( clusteringCriteriaName, compareMode, metric, viewName, cacheEntry.columnHeaders );
+
+        foreach ( const MetricViewDataBlock& block, cacheEntry.blocks ) {
+            emit addMetricViewDataBlock( clusteringCriteriaName, compareMode, metric, viewName, block );
+        }
+
+        return;
+    }
+
+    const ViewTaskCancellationToken token = ViewTaskCancellationToken::current();
+
+    const int groupCount = threadGroupList.size();
+
+    // summation of the metric values for each thread group - the queries for the thread groups are independent
+    // and are run concurrently by a bounded number of tasks each taking every n-th thread group
+    std::vector< std::map< TS, TM > > groupData( groupCount );
+
+    const int taskCount = qMin( qMax( QThread::idealThreadCount(), 1 ), groupCount );
+
+    QFutureSynchronizer<void> synchronizer;
+
+    for ( int task=1; task<taskCount; ++task ) {
+        synchronizer.addFuture( QtConcurrent::run( boost::bind( &PerformanceDataManager::processCompareThreadGroups<TS, TM>, this,
+                                                                collector, metricStr, interval, &threadGroupList, &groupData, token, task, taskCount ) ) );
+    }
+
+    // the calling thread takes a share of the thread groups as well
+    if ( taskCount > 0 ) {
+        processCompareThreadGroups<TS, TM>( collector, metricStr, interval, &threadGroupList, &groupData, token, 0, taskCount );
+    }
+
+    synchronizer.waitForFinished();
+
+    if ( token.isCanceled() )
+        return;
+
+    // assign each TS a row of the dense matrix in TS order
+    std::map< TS, int > rowIndexes;
+
+    for ( int column=0; column<groupCount; ++column ) {
+        const std::map< TS, TM >& data( groupData[ column ] );
+        for ( typename std::map< TS, TM >::const_iterator i = data.begin(); i != data.end(); ++i ) {
+            rowIndexes.insert( std::make_pair( i->first, 0 ) );
+        }
+    }
+
+    int rowCount( 0 );
+
+    for ( typename std::map< TS, int >::iterator i = rowIndexes.begin(); i != rowIndexes.end(); ++i ) {
+        i->second = rowCount++;
+    }
 
     const DT NULL_VALUE( getMetricValue( 0.0 ) );
     const DT factor( getMetricValue( columnUnits == TIME_UNIT_MSEC ? 1000.0 : 1.0 ) );
-    int count(0);
 
-    for ( QList< ThreadGroup >::iterator titer = threadGroupList.begin(); titer != threadGroupList.end(); ++titer, ++count ) {
-        // make thread group with just the current thread
-        ThreadGroup threads( *titer );
-        // get metric values
-        Queries::GetMetricValues( collector,
-                                  metricStr,
-                                  interval,
-                                  threads,
-                                  getThreadSet<TS>( threads ),
-                                  individual );
+    // dense row-major matrix with a row for each TS and a column for each thread group - TS absent from a group have the null value
+    std::vector< DT > matrix( static_cast< std::size_t >( rowCount ) * groupCount, NULL_VALUE );
 
-        // compute summation
-        SmartPtr<std::map<TS, TM> > data = Queries::Reduction::Apply( individual, Queries::Reduction::Summation );
-
-        // reset individual data
-        individual = SmartPtr<std::map<TS, std::map<Thread, TM> > >();
+    QStringList metricDesc;
+    metricDesc << s_functionTitle;
 
-        // organize into rows by TS with columns for each threads value
-        for( typename std::map<TS, TM>::const_iterator i = data->begin(); i != data->end(); ++i ) {
-            // get reference to QVariantList corresponding to TS
-            QVariantList& vdata = metricData[ i->first ];
-            if ( vdata.empty() ) {
-                // add location information based on TS at the end
-                vdata << getLocationInfo<TS>( i->first );
-            }
-            // fill in null values for each thread not containing TS
-            while ( vdata.size() < count+1 ) {
-                vdata << NULL_VALUE;
-            }
+    for ( int column=0; column<groupCount; ++column ) {
+        const std::map< TS, TM >& data( groupData[ column ] );
+        for ( typename std::map< TS, TM >::const_iterator i = data.begin(); i != data.end(); ++i ) {
             // scale value to milliseconds
-            const DT value( getMetricValue( i->second ) * factor );
-            // add actual value
-            vdata << value;
+            matrix[ static_cast< std::size_t >( rowIndexes[ i->first ] ) * groupCount + column ] = getMetricValue( i->second ) * factor;
         }
 
         // add column header values
-        const QString columnName = getColumnNameForCompareView( compareMode, *(threads.begin()) );
+        const QString columnName = getColumnNameForCompareView( compareMode, *(threadGroupList[ column ].begin()) );
         metricDesc << tr("%1 %2").arg(columnName).arg(columnUnits);
     }
 
+    // release the per group data
+    std::vector< std::map< TS, TM > >().swap( groupData );
+
     emit addMetricView( clusteringCriteriaName, compareMode, metric, viewName, metricDesc );
 
-    for ( typename QMap< TS, QVariantList >::iterator i = metricData.begin(); i != metricData.end(); ++i ) {
-        QVariantList& data = i.value();
-        // fill in null values for each thread not containing TS
-        while ( data.size() < count+1 ) {
-            data << NULL_VALUE;
+    MetricViewDataBlock block;
+
+    for ( typename std::map< TS, int >::const_iterator i = rowIndexes.begin(); i != rowIndexes.end(); ++i ) {
+        QVariantList data;
+        data.reserve( groupCount + 1 );
+        // add location information based on TS as the first column
+        data << getLocationInfo<TS>( i->first );
+        const DT* values = &matrix[ static_cast< std::size_t >( i->second ) * groupCount ];
+        for ( int column=0; column<groupCount; ++column ) {
+            data << values[ column ];
+        }
+        block.appendRow( data );
+        if ( block.isFull() ) {
+            emit addMetricViewDataBlock( clusteringCriteriaName, compareMode, metric, viewName, block );
+            // the blocks already emitted make up the cache entry
+            if ( cacheEnabled )
+                cacheEntry.blocks << block;
+            block.clear();
         }
-        emit addMetricViewData( clusteringCriteriaName, compareMode, metric, viewName, data );
+    }
+
+    if ( ! block.isEmpty() ) {
+        emit addMetricViewDataBlock( clusteringCriteriaName, compareMode, metric, viewName, block );
+        if ( cacheEnabled )
+            cacheEntry.blocks << block;
+    }
+
+    if ( cacheEnabled ) {
+        cacheEntry.columnHeaders = metricDesc;
+        m_viewCache.insert( clusteringCriteriaName, cacheKey, cacheEntry );
     }
 
 #if defined(HAS_PARALLEL_PROCESS_METRIC_VIEW_DEBUG)
@@ -1881,6 +2014,53 @@ void PerformanceDataManager::processCompareThreadView(const CollectorGroup& coll
 #endif
 }
 
+/**
+ * @brief PerformanceDataManager::processCompareThreadGroups
+ * @param collector - the collector of the metric
+ * @param metric - the metric to generate data for
+ * @param interval - the time interval of interest
+ * @param threadGroupList - the list of thread groups (a column of the compare view for each thread group)
+ * @param results - the summation of the metric values over the threads of each thread group
+ * @param token - the cancellation token of the compare view work
+ * @param first - the index of the first thread group processed
+ * @param stride - the distance between the thread groups processed
+ *
+ * Query the metric values and compute the summation over the threads for every stride-th thread group beginning at the first thread group.
+ * Each invocation only writes the results of its own thread groups.
+ */
+template<typename TS, typename TM>
+void PerformanceDataManager::processCompareThreadGroups(const Collector& collector,
+                                                        const std::string& metric,
+                                                        const TimeInterval& interval,
+                                                        const QList< ThreadGroup >* threadGroupList,
+                                                        std::vector< std::map< TS, TM > >* results,
+                                                        const ViewTaskCancellationToken token,
+                                                        int first,
+                                                        int stride)
+{
+    for ( int i=first; i<threadGroupList->size(); i+=stride ) {
+        if ( token.isCanceled() )
+            return;
+
+        const ThreadGroup& threads( threadGroupList->at( i ) );
+
+        SmartPtr<std::map<TS, std::map<Thread, TM> > > individual;
+
+        // get metric values
+        Queries::GetMetricValues( collector,
+                                  metric,
+                                  interval,
+                                  threads,
+                                  getThreadSet<TS>( threads ),
+                                  individual );
+
+        // compute summation
+        SmartPtr<std::map<TS, TM> > data = Queries::Reduction::Apply( individual, Queries::Reduction::Summation );
+
+        (*results)[ i ].swap( *data );
+    }
+}
+
 /**
  * @brief PerformanceDataManager::processMetricView
  * @param clusteringCriteriaName - the name of the clustering criteria
@@ -1943,35 +2123,57 @@ void PerformanceDataManager::processMetricView(const QString clusteringCriteriaN
 
     const QString viewName = getViewName<TS>();
 
-    // Evaluate the first collector's time metric for all functions
-    SmartPtr<std::map<TS, std::map<Thread, TM> > > individual;
+    const QString METRIC_MODE_VIEW = QStringLiteral("Metric");
+
+    // the work for the metric view is abandoned when the view is requested again or the experiment is unloaded
+    const ViewTaskCancellationToken token = ViewTaskCancellationToken::current();
+
+    // the finished metric view is read from the metric view cache or computed and added to the cache if a cache is
+    // registered for the experiment database
+    const bool cacheEnabled = m_viewCache.hasDatabase( clusteringCriteriaName );
+    const QByteArray cacheKey = cacheEnabled ? getMetricViewCacheKey( clusteringCriteriaName, QStringList() << METRIC_MODE_VIEW << metric << viewName, interval, QList< ThreadGroup >() << threadGroup ) : QByteArray();
+
+    MetricViewCache::Entry cacheEntry;
+
+    const bool cached = cacheEnabled && m_viewCache.lookup( clusteringCriteriaName, cacheKey, cacheEntry );
+
+    MetricReductionResult<TS, Thread, TM> data;
+    std::multimap<TM, std::size_t> sorted;
+    TM total( 0 );
+    QStringList items;
+
+    if ( cached ) {
+        items = cacheEntry.attributes.value( QStringLiteral("items") ).toStringList();
+    }
+    else {
+        // Evaluate the first collector's time metric for all functions
+        SmartPtr<std::map<TS, std::map<Thread, TM> > > individual;
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
-    std::string metricStr = metric.toStdString();
+        std::string metricStr = metric.toStdString();
 #else
-    std::string metricStr = std::string( metric.toLatin1().data() );
+        std::string metricStr = std::string( metric.toLatin1().data() );
 #endif
-    Queries::GetMetricValues( collector,
-                              metricStr,
-                              interval,
-                              threadGroup,
-                              getThreadSet<TS>( threadGroup ),
-                              individual );
-    SmartPtr<std::map<TS, TM> > data =
-            Queries::Reduction::Apply( individual, Queries::Reduction::Summation );
-    SmartPtr<std::map<TS, TM> > dataMin =
-            Queries::Reduction::Apply( individual, Queries::Reduction::Minimum );
-    SmartPtr<std::map<TS, TM> > dataMax =
-            Queries::Reduction::Apply( individual, Queries::Reduction::Maximum );
-    SmartPtr<std::map<TS, TM> > dataMean =
-            Queries::Reduction::Apply( individual, Queries::Reduction::ArithmeticMean );
-    individual = SmartPtr<std::map<TS, std::map<Thread, TM> > >();
-
-    // Sort the results
-    std::multimap<TM, TS> sorted;
-    TM total( 0 );
-    for( typename std::map<TS, TM>::const_iterator i = data->begin(); i != data->end(); ++i ) {
-        sorted.insert(std::make_pair(i->second, i->first));
-        total += i->second;
+        Queries::GetMetricValues( collector,
+                                  metricStr,
+                                  interval,
+                                  threadGroup,
+                                  getThreadSet<TS>( threadGroup ),
+                                  individual );
+        if ( token.isCanceled() )
+            return;
+        // compute sum, minimum, maximum and mean for all TS items in one pass
+        reduceMetricValues( *individual, data );
+        individual = SmartPtr<std::map<TS, std::map<Thread, TM> > >();
+
+        // Sort the results
+        for( std::size_t i=0; i<data.size(); ++i ) {
+            sorted.insert(std::make_pair(data.sum[i], i));
+            total += data.sum[i];
+        }
+
+        for ( typename std::multimap<TM, std::size_t>::reverse_iterator i = sorted.rbegin(); i != sorted.rend(); ++i ) {
+            items << getLocationInfo<TS>( data.keys[i->second] );
+        }
     }
 
     // Display the results
@@ -1984,8 +2186,6 @@ void PerformanceDataManager::processMetricView(const QString clusteringCriteriaN
               << std::endl;
 #endif
 
-    const QString METRIC_MODE_VIEW = QStringLiteral("Metric");
-
     emit addMetricView( clusteringCriteriaName, METRIC_MODE_VIEW, metric, viewName, metricDesc );
 
     // get collector type
@@ -1995,12 +2195,6 @@ void PerformanceDataManager::processMetricView(const QString clusteringCriteriaN
     const bool emitGraphItem( s_METRIC_GRAPH_VIEWS.contains( collectorId ) );
 
     if ( emitGraphItem ) {
-        QStringList items;
-
-        for ( typename std::multimap<TM, TS>::reverse_iterator i = sorted.rbegin(); i != sorted.rend(); ++i ) {
-            items << getLocationInfo<TS>( i->second );
-        }
-
         QString graphTitle;
 
         if ( s_TRACING_EXPERIMENTS_GRAPH_TITLES.contains( collectorId ) && s_TRACING_EXPERIMENTS_GRAPH_TITLES[ collectorId ].contains( metric ) ) {
@@ -2012,17 +2206,61 @@ void PerformanceDataManager::processMetricView(const QString clusteringCriteriaN
 
     int index( 0 );
 
-    for ( typename std::multimap<TM, TS>::reverse_iterator i = sorted.rbegin(); i != sorted.rend(); ++i ) {
+    if ( cached ) {
+        foreach ( const MetricViewDataBlock& block, cacheEntry.blocks ) {
+            if ( token.isCanceled() )
+                return;
+
+            emit addMetricViewDataBlock( clusteringCriteriaName, METRIC_MODE_VIEW, metric, viewName, block );
+
+            if ( emitGraphItem && block.columnCount() == metricDesc.size() && block.columnCount() > 2 ) {
+                for ( int row=0; row<block.rowCount(); ++row ) {
+                    emit addGraphItem( metric, viewName, metricDesc[0], index++, block.value( row, 0 ).toDouble() );
+                }
+            }
+        }
+
+        return;
+    }
+
+    MetricViewDataBlock block;
+    int item( 0 );
 
-        QVariantList metricData = getMetricValues( getLocationInfo<TS>( i->second ), i->first, total, dataMin->at(i->second), dataMax->at(i->second), dataMean->at(i->second) );
+    for ( typename std::multimap<TM, std::size_t>::reverse_iterator i = sorted.rbegin(); i != sorted.rend(); ++i ) {
 
-        emit addMetricViewData( clusteringCriteriaName, METRIC_MODE_VIEW, metric, viewName, metricData );
+        const std::size_t n = i->second;
+
+        QVariantList metricData = getMetricValues( items.at( item++ ), i->first, total, data.minimum[n], data.maximum[n], data.mean[n] );
+
+        block.appendRow( metricData );
+
+        if ( block.isFull() ) {
+            if ( token.isCanceled() )
+                return;
+            emit addMetricViewDataBlock( clusteringCriteriaName, METRIC_MODE_VIEW, metric, viewName, block );
+            // the blocks already emitted make up the cache entry
+            if ( cacheEnabled )
+                cacheEntry.blocks << block;
+            block.clear();
+        }
 
         if ( emitGraphItem && metricData.size() == metricDesc.size() && metricData.size() > 2 ) {
             emit addGraphItem( metric, viewName, metricDesc[0], index++, metricData[0].toDouble() );
         }
     }
 
+    if ( ! block.isEmpty() ) {
+        emit addMetricViewDataBlock( clusteringCriteriaName, METRIC_MODE_VIEW, metric, viewName, block );
+        if ( cacheEnabled )
+            cacheEntry.blocks << block;
+    }
+
+    if ( cacheEnabled ) {
+        cacheEntry.columnHeaders = metricDesc;
+        cacheEntry.attributes[ QStringLiteral("items") ] = items;
+        m_viewCache.insert( clusteringCriteriaName, cacheKey, cacheEntry );
+    }
+
 #if defined(HAS_PARALLEL_PROCESS_METRIC_VIEW_DEBUG)
     qDebug() << "PerformanceDataManager::processMetricView FINISHED" << metric;
 #endif
@@ -2060,6 +2298,25 @@ void PerformanceDataManager::processLoadBalanceView(const CollectorGroup& collec
     const QString viewName = getViewName<TS>();
     const Collector collector( *collectors.begin() );
 
+    const QString LOAD_BALANCE_MODE_VIEW = QStringLiteral("Load Balance");
+
+    // the finished metric view is read from the metric view cache or computed and added to the cache if a cache is
+    // registered for the experiment database
+    const bool cacheEnabled = m_viewCache.hasDatabase( clusteringCriteriaName );
+    const QByteArray cacheKey = cacheEnabled ? getMetricViewCacheKey( clusteringCriteriaName, QStringList() << LOAD_BALANCE_MODE_VIEW << metric << viewName, interval, QList< ThreadGroup >() << threadGroup ) : QByteArray();
+
+    MetricViewCache::Entry cacheEntry;
+
+    if ( cacheEnabled && m_viewCache.lookup( clusteringCriteriaName, cacheKey, cacheEntry ) ) {
+        emit addMetricView( clusteringCriteriaName, LOAD_BALANCE_MODE_VIEW, metric, viewName, metricDesc );
+
+        foreach ( const MetricViewDataBlock& block, cacheEntry.blocks ) {
+            emit addMetricViewDataBlock( clusteringCriteriaName, LOAD_BALANCE_MODE_VIEW, metric, viewName, block );
+        }
+
+        return;
+    }
+
     // Evaluate the first collector's time metric for all functions
     SmartPtr<std::map<TS, std::map<Thread, TM> > > individual;
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
@@ -2075,70 +2332,55 @@ void PerformanceDataManager::processLoadBalanceView(const CollectorGroup& collec
                               getThreadSet<TS>( threadGroup ),
                               individual );
 
-    SmartPtr< std::map< TS, TM > > dataMin =
-            Queries::Reduction::Apply( individual, Queries::Reduction::Minimum );
-    SmartPtr< std::map< TS, TM > > dataMax =
-            Queries::Reduction::Apply( individual, Queries::Reduction::Maximum );
-    SmartPtr<std::map<TS, TM> > dataMean =
-            Queries::Reduction::Apply( individual, Queries::Reduction::ArithmeticMean );
-
-    std::map< TS, Thread > minimumThreads;
-    std::map< TS, Thread > maximumThreads;
-    std::map< TS, Thread > meanThreads;
-
-    // find thread exhbiting the minimum and maximum times for each TS item
-    for( typename std::map< TS, std::map<Thread, TM > >::const_iterator i = individual->begin(); i != individual->end(); ++i ) {
-        const std::map<Thread, TM>& threadMetricMap = i->second;
-        const TM min( dataMin->at( i->first ) );
-        const TM max( dataMax->at( i->first ) );
-        const TM mean( dataMean->at( i->first ) );
-        TM diff( std::numeric_limits< TM >::max() );
-        typename std::map< Thread, TM >::const_iterator miter = threadMetricMap.begin();
-        for( typename std::map< Thread, TM >::const_iterator titer = threadMetricMap.begin(); titer != threadMetricMap.end(); ++titer ) {
-            if ( min == titer->second ) {
-                minimumThreads.insert( std::make_pair( i->first, titer->first ) );
-            }
-            if ( max == titer->second ) {
-                maximumThreads.insert( std::make_pair( i->first, titer->first ) );
-            }
-            const double temp_diff = std::fabs( mean - titer->second );
-            if ( temp_diff < diff ) {
-                miter = titer;
-                diff = temp_diff;
-            }
-        }
-        meanThreads.insert( std::make_pair( i->first, miter->first ) );
-    }
-
-    // reset the individual instance
-    individual = SmartPtr<std::map< TS, std::map< Thread, TM > > >();
-
-    // Sort the results
-    std::multimap< TM, TS > sorted;
-    for( typename std::map< TS, TM >::const_iterator i = dataMax->begin(); i != dataMax->end(); ++i ) {
-        sorted.insert( std::make_pair( i->second, i->first ) );
-    }
+    // compute minimum, maximum and mean for all TS items and find the threads exhibiting the minimum and maximum
+    // values and the value closest to the mean in one pass
+    MetricReductionResult< TS, Thread, TM > data;
+    reduceMetricValues( *individual, data, true );
 
-    emit addMetricView( clusteringCriteriaName, QStringLiteral("Load Balance"), metric, viewName, metricDesc );
+    emit addMetricView( clusteringCriteriaName, LOAD_BALANCE_MODE_VIEW, metric, viewName, metricDesc );
 
     const DT factor = ( metricDesc.contains( s_minimumTitle ) ) ? 1000 : 1;
 
-    for( typename std::map< TS, TM >::const_iterator i = dataMax->begin(); i != dataMax->end(); ++i ) {
+    MetricViewDataBlock block;
+
+    for( std::size_t i=0; i<data.size(); ++i ) {
         QVariantList metricData;
 
-        const DT max( i->second * factor );
-        const DT min( dataMin->at( i->first ) * factor );
-        const DT mean( dataMean->at( i->first ) * factor );
+        const DT max( data.maximum[i] * factor );
+        const DT min( data.minimum[i] * factor );
+        const DT mean( data.mean[i] * factor );
 
         metricData << max;
-        metricData << ArgoNavis::CUDA::getUniqueClusterName( maximumThreads.at( i->first ) );
+        metricData << ( data.maximumThread[i] ? ArgoNavis::CUDA::getUniqueClusterName( *data.maximumThread[i] ) : QString() );
         metricData << min;
-        metricData << ArgoNavis::CUDA::getUniqueClusterName( minimumThreads.at( i->first ) );
+        metricData << ( data.minimumThread[i] ? ArgoNavis::CUDA::getUniqueClusterName( *data.minimumThread[i] ) : QString() );
         metricData << mean;
-        metricData << ArgoNavis::CUDA::getUniqueClusterName( meanThreads.at( i->first ) );
-        metricData << getLocationInfo<TS>( i->first );
+        metricData << ( data.meanThread[i] ? ArgoNavis::CUDA::getUniqueClusterName( *data.meanThread[i] ) : QString() );
+        metricData << getLocationInfo<TS>( data.keys[i] );
+
+        block.appendRow( metricData );
 
-        emit addMetricViewData( clusteringCriteriaName, QStringLiteral("Load Balance"), metric, viewName, metricData );
+        if ( block.isFull() ) {
+            emit addMetricViewDataBlock( clusteringCriteriaName, LOAD_BALANCE_MODE_VIEW, metric, viewName, block );
+            // the blocks already emitted make up the cache entry
+            if ( cacheEnabled )
+                cacheEntry.blocks << block;
+            block.clear();
+        }
+    }
+
+    if ( ! block.isEmpty() ) {
+        emit addMetricViewDataBlock( clusteringCriteriaName, LOAD_BALANCE_MODE_VIEW, metric, viewName, block );
+        if ( cacheEnabled )
+            cacheEntry.blocks << block;
+    }
+
+    // reset the individual instance only now as the minimum, maximum and mean threads of the reduction refer into it
+    individual = SmartPtr<std::map< TS, std::map< Thread, TM > > >();
+
+    if ( cacheEnabled ) {
+        cacheEntry.columnHeaders = metricDesc;
+        m_viewCache.insert( clusteringCriteriaName, cacheKey, cacheEntry );
     }
 
 #if defined(HAS_PARALLEL_PROCESS_METRIC_VIEW_DEBUG)
@@ -2375,17 +2617,14 @@ void PerformanceDataManager::loadDefaultViews(const QString &filePath)
         // Initially all default metric views are computed using all threads.  Set the set of threads for the
         // current clustering criteria to be all threads.
 
+        // index the threads once - the selected threads and the compare view partitions are found from the index
+        QSharedPointer< ThreadGroupIndex > threadIndex( new ThreadGroupIndex( group ) );
+
         QSet< QString> selected;
         int rankCount = 0;
-        for ( ThreadGroup::iterator iter = group.begin(); iter != group.end(); ++iter ) {
-            const Thread thread( *iter );
-            int rank;
-            bool valid;
-            std::tie(valid,rank) = thread.getMPIRank();
-            if ( valid && rank > rankCount ) {
-                rankCount = rank;
-            }
-            selected.insert( ArgoNavis::CUDA::getUniqueClusterName( thread ) );
+        for ( int i=0; i<threadIndex->size(); ++i ) {
+            rankCount = qMax( rankCount, threadIndex->rank( i ) );
+            selected.insert( threadIndex->clusterName( i ) );
         }
         rankCount++;
 
@@ -2399,12 +2638,17 @@ void PerformanceDataManager::loadDefaultViews(const QString &filePath)
             QMutexLocker guard( &m_mutex );
 
             m_selectedClusters[ clusteringCriteriaName ] = selected;
+            m_threadGroupIndexes[ clusteringCriteriaName ] = threadIndex;
         }
 
         MetricTableViewInfo info( experiment, interval, metricList );
 
         m_tableViewInfo.insert( clusteringCriteriaName, info );
 
+#if defined(HAS_METRIC_VIEW_CACHE)
+        m_viewCache.setDatabase( clusteringCriteriaName, experimentFilename );
+#endif
+
         QVector< QString > clusterNames;
         foreach( const QString& clusterName, selected ) {
             clusterNames << clusterName;
@@ -2421,7 +2665,10 @@ void PerformanceDataManager::loadDefaultViews(const QString &filePath)
         foreach ( const QString& metricName, metricList ) {
             m_numberLoadWorkUnitsInProgress.ref();
 
-            handleRequestMetricView( clusteringCriteriaName, metricName, s_functionsView );
+            // the view for the first metric is shown initially - the others are computed in advance
+            const ViewTaskScheduler::Priority priority = ( metricName == metricList.first() ) ? ViewTaskScheduler::VisiblePriority : ViewTaskScheduler::PrefetchPriority;
+
+            requestMetricView( clusteringCriteriaName, metricName, s_functionsView, priority );
         }
 
         if ( hasCudaCollector ) {
@@ -2512,7 +2759,7 @@ void PerformanceDataManager::handleLoadCudaMetricViewsTimeout(const QString& clu
             handleRequestLoadBalanceView( clusteringCriteriaName, tokens[1], tokens[2] );
         }
         else {
-            handleRequestMetricView( clusteringCriteriaName, tokens[1], tokens[2] );
+            requestMetricView( clusteringCriteriaName, tokens[1], tokens[2], ViewTaskScheduler::RefreshPriority );
         }
     }
 }
@@ -2532,6 +2779,9 @@ void PerformanceDataManager::handleSelectedClustersChanged(const QString &criter
         m_selectedClusters[ criteriaName ] = selected;
     }
 
+    // any work in progress was for the previous set of selected clusters
+    m_scheduler.cancelAll( criteriaName );
+
     emit signalRequestMetricTableViewUpdate( true );
 }
 
@@ -2564,7 +2814,7 @@ void PerformanceDataManager::handleLoadComplete()
 
 /**
  * @brief PerformanceDataManager::loadCudaMetricViews
- * @param futures - the vector of futures used to store futures returned from invoking QtConcurrent::run
+ * @param tasks - the list of work units to be run by the view task scheduler
  * @param clusteringCriteriaName - the clustering criteria name
  * @param metricList - the list of metrics to process and add to metric view
  * @param viewList - the list of views to process and add to the metric view
@@ -2572,7 +2822,7 @@ void PerformanceDataManager::handleLoadComplete()
  * Process the specified metric views.
  */
 void PerformanceDataManager::loadCudaMetricViews(
-        QVector< QFuture<void> >& futures,
+        QList< ViewTaskScheduler::Task >& tasks,
         const QString& clusteringCriteriaName,
         const QStringList& metricList,
         const QStringList& viewList)
@@ -2581,50 +2831,42 @@ void PerformanceDataManager::loadCudaMetricViews(
         foreach ( QString viewName, viewList ) {
             if ( viewName == s_functionsView ) {
                 if ( metricName == QStringLiteral("overflows") )
-                    futures << QtConcurrent::run(
-                                boost::bind( &PerformanceDataManager::processMetricView<std::uint64_t, Function>, this,
-                                             clusteringCriteriaName, metricName ) );
+                    tasks << boost::bind( &PerformanceDataManager::processMetricView<std::uint64_t, Function>, this,
+                                          clusteringCriteriaName, metricName );
                 else
-                    futures << QtConcurrent::run(
-                                boost::bind( &PerformanceDataManager::processMetricView<double, Function>, this,
-                                             clusteringCriteriaName, metricName ) );
+                    tasks << boost::bind( &PerformanceDataManager::processMetricView<double, Function>, this,
+                                          clusteringCriteriaName, metricName );
             }
 
             else if ( viewName == s_statementsView ) {
                 if ( metricName == QStringLiteral("overflows") )
-                    futures << QtConcurrent::run(
-                                boost::bind( &PerformanceDataManager::processMetricView<std::uint64_t, Statement>, this,
-                                             clusteringCriteriaName, metricName ) );
+                    tasks << boost::bind( &PerformanceDataManager::processMetricView<std::uint64_t, Statement>, this,
+                                          clusteringCriteriaName, metricName );
                 else
-                    futures << QtConcurrent::run(
-                                boost::bind( &PerformanceDataManager::processMetricView<double, Statement>, this,
-                                             clusteringCriteriaName, metricName ) );
+                    tasks << boost::bind( &PerformanceDataManager::processMetricView<double, Statement>, this,
+                                          clusteringCriteriaName, metricName );
             }
 
             else if ( viewName == s_linkedObjectsView ) {
                 if ( metricName == QStringLiteral("overflows") )
-                    futures << QtConcurrent::run(
-                                boost::bind( &PerformanceDataManager::processMetricView<std::uint64_t, LinkedObject>, this,
-                                             clusteringCriteriaName, metricName ) );
+                    tasks << boost::bind( &PerformanceDataManager::processMetricView<std::uint64_t, LinkedObject>, this,
+                                          clusteringCriteriaName, metricName );
                 else
-                    futures << QtConcurrent::run(
-                                boost::bind( &PerformanceDataManager::processMetricView<double, LinkedObject>, this,
-                                             clusteringCriteriaName, metricName ) );
+                    tasks << boost::bind( &PerformanceDataManager::processMetricView<double, LinkedObject>, this,
+                                          clusteringCriteriaName, metricName );
             }
 
             else if ( viewName == s_loopsView ) {
                 if ( metricName == QStringLiteral("overflows") )
-                    futures << QtConcurrent::run(
-                                boost::bind( &PerformanceDataManager::processMetricView<std::uint64_t, Loop>, this,
-                                             clusteringCriteriaName, metricName ) );
+                    tasks << boost::bind( &PerformanceDataManager::processMetricView<std::uint64_t, Loop>, this,
+                                          clusteringCriteriaName, metricName );
                 else
-                    futures << QtConcurrent::run(
-                                boost::bind( &PerformanceDataManager::processMetricView<double, Loop>, this,
-                                             clusteringCriteriaName, metricName ) );
+                    tasks << boost::bind( &PerformanceDataManager::processMetricView<double, Loop>, this,
+                                          clusteringCriteriaName, metricName );
             }
 
             else if ( viewName == QStringLiteral("CallTree") ) {
-                futures << QtConcurrent::run( this, &PerformanceDataManager::processCalltreeView, clusteringCriteriaName );
+                tasks << boost::bind( &PerformanceDataManager::processCalltreeView, this, clusteringCriteriaName );
             }
         }
     }
@@ -2644,26 +2886,16 @@ void PerformanceDataManager::unloadViews(const QString &clusteringCriteriaName)
         m_tableViewInfo.remove( clusteringCriteriaName );
     }
 
-    QMutexLocker guard( &m_futureMapMutex );
+    m_viewCache.removeDatabase( clusteringCriteriaName );
 
-    if ( m_futureMap.contains( clusteringCriteriaName ) ) {
-        QMap< QString, QVector< QFuture<void> >* > futureMap = m_futureMap.take( clusteringCriteriaName );
-        // cancel all futures maintained for the clustering criteria name
-        for ( QMap< QString, QVector< QFuture<void> >* >::iterator iter = futureMap.begin(); iter != futureMap.end(); iter++ ) {
-            QVector< QFuture<void> >*& futures( iter.value() );
-            while ( ! futures->empty() ) {
-#if (QT_VERSION >= QT_VERSION_CHECK(5,0,0))
-                futures->takeFirst().cancel();
-#else
-                futures->first().cancel();
-                futures->pop_front();
-#endif
-            }
-        }
-        qDeleteAll( futureMap );
+    {
+        QMutexLocker guard( &m_mutex );
+
+        m_threadGroupIndexes.remove( clusteringCriteriaName );
     }
 
-    Q_ASSERT( m_tableViewInfo.size() == m_futureMap.size() );
+    // cancel all work maintained for the clustering criteria name
+    m_scheduler.cancelAll( clusteringCriteriaName );
 
     if ( 0 == m_tableViewInfo.size() ) {
 #if (QT_VERSION >= QT_VERSION_CHECK(5,0,0))
@@ -2740,81 +2972,40 @@ bool PerformanceDataManager::getPerformanceData(const Collector& collector,
  */
 void PerformanceDataManager::getThreadGroupFromSelectedClusters(const QString &clusteringCriteriaName, const ThreadGroup &group, ThreadGroup &threadGroup)
 {
-    QMutexLocker guard( &m_mutex );
+    QSharedPointer< ThreadGroupIndex > threadIndex;
+    QSet< QString > selected;
 
-    if ( m_selectedClusters.contains( clusteringCriteriaName ) ) {
-        const QSet< QString >& selected = m_selectedClusters[ clusteringCriteriaName ];
+    {
+        QMutexLocker guard( &m_mutex );
 
-        for ( ThreadGroup::iterator iter = group.begin(); iter != group.end(); ++iter ) {
-            const Thread thread( *iter );
-            if ( selected.contains( ArgoNavis::CUDA::getUniqueClusterName( thread ) ) ) {
-                threadGroup.insert( thread );
-            }
-        }
-    }
-}
+        if ( ! m_selectedClusters.contains( clusteringCriteriaName ) )
+            return;
 
-/**
- * @brief PerformanceDataManager::getRankSetFromSelectedClusters
- * @param clusteringCriteriaName - the clustering criteria name
- * @param ranks - list of ranks within selected clusters
- *
- * This method returns a list of ranks within the set of selected clusters.
- */
-void PerformanceDataManager::getRankSetFromSelectedClusters(const QString &clusteringCriteriaName, QSet< int >& ranks)
-{
-    QMutexLocker guard( &m_mutex );
-
-    if ( m_selectedClusters.contains( clusteringCriteriaName ) ) {
-        const QSet< QString >& selected = m_selectedClusters[ clusteringCriteriaName ];
-        foreach( const QString& name, selected ) {
-            const QString section = name.section( '+', 2, 2 );
-            if ( section.startsWith('r') ) {
-                ranks.insert( section.mid(1).toInt() );
-            }
-        }
+        selected = m_selectedClusters[ clusteringCriteriaName ];
+        threadIndex = getThreadGroupIndex( clusteringCriteriaName, group );
     }
+
+    threadGroup = threadIndex->getThreadGroup( selected );
 }
 
 /**
- * @brief PerformanceDataManager::getHostSetFromSelectedClusters
+ * @brief PerformanceDataManager::getThreadGroupIndex
  * @param clusteringCriteriaName - the clustering criteria name
- * @param hosts - list of hosts within selected clusters
+ * @param group - the set of all threads
+ * @return - the thread index for the clustering criteria
+ * @note the caller must hold m_mutex
  *
- * This method returns a list of hosts within the set of selected clusters.
+ * This method returns the thread index built when the experiment was loaded.  If there is none the index is built from the set of all threads.
  */
-void PerformanceDataManager::getHostSetFromSelectedClusters(const QString &clusteringCriteriaName, QSet< QString >& hosts)
+QSharedPointer< ThreadGroupIndex > PerformanceDataManager::getThreadGroupIndex(const QString &clusteringCriteriaName, const ThreadGroup &group)
 {
-    QMutexLocker guard( &m_mutex );
+    QSharedPointer< ThreadGroupIndex >& threadIndex = m_threadGroupIndexes[ clusteringCriteriaName ];
 
-    if ( m_selectedClusters.contains( clusteringCriteriaName ) ) {
-        const QSet< QString >& selected = m_selectedClusters[ clusteringCriteriaName ];
-        foreach( const QString& name, selected ) {
-            hosts.insert( name.section( '+', 0, 0 ) );
-        }
+    if ( ! threadIndex ) {
+        threadIndex = QSharedPointer< ThreadGroupIndex >( new ThreadGroupIndex( group ) );
     }
-}
 
-/**
- * @brief PerformanceDataManager::getProcessIdSetFromSelectedClusters
- * @param clusteringCriteriaName - the clustering criteria name
- * @param pids - list of process ids within selected clusters
- *
- * This method returns a list of process ids within the set of selected clusters.
- */
-void PerformanceDataManager::getProcessIdSetFromSelectedClusters(const QString &clusteringCriteriaName, QSet< pid_t >& pids)
-{
-    QMutexLocker guard( &m_mutex );
-
-    if ( m_selectedClusters.contains( clusteringCriteriaName ) ) {
-        const QSet< QString >& selected = m_selectedClusters[ clusteringCriteriaName ];
-        foreach( const QString& name, selected ) {
-            const QString section = name.section( '+', 1, 1 );
-            if ( section.startsWith('p') ) {
-                pids.insert( section.mid(1).toInt() );
-            }
-        }
-    }
+    return threadIndex;
 }
 
 /**
@@ -2828,9 +3019,21 @@ void PerformanceDataManager::getProcessIdSetFromSelectedClusters(const QString &
  */
 void PerformanceDataManager::getListOfThreadGroupsFromSelectedClusters(const QString &clusteringCriteriaName, const QString &compareMode, const ThreadGroup &group, QList<ThreadGroup> &threadGroupList)
 {
+    QSharedPointer< ThreadGroupIndex > threadIndex;
+    QSet< QString > selected;
+
+    {
+        QMutexLocker guard( &m_mutex );
+
+        if ( ! m_selectedClusters.contains( clusteringCriteriaName ) )
+            return;
+
+        selected = m_selectedClusters[ clusteringCriteriaName ];
+        threadIndex = getThreadGroupIndex( clusteringCriteriaName, group );
+    }
+
     if ( compareMode == QStringLiteral("Compare") ) {
-        ThreadGroup threadGroup;
-        getThreadGroupFromSelectedClusters( clusteringCriteriaName, group, threadGroup );
+        const ThreadGroup threadGroup = threadIndex->getThreadGroup( selected );
         foreach( Thread thread, threadGroup ) {
             ThreadGroup tempGroup;
             tempGroup.insert( thread );
@@ -2838,84 +3041,16 @@ void PerformanceDataManager::getListOfThreadGroupsFromSelectedClusters(const QSt
         }
     }
     else if ( compareMode == QStringLiteral("Compare By Rank") ) {
-        // get set of selected ranks from individual experiment components current selected
-        QSet< int > selectedRanks;
-        getRankSetFromSelectedClusters( clusteringCriteriaName, selectedRanks );
-        // for each selected rank in the set of selected ranks
-        foreach( int rank, selectedRanks ) {
-            ThreadGroup tempGroup;  // accumulated matching Threads
-            // examine each Thread in the specified ThreadGroup object looking for ones matching the rank
-            foreach( Thread thread, group ) {
-                bool hasRank;
-                int threadRank;
-                std::tie( hasRank, threadRank ) = thread.getMPIRank();
-                if ( hasRank && threadRank == rank ) {
-                    tempGroup.insert( thread );  // insert match into the temporary ThreadGroup object
-                }
-            }
-            // during development testing what to know if this condition ever happens
-            Q_ASSERT( tempGroup.size() > 0 );
-            // don't insert an empty ThreadGroup
-            if ( tempGroup.size() > 0 ) {
-                // insert temporary ThreadGroup object into the return list
-                threadGroupList.append( tempGroup );
-            }
-        }
+        // for each rank of the selected threads the group of all threads with that rank
+        threadGroupList = threadIndex->getThreadGroupsByRank( selected );
     }
     else if ( compareMode == QStringLiteral("Compare By Host") ) {
-        // get set of selected hosts from individual experiment components current selected
-        QSet< QString > selectedHosts;
-        getHostSetFromSelectedClusters( clusteringCriteriaName, selectedHosts );
-        // for each selected rank in the set of selected ranks
-        foreach( const QString& hostname, selectedHosts ) {
-            ThreadGroup tempGroup;  // accumulated matching Threads
-            // examine each Thread in the specified ThreadGroup object looking for ones matching the rank
-            foreach( Thread thread, group ) {
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
-                QString clusterName = QString::fromStdString( thread.getHost() );
-#else
-                QString clusterName = QString( thread.getHost().c_str() );
-#endif
-#ifdef HAS_STRIP_DOMAIN_NAME
-                int index = clusterName.indexOf( '.' );
-                if ( index > 0 )
-                    clusterName = clusterName.left( index );
-#endif
-                if ( clusterName == hostname ) {
-                    tempGroup.insert( thread );  // insert match into the temporary ThreadGroup object
-                }
-            }
-            // during development testing what to know if this condition ever happens
-            Q_ASSERT( tempGroup.size() > 0 );
-            // don't insert an empty ThreadGroup
-            if ( tempGroup.size() > 0 ) {
-                // insert temporary ThreadGroup object into the return list
-                threadGroupList.append( tempGroup );
-            }
-        }
+        // for each host of the selected threads the group of all threads on that host
+        threadGroupList = threadIndex->getThreadGroupsByHost( selected );
     }
     else if ( compareMode == QStringLiteral("Compare By Process") ) {
-        // get set of selected process ids from individual experiment components current selected
-        QSet< pid_t > selectedPids;
-        getProcessIdSetFromSelectedClusters( clusteringCriteriaName, selectedPids );
-        // for each selected process in the set of selected process ids
-        foreach( pid_t pid, selectedPids ) {
-            ThreadGroup tempGroup;  // accumulated matching Threads
-            // examine each Thread in the specified ThreadGroup object looking for ones matching the rank
-            foreach( Thread thread, group ) {
-                pid_t tpid = thread.getProcessId();
-                if ( tpid == pid ) {
-                    tempGroup.insert( thread );  // insert match into the temporary ThreadGroup object
-                }
-            }
-            // during development testing what to know if this condition ever happens
-            Q_ASSERT( tempGroup.size() > 0 );
-            // don't insert an empty ThreadGroup
-            if ( tempGroup.size() > 0 ) {
-                // insert temporary ThreadGroup object into the return list
-                threadGroupList.append( tempGroup );
-            }
-        }
+        // for each process of the selected threads the group of all threads of that process
+        threadGroupList = threadIndex->getThreadGroupsByProcess( selected );
     }
 }
 
@@ -2942,17 +3077,7 @@ QString PerformanceDataManager::getColumnNameForCompareView(const QString& compa
         columnName = QString("%1 %2").arg( found ? QStringLiteral("-r") : tr("Group") ).arg( rank );
     }
     else if ( QStringLiteral("Compare By Host") == compareMode ) {
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
-        QString clusterName = QString::fromStdString( thread.getHost() );
-#else
-        QString clusterName = QString( thread.getHost().c_str() );
-#endif
-#ifdef HAS_STRIP_DOMAIN_NAME
-        int index = clusterName.indexOf( '.' );
-        if ( index > 0 )
-            clusterName = clusterName.left( index );
-#endif
-        columnName = QString("-h %1").arg( clusterName );
+        columnName = QString("-h %1").arg( ThreadGroupIndex::getHostName( thread ) );
     }
     else if ( QStringLiteral("Compare By Process") == compareMode ) {
         pid_t pid = thread.getProcessId();
@@ -3620,6 +3745,28 @@ void PerformanceDataManager::ShowCalltreeDetail(
 
     emit addMetricView( clusteringCriteriaName, viewName, QStringLiteral("None"), viewName, metricDesc );
 
+    // the work for the calltree view is abandoned when the view is requested again or the experiment is unloaded
+    const ViewTaskCancellationToken token = ViewTaskCancellationToken::current();
+
+    // the finished calltree table and graph are read from the metric view cache or computed and added to the cache if a
+    // cache is registered for the experiment database
+    const bool cacheEnabled = m_viewCache.hasDatabase( clusteringCriteriaName );
+    const QByteArray cacheKey = cacheEnabled ? getMetricViewCacheKey( clusteringCriteriaName, QStringList() << viewName << metric, interval, QList< ThreadGroup >() << threadGroup ) : QByteArray();
+
+    MetricViewCache::Entry cacheEntry;
+
+    if ( cacheEnabled && m_viewCache.lookup( clusteringCriteriaName, cacheKey, cacheEntry ) ) {
+        emit signalDisplayCalltreeGraph( cacheEntry.attributes.value( QStringLiteral("graph") ).toString() );
+
+        foreach ( const MetricViewDataBlock& block, cacheEntry.blocks ) {
+            if ( token.isCanceled() )
+                return;
+            emit addMetricViewDataBlock( clusteringCriteriaName, viewName, QStringLiteral("None"), viewName, block );
+        }
+
+        return;
+    }
+
     SmartPtr< std::map< Function,
                 std::map< Framework::Thread,
                     std::map< Framework::StackTrace, DETAIL_t > > > > raw_items;
@@ -3627,6 +3774,9 @@ void PerformanceDataManager::ShowCalltreeDetail(
     Queries::GetMetricValues( collector, metric.toStdString(), interval, threadGroup, functions,  // input - metric search criteria
                               raw_items );                                                        // output - raw metric values
 
+    if ( token.isCanceled() )
+        return;
+
     SmartPtr< std::map<Function, std::map<Framework::StackTrace, DETAIL_t > > > data =
             Queries::Reduction::Apply( raw_items, Queries::Reduction::Summation );
 
@@ -3640,6 +3790,9 @@ void PerformanceDataManager::ShowCalltreeDetail(
     std::set< CallerCallee_t > caller_function_list;
 
     for ( typename std::map< Function, std::map< Framework::StackTrace, DETAIL_t > >::iterator iter = data->begin(); iter != data->end(); iter++ ) {
+        if ( token.isCanceled() )
+            return;
+
         const Framework::Function& function( iter->first );
 
         const std::map< Framework::StackTrace, DETAIL_t >& tracemap( iter->second );
@@ -3734,7 +3887,11 @@ void PerformanceDataManager::ShowCalltreeDetail(
     // Generate the DOT formatted data from the graph
     std::ostringstream oss;
     graphManager.write_graphviz( oss );
-    emit signalDisplayCalltreeGraph( QString::fromStdString( oss.str() ) );
+    const QString graph = QString::fromStdString( oss.str() );
+
+    emit signalDisplayCalltreeGraph( graph );
+
+    MetricViewDataBlock block;
 
     for ( TDETAILS::const_reverse_iterator i = reduced_details.rbegin(); i != reduced_details.rend(); ++i ) {
         const details_data_t& d( *i );
@@ -3751,22 +3908,44 @@ void PerformanceDataManager::ShowCalltreeDetail(
 #endif
         oss << func.getName() << " (" << func.getLinkedObject().getPath().getBaseName() << ")";
         metricData << QString::fromStdString( oss.str() );
-        emit addMetricViewData( clusteringCriteriaName, viewName, QStringLiteral("None"), viewName, metricData );
+
+        block.appendRow( metricData );
+
+        if ( block.isFull() ) {
+            if ( token.isCanceled() )
+                return;
+            emit addMetricViewDataBlock( clusteringCriteriaName, viewName, QStringLiteral("None"), viewName, block );
+            // the blocks already emitted make up the cache entry
+            if ( cacheEnabled )
+                cacheEntry.blocks << block;
+            block.clear();
+        }
+    }
+
+    if ( ! block.isEmpty() ) {
+        emit addMetricViewDataBlock( clusteringCriteriaName, viewName, QStringLiteral("None"), viewName, block );
+        if ( cacheEnabled )
+            cacheEntry.blocks << block;
+    }
+
+    if ( cacheEnabled ) {
+        cacheEntry.attributes[ QStringLiteral("graph") ] = graph;
+        m_viewCache.insert( clusteringCriteriaName, cacheKey, cacheEntry );
     }
 }
 
 /**
  * @brief PerformanceDataManager::getTraceMetricValues
- * @param functionName - the function name
+ * @param functionId - the function id of the trace events in the store
  * @param time_origin - the experiment start time
  * @param details - the vector of metric details
- * @param metricData - a vector of trace metrics generated from the metric details
+ * @param store - the trace event store receiving the trace events generated from the metric details
  *
  * This is a template specialization of the getTraceMetricValues template for the OpenSpeedShop::Framework::MPITDetail typename.
- * This method generates a vector of trace metrics from the metric details.
+ * This method appends a trace event to the store for each of the metric details.
  */
 template <>
-void PerformanceDataManager::getTraceMetricValues(const QString& functionName, const Framework::Time::value_type time_origin, const std::vector<MPITDetail>& details, QVector< QVariantList >& metricData)
+void PerformanceDataManager::getTraceMetricValues(int functionId, const Framework::Time::value_type time_origin, const std::vector<MPITDetail>& details, TraceEventStore& store)
 {
     const long double FACTOR_TO_MSEC = 1000000.0;
 
@@ -3778,24 +3957,23 @@ void PerformanceDataManager::getTraceMetricValues(const QString& functionName, c
 
         const double time_in_call = detail.dm_time * 1000.0;
 
-        metricData.push_back( QVariantList() << functionName << lower << upper << time_in_call << detail.dm_id.first
-                                             << detail.dm_source << detail.dm_destination
-                                             << QVariant::fromValue<long>(detail.dm_size) << detail.dm_retval );
+        store.appendMPITEvent( functionId, lower, upper, time_in_call, detail.dm_id.first,
+                               detail.dm_source, detail.dm_destination, detail.dm_size, detail.dm_retval );
     }
 }
 
 /**
  * @brief PerformanceDataManager::getTraceMetricValues
- * @param functionName - the function name
+ * @param functionId - the function id of the trace events in the store
  * @param time_origin - the experiment start time
  * @param details - the vector of metric details
- * @param metricData - a vector of trace metrics generated from the metric details
+ * @param store - the trace event store receiving the trace events generated from the metric details
  *
  * This is a template specialization of the getTraceMetricValues template for the OpenSpeedShop::Framework::IOTDetail typename.
- * This method generates a vector of trace metrics from the metric details.
+ * This method appends a trace event to the store for each of the metric details.
  */
 template <>
-void PerformanceDataManager::getTraceMetricValues(const QString& functionName, const Framework::Time::value_type time_origin, const std::vector<IOTDetail>& details, QVector< QVariantList >& metricData)
+void PerformanceDataManager::getTraceMetricValues(int functionId, const Framework::Time::value_type time_origin, const std::vector<IOTDetail>& details, TraceEventStore& store)
 {
     const long double FACTOR_TO_MSEC = 1000000.0;
 
@@ -3806,8 +3984,8 @@ void PerformanceDataManager::getTraceMetricValues(const QString& functionName, c
         const double upper = ( detail.dm_interval.getEnd().getValue() - time_origin ) / FACTOR_TO_MSEC;
         const double time_in_call = detail.dm_time * 1000.0;
 
-        metricData.push_back( QVariantList() << functionName << lower << upper << time_in_call << detail.dm_id.first
-                                             << detail.dm_syscallno << detail.dm_retval );
+        store.appendIOTEvent( functionId, lower, upper, time_in_call, detail.dm_id.first,
+                              detail.dm_syscallno, detail.dm_retval );
     }
 }
 
@@ -3831,16 +4009,16 @@ QStringList PerformanceDataManager::getMetricsDesc<std::vector<MPITDetail>>() co
 
 /**
  * @brief PerformanceDataManager::getTraceMetricValues
- * @param functionName - the function name
+ * @param functionId - the function id of the trace events in the store
  * @param time_origin - the experiment start time
  * @param details - the vector of metric details
- * @param metricData - a vector of trace metrics generated from the metric details
+ * @param store - the trace event store receiving the trace events generated from the metric details
  *
  * This is a template specialization of the getTraceMetricValues template for the OpenSpeedShop::Framework::MemDetail typename.
- * This method generates a vector of trace metrics from the metric details.
+ * This method appends a trace event to the store for each of the metric details.
  */
 template <>
-void PerformanceDataManager::getTraceMetricValues(const QString& functionName, const Framework::Time::value_type time_origin, const std::vector<Framework::MemDetail>& details, QVector< QVariantList >& metricData)
+void PerformanceDataManager::getTraceMetricValues(int functionId, const Framework::Time::value_type time_origin, const std::vector<Framework::MemDetail>& details, TraceEventStore& store)
 {
     const long double FACTOR_TO_MSEC = 1000000.0;
 
@@ -3854,11 +4032,8 @@ void PerformanceDataManager::getTraceMetricValues(const QString& functionName, c
 
         Q_ASSERT( lower >= 0.0 );
 
-        metricData.push_back( QVariantList() << functionName << lower << upper << duration
-                                             << detail.dm_id.first
-                                             << QVariant::fromValue<quint64>(detail.dm_id.second)
-                                             << QVariant::fromValue<quint64>(allocSize)
-                                             << QVariant::fromValue<quint64>(detail.dm_total_allocation) );
+        store.appendMemEvent( functionId, lower, upper, duration, detail.dm_id.first,
+                              detail.dm_id.second, allocSize, detail.dm_total_allocation );
     }
 }
 
@@ -4044,6 +4219,9 @@ void PerformanceDataManager::ShowTraceDetail(
     // flag indicating emit signals for add trace item (=false) or graph item (=true)
     const bool emitGraphItem( s_TRACING_EXPERIMENTS_WITH_GRAPHS.contains( collectorId ) );
 
+    // the work for the trace view is abandoned when the view is requested again or the experiment is unloaded
+    const ViewTaskCancellationToken token = ViewTaskCancellationToken::current();
+
     SmartPtr< std::map< Function,
                 std::map< Framework::Thread,
                     std::map< Framework::StackTrace, DETAIL_t > > > > raw_items;
@@ -4051,6 +4229,9 @@ void PerformanceDataManager::ShowTraceDetail(
     Queries::GetMetricValues( collector, metric.toStdString(), interval, threadGroup, functions,  // input - metric search criteria
                               raw_items );                                                        // output - raw metric values
 
+    if ( token.isCanceled() )
+        return;
+
     const QString metricViewName = PerformanceDataMetricView::getMetricViewName( traceViewName, metric, ALL_EVENTS_DETAILS_VIEW );
 
     // build the proxy views and tree views for the various trace views: "All Events"
@@ -4064,96 +4245,167 @@ void PerformanceDataManager::ShowTraceDetail(
     if ( metricData.size() < 1 )
         return;
 
-    for ( typename std::map< Function, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > >::iterator iter = raw_items->begin(); iter != raw_items->end(); iter++ ) {
-        const Framework::Function& function( iter->first );
+    // the graph title for experiments with graphs
+    const bool hasGraphTitle( s_TRACING_EXPERIMENTS_GRAPH_TITLES.contains( collectorId ) && s_TRACING_EXPERIMENTS_GRAPH_TITLES[ collectorId ].contains( metric ) );
+    const QString graphTitle = hasGraphTitle ? s_TRACING_EXPERIMENTS_GRAPH_TITLES[ collectorId ][ metric ] : QString();
 
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
-        const QString functionName = QString::fromStdString( function.getDemangledName() );
-#else
-        const QString functionName = QString( function.getDemangledName().c_str() );
-#endif
+    typedef std::pair< const Function, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > > function_item_t;
 
-        emit addAssociatedMetricView( clusteringCriteriaName, traceViewName, metric, functionName, metricViewName, metricDesc );
+    std::vector< const function_item_t* > functionItems;
+    functionItems.reserve( raw_items->size() );
 
-        typename std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > >& thread( iter->second );
+    for ( typename std::map< Function, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > >::const_iterator iter = raw_items->begin(); iter != raw_items->end(); iter++ ) {
+        functionItems.push_back( &(*iter) );
+    }
 
-        std::map< Framework::Thread, Framework::ExtentGroup > subextents_map;
-        Get_Subextents_To_Object_Map( threadGroup, function, subextents_map );
+    const int functionCount = functionItems.size();
 
-        std::set< Framework::StackTrace, ltST > StackTraces_Processed;
+    const int taskCount = qMin( qMax( QThread::idealThreadCount(), 1 ), functionCount );
 
-        for ( typename std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > >::iterator titer = thread.begin(); titer != thread.end(); titer++ ) {
-            const typename std::map< Framework::StackTrace, DETAIL_t >& tracemap( titer->second );
+    // the trace events of each function - the functions are independent and are processed concurrently by a bounded number
+    // of tasks; each function is emitted below as soon as it and all earlier functions are finished and is then released, so
+    // the trace events of at most 'window' functions are held at any time
+    TraceFunctionQueue queue;
+    queue.events.resize( functionCount );
+    queue.finished.fill( false, functionCount );
+    queue.nextFunction = 0;
+    queue.nextEmitted = 0;
+    queue.window = 2 * taskCount;
+    queue.stopped = false;
 
-            for ( typename std::map< Framework::StackTrace, DETAIL_t >::const_iterator siter = tracemap.begin(); siter != tracemap.end(); siter++ ) {
-                const Framework::StackTrace& stacktrace( siter->first );
-                const DETAIL_t& details( siter->second );
+    QFutureSynchronizer<void> synchronizer;
 
-                std::pair< std::set< Framework::StackTrace >::iterator, bool > ret = StackTraces_Processed.insert( stacktrace );
-                if ( ! ret.second )
-                    continue;
+    for ( int task=0; task<taskCount; ++task ) {
+        synchronizer.addFuture( QtConcurrent::run( boost::bind( &PerformanceDataManager::processTraceFunctions<DETAIL_t>, this,
+                                                                &functionItems, time_origin, &queue, token ) ) );
+    }
 
-                QString definingLocation;
-                std::set< Statement > statements = stacktrace.getStatementsAt( 1 );
-                if ( statements.size() > 0 ) {
-                    Statement statement( *statements.begin() );
-                    definingLocation = QStringLiteral(" (") + getLocationInfo(statement ) + QStringLiteral(" )");
-                }
+    // the graph value is the new highwater of memory trace events
+    const bool emitGraphs( emitGraphItem && hasGraphTitle );
 
-                QVector< QVariantList > traceList;
-                getTraceMetricValues( functionName + definingLocation, time_origin, details, traceList );
-
-                foreach( const QVariantList& list, traceList ) {
-                    if ( list.size() == metricDesc.size() ) {
-                        if ( emitGraphItem ) {
-                            if ( s_TRACING_EXPERIMENTS_GRAPH_TITLES.contains( collectorId ) && s_TRACING_EXPERIMENTS_GRAPH_TITLES[ collectorId ].contains( metric ) ) {
-                                    const QString graphTitle = s_TRACING_EXPERIMENTS_GRAPH_TITLES[ collectorId ][ metric ];
-                                    int rankOrThread = ( metricData.size() == 1 ) ? 0 : list[4].toInt();
-
-                                    emit addGraphItem( clusteringCriteriaName, graphTitle, metric, list[1].toDouble(), list[7].toDouble(), rankOrThread );
-
-                                    if ( list[7].toDouble() > metricData[ rankOrThread ] ) {
-                                        metricData[ rankOrThread ] = list[7].toDouble();
-                                    }
-                                    if ( rankOrThread > maxRank ) {
-                                        maxRank = rankOrThread;
-                                    }
-                            }
-                        }
-                        else {
-                            emit addTraceItem( clusteringCriteriaName, clusteringCriteriaName, functionName, list[1].toDouble(), list[2].toDouble(), list[4].toInt() );
-                        }
-                    }
+    // the graph points of each rank in time order and whether they were appended in time order
+    QVector< QVector< double > > graphTimes( metricData.size() );
+    QVector< QVector< double > > graphValues( metricData.size() );
+    QVector< bool > graphSorted( metricData.size(), true );
+
+    for ( int index=0; index<functionCount; ++index ) {
+        TraceFunctionEvents events;
+
+        {
+            QMutexLocker guard( &queue.mutex );
+
+            while ( ! queue.finished[ index ] ) {
+                queue.condition.wait( &queue.mutex );
+            }
+
+            // take the trace events of the function and allow the workers to take the next function
+            std::swap( events, queue.events[ index ] );
+
+            queue.nextEmitted = index + 1;
+            queue.stopped = token.isCanceled();
+
+            queue.condition.wakeAll();
+        }
+
+        if ( token.isCanceled() )
+            break;
+
+        const QString functionName( events.functionName );
+
+        // the finished trace events of the function are published to the timeline and the details table as one shared store
+        // (the details table reads the shared store in place, whereas the timeline lane copies the begin time, end time
+        // and rank of each event into its own arrays sorted by begin time with the other events of the lane)
+        const TraceEventStorePtr sharedStore( new TraceEventStore( events.store ) );
+        const TraceEventStore& store( *sharedStore );
+
+        if ( emitGraphs && TraceEventStore::MemTrace == store.kind() ) {
+            for ( int i=0; i<store.size(); ++i ) {
+                const int rankOrThread = ( metricData.size() == 1 ) ? 0 : store.rank( i );
+                const double time = store.begin( i );
+                const double highwater = store.highwater( i );
+
+                QVector< double >& times = graphTimes[ rankOrThread ];
+                if ( ! times.isEmpty() && time < times.last() ) {
+                    graphSorted[ rankOrThread ] = false;
                 }
+                times << time;
+                graphValues[ rankOrThread ] << highwater;
 
-                foreach( const QVariantList& metricData, traceList ) {
-                    emit addMetricViewData( clusteringCriteriaName, traceViewName, metric, ALL_EVENTS_DETAILS_VIEW, metricData );
+                if ( highwater > metricData[ rankOrThread ] ) {
+                    metricData[ rankOrThread ] = highwater;
+                }
+                if ( rankOrThread > maxRank ) {
+                    maxRank = rankOrThread;
                 }
             }
         }
 
+        emit addAssociatedMetricView( clusteringCriteriaName, traceViewName, metric, functionName, metricViewName, metricDesc );
+
+        if ( ! emitGraphItem ) {
+            emit addTraceItems( clusteringCriteriaName, clusteringCriteriaName, functionName, sharedStore );
+        }
+
+        emit addMetricViewTraceEvents( clusteringCriteriaName, traceViewName, metric, ALL_EVENTS_DETAILS_VIEW, sharedStore );
+
         emit requestMetricViewComplete( clusteringCriteriaName, traceViewName, metric, functionName, lower, upper );
+
+        // the trace events of the function are released once the timeline and the details table have added them
     }
 
-    if ( emitGraphItem && maxRank >= metricData.size() ) {
-        if ( s_TRACING_EXPERIMENTS_GRAPH_TITLES.contains( collectorId ) && s_TRACING_EXPERIMENTS_GRAPH_TITLES[ collectorId ].contains( metric ) ) {
-            auto minmax = std::minmax_element( metricData.begin(), metricData.begin() + maxRank );
+    {
+        QMutexLocker guard( &queue.mutex );
 
-            const double average = std::accumulate( metricData.begin(), metricData.begin() + maxRank, 0.0 ) / ( maxRank + 1 );
+        queue.stopped = true;
 
-            QVector< double >::iterator closestIter = metricData.begin();
+        queue.condition.wakeAll();
+    }
 
-            if ( metricData.size() > 1 ) {
-                for ( QVector< double >::iterator iter = metricData.begin()+1; iter != metricData.begin() + maxRank; iter++ ) {
-                    if ( std::abs( *iter - average ) < std::abs( *closestIter - average ) ) {
-                        closestIter = iter;
-                    }
-                }
+    synchronizer.waitForFinished();
+
+    if ( token.isCanceled() )
+        return;
+
+    if ( emitGraphs ) {
+        // the ranks with the minimum and maximum highwater and the highwater total are found while the graphs are emitted
+        int rankWithMinValue( 0 );
+        int rankWithMaxValue( 0 );
+        double total( 0.0 );
+
+        // hand each graph to the view as one presorted bulk update
+        for ( int rankOrThread=0; rankOrThread<graphTimes.size(); ++rankOrThread ) {
+            if ( rankOrThread < maxRank ) {
+                const double value = metricData[ rankOrThread ];
+                if ( value < metricData[ rankWithMinValue ] )
+                    rankWithMinValue = rankOrThread;
+                if ( value >= metricData[ rankWithMaxValue ] )
+                    rankWithMaxValue = rankOrThread;
+                total += value;
             }
 
-            const int rankWithMinValue = std::distance( metricData.begin(), minmax.first );
-            const int rankWithMaxValue = std::distance( metricData.begin(), minmax.second );
-            const int rankClosestToAvgValue = std::distance( metricData.begin(), closestIter );
+            if ( graphTimes[ rankOrThread ].isEmpty() )
+                continue;
+
+            if ( ! graphSorted[ rankOrThread ] ) {
+                sortGraphPoints( graphTimes[ rankOrThread ], graphValues[ rankOrThread ] );
+            }
+
+            emit addGraphItems( clusteringCriteriaName, graphTitle, metric, rankOrThread, graphTimes[ rankOrThread ], graphValues[ rankOrThread ] );
+
+            // release the graph points of the rank once emitted
+            graphTimes[ rankOrThread ] = QVector< double >();
+            graphValues[ rankOrThread ] = QVector< double >();
+        }
+
+        if ( maxRank >= metricData.size() ) {
+            const double average = total / ( maxRank + 1 );
+
+            int rankClosestToAvgValue( 0 );
+            for ( int rankOrThread=1; rankOrThread<maxRank; ++rankOrThread ) {
+                if ( std::abs( metricData[ rankOrThread ] - average ) < std::abs( metricData[ rankClosestToAvgValue ] - average ) ) {
+                    rankClosestToAvgValue = rankOrThread;
+                }
+            }
 
             emit signalGraphMinAvgMaxRanks( metric, rankWithMinValue, rankClosestToAvgValue, rankWithMaxValue );
         }
@@ -4162,6 +4414,92 @@ void PerformanceDataManager::ShowTraceDetail(
     emit requestMetricViewComplete( clusteringCriteriaName, traceViewName, metric, ALL_EVENTS_DETAILS_VIEW, lower, upper );
 }
 
+/**
+ * @brief PerformanceDataManager::processTraceFunctions
+ * @param functions - the query results of the trace view for each function
+ * @param time_origin - the start time of the experiment
+ * @param queue - the queue handing the trace events of each function to the emitting thread
+ * @param token - the cancellation token of the trace view work
+ *
+ * Generate the trace events for the next function not taken by another worker until all functions are taken.  A function is
+ * only taken while fewer than the window of functions are taken ahead of the next function emitted.  The events of each
+ * distinct stack trace are labeled with the function name and the defining location of the call site.  A function abandoned
+ * because the work was canceled is still marked as finished so that the emitting thread is not left waiting for it.
+ */
+template <typename DETAIL_t>
+void PerformanceDataManager::processTraceFunctions(const std::vector< const std::pair< const Function, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > >* >* functions,
+                                                   const Framework::Time::value_type time_origin,
+                                                   TraceFunctionQueue* queue,
+                                                   const ViewTaskCancellationToken token)
+{
+    const int functionCount = functions->size();
+
+    for ( ;; ) {
+        int index;
+
+        {
+            QMutexLocker guard( &queue->mutex );
+
+            while ( ! queue->stopped && queue->nextFunction < functionCount && queue->nextFunction >= queue->nextEmitted + queue->window ) {
+                queue->condition.wait( &queue->mutex );
+            }
+
+            if ( queue->stopped || queue->nextFunction >= functionCount )
+                return;
+
+            index = queue->nextFunction++;
+        }
+
+        TraceFunctionEvents events;
+
+        if ( ! token.isCanceled() ) {
+            const Framework::Function& function( (*functions)[ index ]->first );
+            const typename std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > >& thread( (*functions)[ index ]->second );
+
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
+            events.functionName = QString::fromStdString( function.getDemangledName() );
+#else
+            events.functionName = QString( function.getDemangledName().c_str() );
+    #endif
+
+            std::set< Framework::StackTrace, ltST > StackTraces_Processed;
+
+            for ( typename std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > >::const_iterator titer = thread.begin(); titer != thread.end(); titer++ ) {
+                const typename std::map< Framework::StackTrace, DETAIL_t >& tracemap( titer->second );
+
+                for ( typename std::map< Framework::StackTrace, DETAIL_t >::const_iterator siter = tracemap.begin(); siter != tracemap.end(); siter++ ) {
+                    const Framework::StackTrace& stacktrace( siter->first );
+                    const DETAIL_t& details( siter->second );
+
+                    std::pair< std::set< Framework::StackTrace >::iterator, bool > ret = StackTraces_Processed.insert( stacktrace );
+                    if ( ! ret.second )
+                        continue;
+
+                    QString definingLocation;
+                    std::set< Statement > statements = stacktrace.getStatementsAt( 1 );
+                    if ( statements.size() > 0 ) {
+                        Statement statement( *statements.begin() );
+                        definingLocation = getLocationInfo(statement );
+                    }
+
+                    const int functionId = events.store.addFunction( TraceEventStore::getFunctionLabel( events.functionName, definingLocation ) );
+
+                    getTraceMetricValues( functionId, time_origin, details, events.store );
+                }
+            }
+        }
+
+        {
+            QMutexLocker guard( &queue->mutex );
+
+            std::swap( queue->events[ index ], events );
+            queue->finished[ index ] = true;
+
+            queue->condition.wakeAll();
+        }
+    }
+}
+
 /*
  * @brief PerformanceDataManager::ShowSampleCountersDetail
  * @param clusteringCriteriaName - the clustering criteria name
@@ -4216,48 +4554,68 @@ void PerformanceDataManager::ShowSampleCountersDetail(const QString& clusteringC
     Queries::GetMetricValues( collector, metricName.toStdString(), interval, threadGroup, getThreadSet<TS>( threadGroup ),  // input - metric search criteria
                               raw_items );
 
-    if ( emitGraphItem ) {
-        QStringList items;
+    // the work for the metric view is abandoned when the view is requested again or the experiment is unloaded
+    const ViewTaskCancellationToken token = ViewTaskCancellationToken::current();
 
-        for ( typename std::map< TS, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > >::iterator iter = raw_items->begin(); iter != raw_items->end(); iter++ ) {
-            items << getLocationInfo( iter->first );
-        }
+    if ( token.isCanceled() )
+        return;
 
-        QString graphTitle;
+    typedef std::pair< const TS, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > > item_t;
 
-        if ( s_TRACING_EXPERIMENTS_GRAPH_TITLES.contains( collectorId ) && s_TRACING_EXPERIMENTS_GRAPH_TITLES[ collectorId ].contains( metricName ) ) {
-            graphTitle = s_TRACING_EXPERIMENTS_GRAPH_TITLES[ collectorId ][ metricName ];
-        }
+    std::vector< const item_t* > items;
+    items.reserve( raw_items->size() );
 
-        emit createGraphItems( clusteringCriteriaName, graphTitle, metricName, viewName, sampleCounterNames, items );
+    for ( typename std::map< TS, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > >::const_iterator iter = raw_items->begin(); iter != raw_items->end(); iter++ ) {
+        items.push_back( &(*iter) );
     }
 
-    for ( typename std::map< TS, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > >::iterator iter = raw_items->begin(); iter != raw_items->end(); iter++ ) {
+    const int itemCount = items.size();
 
-        const QString locationName = getLocationInfo( iter->first );
+    // the sample counter totals of each view item - the items are independent and are processed concurrently by a
+    // bounded number of tasks each taking every n-th item; the results are emitted below in item order
+    std::vector< SampleCounterTotals > totals( itemCount );
 
-        typename std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > >& thread( iter->second );
+    const int taskCount = qMin( qMax( QThread::idealThreadCount(), 1 ), itemCount );
 
-        std::map< Framework::Thread, Framework::ExtentGroup > subextents_map;
-        Get_Subextents_To_Object_Map( threadGroup, iter->first, subextents_map );
+    QFutureSynchronizer<void> synchronizer;
 
-        QVector< qulonglong > totalSampleCount( sampleCounterNames.size(), 0 );
-        double totalTime( 0.0 );
+    for ( int task=1; task<taskCount; ++task ) {
+        synchronizer.addFuture( QtConcurrent::run( boost::bind( &PerformanceDataManager::processSampleCounterItems<TS, DETAIL_t>, this,
+                                                                &items, sampleCounterNames.size(), &totals, token, task, taskCount ) ) );
+    }
 
-        for ( typename std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > >::iterator titer = thread.begin(); titer != thread.end(); titer++ ) {
-            const typename std::map< Framework::StackTrace, DETAIL_t >& tracemap( titer->second );
+    // the calling thread takes a share of the items as well
+    if ( taskCount > 0 ) {
+        processSampleCounterItems<TS, DETAIL_t>( &items, sampleCounterNames.size(), &totals, token, 0, taskCount );
+    }
 
-            for ( typename std::map< Framework::StackTrace, DETAIL_t >::const_iterator siter = tracemap.begin(); siter != tracemap.end(); siter++ ) {
-                const DETAIL_t& details( siter->second );
+    synchronizer.waitForFinished();
 
-                for ( int index=0; index<sampleCounterNames.size(); index++ ) {
-                    totalSampleCount[index] += getSampleCounterValue( details, index );
-                }
+    if ( token.isCanceled() )
+        return;
 
-                totalTime += getSampleCounterTimeValue( details );
-            }
+    if ( emitGraphItem ) {
+        QStringList itemNames;
+
+        for ( int index=0; index<itemCount; ++index ) {
+            itemNames << totals[ index ].locationName;
+        }
+
+        QString graphTitle;
+
+        if ( s_TRACING_EXPERIMENTS_GRAPH_TITLES.contains( collectorId ) && s_TRACING_EXPERIMENTS_GRAPH_TITLES[ collectorId ].contains( metricName ) ) {
+            graphTitle = s_TRACING_EXPERIMENTS_GRAPH_TITLES[ collectorId ][ metricName ];
         }
 
+        emit createGraphItems( clusteringCriteriaName, graphTitle, metricName, viewName, sampleCounterNames, itemNames );
+    }
+
+    MetricViewDataBlock block;
+
+    for ( int item=0; item<itemCount; ++item ) {
+        const QVector< qulonglong >& totalSampleCount( totals[ item ].sampleCount );
+        const double totalTime( totals[ item ].time );
+
         // generate each column of metric values
         QVariantList metricValues;
 
@@ -4269,17 +4627,28 @@ void PerformanceDataManager::ShowSampleCountersDetail(const QString& clusteringC
             metricValues << totalSampleCount[index];
         }
 
-        metricValues << locationName;
+        metricValues << totals[ item ].locationName;
 
-        emit addMetricViewData( clusteringCriteriaName, METRIC_VIEW_MODE, metricName, viewName, metricValues );
+        block.appendRow( metricValues );
+
+        if ( block.isFull() ) {
+            if ( token.isCanceled() )
+                return;
+            emit addMetricViewDataBlock( clusteringCriteriaName, METRIC_VIEW_MODE, metricName, viewName, block );
+            block.clear();
+        }
 
         if ( emitGraphItem ) {
             for ( int index=0; index<sampleCounterNames.size(); index++ ) {
-                emit addGraphItem( metricName, viewName, sampleCounterNames[index], std::distance( raw_items->begin(), iter ), totalSampleCount[index] );
+                emit addGraphItem( metricName, viewName, sampleCounterNames[index], item, totalSampleCount[index] );
             }
         }
     }
 
+    if ( ! block.isEmpty() ) {
+        emit addMetricViewDataBlock( clusteringCriteriaName, METRIC_VIEW_MODE, metricName, viewName, block );
+    }
+
     emit requestMetricViewComplete( clusteringCriteriaName, METRIC_VIEW_MODE, metricName, viewName, lower, upper );
 }
 
@@ -4346,40 +4715,64 @@ void PerformanceDataManager::ShowSampleCountersDerivedMetricDetail(const QString
     Queries::GetMetricValues( collector, metricName.toStdString(), interval, threadGroup, getThreadSet<TS>( threadGroup ),  // input - metric search criteria
                               raw_items );
 
-    if ( emitGraphItem ) {
-        QStringList items;
+    // the work for the metric view is abandoned when the view is requested again or the experiment is unloaded
+    const ViewTaskCancellationToken token = ViewTaskCancellationToken::current();
 
-        for ( typename std::map< TS, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > >::iterator iter = raw_items->begin(); iter != raw_items->end(); iter++ ) {
-            items << getLocationInfo( iter->first );
-        }
+    if ( token.isCanceled() )
+        return;
+
+    typedef std::pair< const TS, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > > item_t;
 
-        emit createGraphItems( clusteringCriteriaName, METRIC_VIEW_MODE, metricName, viewName, derivedMetricList, items );
+    std::vector< const item_t* > items;
+    items.reserve( raw_items->size() );
+
+    for ( typename std::map< TS, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > >::const_iterator iter = raw_items->begin(); iter != raw_items->end(); iter++ ) {
+        items.push_back( &(*iter) );
     }
 
-    for ( typename std::map< TS, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > >::iterator iter = raw_items->begin(); iter != raw_items->end(); iter++ ) {
+    const int itemCount = items.size();
 
-        const QString locationName = getLocationInfo( iter->first );
+    // the sample counter totals of each view item - the items are independent and are processed concurrently by a
+    // bounded number of tasks each taking every n-th item; the results are emitted below in item order
+    std::vector< SampleCounterTotals > totals( itemCount );
 
-        typename std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > >& thread( iter->second );
+    const int taskCount = qMin( qMax( QThread::idealThreadCount(), 1 ), itemCount );
 
-        std::map< Framework::Thread, Framework::ExtentGroup > subextents_map;
-        Get_Subextents_To_Object_Map( threadGroup, iter->first, subextents_map );
+    QFutureSynchronizer<void> synchronizer;
 
-        QMap< QString, qulonglong > totalSampleCount;
-        double totalTime( 0.0 );
+    for ( int task=1; task<taskCount; ++task ) {
+        synchronizer.addFuture( QtConcurrent::run( boost::bind( &PerformanceDataManager::processSampleCounterItems<TS, DETAIL_t>, this,
+                                                                &items, sampleCounterNames.size(), &totals, token, task, taskCount ) ) );
+    }
 
-        for ( typename std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > >::iterator titer = thread.begin(); titer != thread.end(); titer++ ) {
-            const typename std::map< Framework::StackTrace, DETAIL_t >& tracemap( titer->second );
+    // the calling thread takes a share of the items as well
+    if ( taskCount > 0 ) {
+        processSampleCounterItems<TS, DETAIL_t>( &items, sampleCounterNames.size(), &totals, token, 0, taskCount );
+    }
 
-            for ( typename std::map< Framework::StackTrace, DETAIL_t >::const_iterator siter = tracemap.begin(); siter != tracemap.end(); siter++ ) {
-                const DETAIL_t& details( siter->second );
+    synchronizer.waitForFinished();
 
-                for ( int index=0; index<sampleCounterNames.size(); index++ ) {
-                    totalSampleCount[ sampleCounterNames[index] ] += getSampleCounterValue( details, index );
-                }
+    if ( token.isCanceled() )
+        return;
 
-                totalTime += getSampleCounterTimeValue( details );
-            }
+    if ( emitGraphItem ) {
+        QStringList itemNames;
+
+        for ( int index=0; index<itemCount; ++index ) {
+            itemNames << totals[ index ].locationName;
+        }
+
+        emit createGraphItems( clusteringCriteriaName, METRIC_VIEW_MODE, metricName, viewName, derivedMetricList, itemNames );
+    }
+
+    MetricViewDataBlock block;
+
+    for ( int item=0; item<itemCount; ++item ) {
+        QMap< QString, qulonglong > totalSampleCount;
+        const double totalTime( totals[ item ].time );
+
+        for ( int index=0; index<sampleCounterNames.size(); index++ ) {
+            totalSampleCount[ sampleCounterNames[index] ] += totals[ item ].sampleCount[ index ];
         }
 
         // generate each column of metric values
@@ -4391,20 +4784,80 @@ void PerformanceDataManager::ShowSampleCountersDerivedMetricDetail(const QString
             metricValues << solver->solve( key, totalSampleCount );
         }
 
-        metricValues << locationName;
+        metricValues << totals[ item ].locationName;
+
+        block.appendRow( metricValues );
 
-        emit addMetricViewData( clusteringCriteriaName, METRIC_VIEW_MODE, metricName, viewName, metricValues );
+        if ( block.isFull() ) {
+            if ( token.isCanceled() )
+                return;
+            emit addMetricViewDataBlock( clusteringCriteriaName, METRIC_VIEW_MODE, metricName, viewName, block );
+            block.clear();
+        }
 
         if ( emitGraphItem ) {
             for ( int index=0; index<derivedMetricList.size(); index++ ) {
-                emit addGraphItem( metricName, viewName, derivedMetricList[index], std::distance( raw_items->begin(), iter ), metricValues[ index+1 ].toDouble() );
+                emit addGraphItem( metricName, viewName, derivedMetricList[index], item, metricValues[ index+1 ].toDouble() );
             }
         }
     }
 
+    if ( ! block.isEmpty() ) {
+        emit addMetricViewDataBlock( clusteringCriteriaName, METRIC_VIEW_MODE, metricName, viewName, block );
+    }
+
     emit requestMetricViewComplete( clusteringCriteriaName, METRIC_VIEW_MODE, metricName, viewName, lower, upper );
 }
 
+/**
+ * @brief PerformanceDataManager::processSampleCounterItems
+ * @param items - the query results of the metric view for each view item
+ * @param sampleCounterCount - the number of sample counters
+ * @param results - the sample counter totals of each view item
+ * @param token - the cancellation token of the metric view work
+ * @param first - the index of the first view item processed
+ * @param stride - the distance between the view items processed
+ *
+ * Compute the location name and the totals of the sample counters and sampling time over all threads and stack traces
+ * for every stride-th view item beginning at the first view item.  Each invocation only writes the results of its
+ * own view items.
+ */
+template <typename TS, typename DETAIL_t>
+void PerformanceDataManager::processSampleCounterItems(const std::vector< const std::pair< const TS, std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > > >* >* items,
+                                                       const int sampleCounterCount,
+                                                       std::vector< SampleCounterTotals >* results,
+                                                       const ViewTaskCancellationToken token,
+                                                       int first,
+                                                       int stride)
+{
+    for ( int item=first; item<(int)items->size(); item+=stride ) {
+        if ( token.isCanceled() )
+            return;
+
+        const typename std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > >& thread( (*items)[ item ]->second );
+
+        SampleCounterTotals& totals( (*results)[ item ] );
+
+        totals.locationName = getLocationInfo( (*items)[ item ]->first );
+        totals.sampleCount.fill( 0, sampleCounterCount );
+        totals.time = 0.0;
+
+        for ( typename std::map< Framework::Thread, std::map< Framework::StackTrace, DETAIL_t > >::const_iterator titer = thread.begin(); titer != thread.end(); titer++ ) {
+            const typename std::map< Framework::StackTrace, DETAIL_t >& tracemap( titer->second );
+
+            for ( typename std::map< Framework::StackTrace, DETAIL_t >::const_iterator siter = tracemap.begin(); siter != tracemap.end(); siter++ ) {
+                const DETAIL_t& details( siter->second );
+
+                for ( int index=0; index<sampleCounterCount; index++ ) {
+                    totals.sampleCount[index] += getSampleCounterValue( details, index );
+                }
+
+                totals.time += getSampleCounterTimeValue( details );
+            }
+        }
+    }
+}
+
 
 } // GUI
 } // ArgoNavis
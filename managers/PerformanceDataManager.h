@@ -32,8 +32,9 @@
 #include <QStringList>
 #include <QVariant>
 #include <QAtomicPointer>
-#include <QFutureSynchronizer>
+#include <QSharedPointer>
 #include <QMutex>
+#include <QWaitCondition>
 
 #include <vector>
 #include <set>
@@ -60,6 +61,7 @@
 #include "CollectorGroup.hxx"
 #include "Experiment.hxx"
 #include "ThreadGroup.hxx"
+#include "StackTrace.hxx"
 
 #include "UserGraphRangeChangeManager.h"
 #include "CBTF-ArgoNavis-Ext/NameValueDefines.h"
@@ -67,6 +69,11 @@
 #include "widgets/ShowDeviceDetailsDialog.h"
 #include "managers/CalltreeGraphManager.h"
 #include "managers/MetricTableViewInfo.h"
+#include "managers/MetricViewDataBlock.h"
+#include "managers/MetricViewCache.h"
+#include "managers/ViewTaskScheduler.h"
+#include "managers/ThreadGroupIndex.h"
+#include "managers/TraceEventStore.h"
 
 
 class QTimer;
@@ -157,19 +164,17 @@ signals:
                            const double& time_end,
                            const double& count);
 
-    void addTraceItem(const QString &clusteringCriteriaName,
-                      const QString &clusterName,
-                      const QString &functionName,
-                      double startTime,
-                      double endTime,
-                      int rankOrThread);
+    void addTraceItems(const QString &clusteringCriteriaName,
+                       const QString &clusterName,
+                       const QString &functionName,
+                       const TraceEventStorePtr &store);
 
-    void addGraphItem(const QString &clusteringCriteriaName,
-                      const QString &metricNameTitle,
-                      const QString &metricName,
-                      double eventTime,
-                      double eventData,
-                      int rankOrThread);
+    void addGraphItems(const QString &clusteringCriteriaName,
+                       const QString &metricNameTitle,
+                       const QString &metricName,
+                       int rankOrThread,
+                       const QVector< double > &eventTimes,
+                       const QVector< double > &eventData);
 
     void addGraphItem(const QString &metricName,
                       const QString &viewName,
@@ -195,6 +200,8 @@ signals:
     void addAssociatedMetricView(const QString& clusteringCriteriaName, const QString& modeName, const QString& metricName, const QString& viewName, const QString& attachedMetricViewName, const QStringList& metrics);
 
     void addMetricViewData(const QString& clusteringCriteriaName, const QString& modeName, const QString& metricName, const QString& viewName, const QVariantList& data, const QStringList& columnHeaders = QStringList());
+    void addMetricViewDataBlock(const QString& clusteringCriteriaName, const QString& modeName, const QString& metricName, const QString& viewName, const MetricViewDataBlock& block, const QStringList& columnHeaders = QStringList());
+    void addMetricViewTraceEvents(const QString& clusteringCriteriaName, const QString& modeName, const QString& metricName, const QString& viewName, const TraceEventStorePtr& store);
 
     void addCluster(const QString& clusteringCriteriaName, const QString& clusterName, double xAxisLower, double xAxisUpper, bool yAxisVisible, double yAxisLower, double yAxisUpper);
     void removeCluster(const QString& clusteringCriteriaName, const QString& clusterName);
@@ -238,9 +245,7 @@ private:
 
     void getListOfThreadGroupsFromSelectedClusters(const QString &clusteringCriteriaName, const QString& compareMode, const OpenSpeedShop::Framework::ThreadGroup& group, QList< OpenSpeedShop::Framework::ThreadGroup > &threadGroupList);
 
-    void getRankSetFromSelectedClusters(const QString &clusteringCriteriaName, QSet< int >& ranks);
-    void getHostSetFromSelectedClusters(const QString &clusteringCriteriaName, QSet<QString> &hosts);
-    void getProcessIdSetFromSelectedClusters(const QString &clusteringCriteriaName, QSet<pid_t> &pids);
+    QSharedPointer< ThreadGroupIndex > getThreadGroupIndex(const QString &clusteringCriteriaName, const OpenSpeedShop::Framework::ThreadGroup& group);
 
     QString getColumnNameForCompareView(const QString &compareMode, const OpenSpeedShop::Framework::Thread &thread);
 
@@ -252,7 +257,7 @@ private:
                       const OpenSpeedShop::Framework::Collector& collector,
                       const OpenSpeedShop::Framework::ThreadGroup& all_threads);
 
-    void loadCudaMetricViews(QVector<QFuture<void> > &futures,
+    void loadCudaMetricViews(QList< ViewTaskScheduler::Task >& tasks,
                              const QString &clusteringCriteriaName,
                              const QStringList& metricList,
                              const QStringList& viewList);
@@ -277,6 +282,59 @@ private:
                                   const QString compareMode,
                                   const QString columnUnits);
 
+    template <typename TS, typename TM>
+    void processCompareThreadGroups(const OpenSpeedShop::Framework::Collector& collector,
+                                    const std::string& metric,
+                                    const OpenSpeedShop::Framework::TimeInterval& interval,
+                                    const QList< OpenSpeedShop::Framework::ThreadGroup >* threadGroupList,
+                                    std::vector< std::map< TS, TM > >* results,
+                                    const ViewTaskCancellationToken token,
+                                    int first,
+                                    int stride);
+
+    // trace events of one function generated by a worker of ShowTraceDetail
+    struct TraceFunctionEvents {
+        QString functionName;
+        TraceEventStore store;
+    };
+
+    // hands the trace events of the functions from the workers of ShowTraceDetail to the emitting thread in function order
+    struct TraceFunctionQueue {
+        QMutex mutex;
+        QWaitCondition condition;                       // signaled when a function is finished or emitted
+        std::vector< TraceFunctionEvents > events;      // trace events of the functions finished and not emitted yet
+        QVector< bool > finished;                       // indicates whether each function is finished
+        int nextFunction;                               // the next function taken by a worker
+        int nextEmitted;                                // the next function taken by the emitting thread
+        int window;                                     // maximum number of functions taken ahead of the next function emitted
+        bool stopped;                                   // the emitting thread has stopped taking functions
+    };
+
+    template <typename DETAIL_t>
+    void processTraceFunctions(const std::vector< const std::pair< const OpenSpeedShop::Framework::Function,
+                                    std::map< OpenSpeedShop::Framework::Thread,
+                                        std::map< OpenSpeedShop::Framework::StackTrace, DETAIL_t > > >* >* functions,
+                               const OpenSpeedShop::Framework::Time::value_type time_origin,
+                               TraceFunctionQueue* queue,
+                               const ViewTaskCancellationToken token);
+
+    // sample counter totals of one view item generated by a worker of ShowSampleCountersDetail
+    struct SampleCounterTotals {
+        QString locationName;
+        QVector< qulonglong > sampleCount;
+        double time;
+    };
+
+    template <typename TS, typename DETAIL_t>
+    void processSampleCounterItems(const std::vector< const std::pair< const TS,
+                                        std::map< OpenSpeedShop::Framework::Thread,
+                                            std::map< OpenSpeedShop::Framework::StackTrace, DETAIL_t > > >* >* items,
+                                   const int sampleCounterCount,
+                                   std::vector< SampleCounterTotals >* results,
+                                   const ViewTaskCancellationToken token,
+                                   int first,
+                                   int stride);
+
     template <typename TS>
     std::set<TS> getThreadSet(const OpenSpeedShop::Framework::ThreadGroup& threads) { }
 
@@ -352,7 +410,7 @@ private:
     QStringList getMetricsDesc(const QStringList& eventNames) const { QStringList list( eventNames ); list.prepend( s_timeTitle ); list << s_functionTitle; return list; }
 
     template <typename DETAIL_t>
-    void getTraceMetricValues(const QString& functionName, const OpenSpeedShop::Framework::Time::value_type time_origin, const DETAIL_t& details, QVector<QVariantList>& metricData);
+    void getTraceMetricValues(int functionId, const OpenSpeedShop::Framework::Time::value_type time_origin, const DETAIL_t& details, TraceEventStore& store);
 
     template <typename DETAIL_t>
     void ShowCalltreeDetail(const OpenSpeedShop::Framework::Collector& collector,
@@ -441,9 +499,13 @@ private:
                        const ArgoNavis::Base::ThreadName& thread,
                        QMap< Base::ThreadName, bool >& flags);
 
-    void monitorMetricViewComplete(const QVector<QFuture<void> > *futures, const QString &clusteringCriteriaName, const QString modeName, const QString metricName, const QString viewName, double lower, double upper);
+    void requestMetricView(const QString& clusteringCriteriaName, const QString& metricName, const QString& viewName, ViewTaskScheduler::Priority priority);
 
-    QVector< QFuture<void> >* allocateFutureVector(const QString &clusteringCriteriaName, const QString& metricViewName);
+    void handleMetricViewComplete(bool canceled, const QString &clusteringCriteriaName, const QString modeName, const QString metricName, const QString viewName, double lower, double upper);
+
+    void handleCompareViewComplete(bool canceled, const QString &clusteringCriteriaName, const QString compareMode, const QString metricName, const QString viewName, double lower, double upper);
+
+    QByteArray getMetricViewCacheKey(const QString& clusteringCriteriaName, const QStringList& viewDescription, const OpenSpeedShop::Framework::TimeInterval& interval, const QList< OpenSpeedShop::Framework::ThreadGroup >& threadGroups) const;
 
     static QMap< QString, QMap< QString, QString > > INIT_TRACING_EXPERIMENTS_GRAPH_TITLES();
 
@@ -497,6 +559,9 @@ private:
 
     QMap< QString, MetricTableViewInfo > m_tableViewInfo;
 
+    // persistent cache of metric view tables
+    MetricViewCache m_viewCache;
+
     UserGraphRangeChangeManager m_userChangeMgr;
 
     struct {
@@ -510,16 +575,15 @@ private:
     } details_compare;
 
     QMap< QString, QSet< QString > > m_selectedClusters;
+    QMap< QString, QSharedPointer< ThreadGroupIndex > > m_threadGroupIndexes;
     QMutex m_mutex;
 
-    // outer map: key=clustering criteria name  value: inner map of future vectors for each metric view
-    // inner map: key=metric view name  value: vector of futures providing work for generating the metric view
-    QMap< QString, QMap< QString, QVector< QFuture<void> >* > > m_futureMap;
-    QMutex m_futureMapMutex;
-
     QAtomicInt m_numberLoadWorkUnitsInProgress;
     QAtomicInt m_loadInProgress;
 
+    // runs the work for generating metric views (declared last so it is destroyed before the state the work uses)
+    ViewTaskScheduler m_scheduler;
+
 };
 
 
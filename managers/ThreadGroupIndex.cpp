@@ -0,0 +1,282 @@
+/*!
+   \file ThreadGroupIndex.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "ThreadGroupIndex.h"
+
+#include "CBTF-ArgoNavis-Ext/ClusterNameBuilder.h"
+
+#include <tuple>
+#include <algorithm>
+
+using namespace OpenSpeedShop::Framework;
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/**
+ * @brief ThreadGroupIndex::ThreadGroupIndex
+ * @param group - the set of all threads of the experiment
+ *
+ * Constructs a ThreadGroupIndex instance for the specified set of threads.
+ */
+ThreadGroupIndex::ThreadGroupIndex(const ThreadGroup &group)
+{
+    const int count = group.size();
+
+    m_threads.reserve( count );
+    m_clusterNames.reserve( count );
+    m_ranks.reserve( count );
+    m_hosts.reserve( count );
+    m_pids.reserve( count );
+    m_clusterIndexes.reserve( count );
+
+    for ( ThreadGroup::const_iterator iter = group.begin(); iter != group.end(); ++iter ) {
+        const Thread& thread( *iter );
+        const int index = m_threads.size();
+
+        m_threads.push_back( thread );
+
+        const QString clusterName = ArgoNavis::CUDA::getUniqueClusterName( thread );
+        m_clusterNames << clusterName;
+        m_clusterIndexes.insert( clusterName, index );
+
+        bool hasRank;
+        int rank;
+        std::tie( hasRank, rank ) = thread.getMPIRank();
+        m_ranks << ( hasRank ? rank : -1 );
+        if ( hasRank ) {
+            m_rankIndexes[ rank ] << index;
+        }
+
+        const QString host = getHostName( thread );
+        m_hosts << host;
+        m_hostIndexes[ host ] << index;
+
+        const int pid = thread.getProcessId();
+        m_pids << pid;
+        m_pidIndexes[ pid ] << index;
+    }
+}
+
+/**
+ * @brief ThreadGroupIndex::~ThreadGroupIndex
+ *
+ * Destroys the ThreadGroupIndex instance.
+ */
+ThreadGroupIndex::~ThreadGroupIndex()
+{
+
+}
+
+/**
+ * @brief ThreadGroupIndex::size
+ * @return - the number of threads in the index
+ */
+int ThreadGroupIndex::size() const
+{
+    return m_threads.size();
+}
+
+/**
+ * @brief ThreadGroupIndex::thread
+ * @param index - the thread index
+ * @return - the thread at the specified index
+ */
+const Thread &ThreadGroupIndex::thread(int index) const
+{
+    return m_threads.at( index );
+}
+
+/**
+ * @brief ThreadGroupIndex::clusterName
+ * @param index - the thread index
+ * @return - the unique cluster name of the thread at the specified index
+ */
+QString ThreadGroupIndex::clusterName(int index) const
+{
+    return m_clusterNames.at( index );
+}
+
+/**
+ * @brief ThreadGroupIndex::rank
+ * @param index - the thread index
+ * @return - the MPI rank of the thread at the specified index or -1 if the thread has no rank
+ */
+int ThreadGroupIndex::rank(int index) const
+{
+    return m_ranks.at( index );
+}
+
+/**
+ * @brief ThreadGroupIndex::indexOf
+ * @param clusterName - the unique cluster name
+ * @return - the index of the thread with the specified cluster name or -1 if not found
+ */
+int ThreadGroupIndex::indexOf(const QString &clusterName) const
+{
+    return m_clusterIndexes.value( clusterName, -1 );
+}
+
+/**
+ * @brief ThreadGroupIndex::getClusterNames
+ * @return - the unique cluster names of all threads in index order
+ */
+QStringList ThreadGroupIndex::getClusterNames() const
+{
+    QStringList clusterNames;
+
+    clusterNames.reserve( m_clusterNames.size() );
+
+    foreach ( const QString& clusterName, m_clusterNames ) {
+        clusterNames << clusterName;
+    }
+
+    return clusterNames;
+}
+
+/**
+ * @brief ThreadGroupIndex::getThreadGroup
+ * @param clusterNames - the set of selected cluster names
+ * @return - the set of threads having one of the selected cluster names
+ */
+ThreadGroup ThreadGroupIndex::getThreadGroup(const QSet<QString> &clusterNames) const
+{
+    QVector< int > indexes;
+
+    indexes.reserve( clusterNames.size() );
+
+    foreach ( const QString& clusterName, clusterNames ) {
+        const int index = indexOf( clusterName );
+        if ( index != -1 ) {
+            indexes << index;
+        }
+    }
+
+    std::sort( indexes.begin(), indexes.end() );
+
+    return getThreadGroup( indexes );
+}
+
+/**
+ * @brief ThreadGroupIndex::getThreadGroupsByRank
+ * @param clusterNames - the set of selected cluster names
+ * @return - for each MPI rank of the selected threads, the set of all threads having that rank
+ */
+QList<ThreadGroup> ThreadGroupIndex::getThreadGroupsByRank(const QSet<QString> &clusterNames) const
+{
+    return getThreadGroupsByKey( clusterNames, m_ranks, m_rankIndexes );
+}
+
+/**
+ * @brief ThreadGroupIndex::getThreadGroupsByHost
+ * @param clusterNames - the set of selected cluster names
+ * @return - for each host of the selected threads, the set of all threads on that host
+ */
+QList<ThreadGroup> ThreadGroupIndex::getThreadGroupsByHost(const QSet<QString> &clusterNames) const
+{
+    return getThreadGroupsByKey( clusterNames, m_hosts, m_hostIndexes );
+}
+
+/**
+ * @brief ThreadGroupIndex::getThreadGroupsByProcess
+ * @param clusterNames - the set of selected cluster names
+ * @return - for each process of the selected threads, the set of all threads of that process
+ */
+QList<ThreadGroup> ThreadGroupIndex::getThreadGroupsByProcess(const QSet<QString> &clusterNames) const
+{
+    return getThreadGroupsByKey( clusterNames, m_pids, m_pidIndexes );
+}
+
+/**
+ * @brief ThreadGroupIndex::getHostName
+ * @param thread - the thread
+ * @return - the host name of the thread (without domain if HAS_STRIP_DOMAIN_NAME is defined)
+ */
+QString ThreadGroupIndex::getHostName(const Thread &thread)
+{
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
+    QString hostName = QString::fromStdString( thread.getHost() );
+#else
+    QString hostName = QString( thread.getHost().c_str() );
+#endif
+#ifdef HAS_STRIP_DOMAIN_NAME
+    int index = hostName.indexOf( '.' );
+    if ( index > 0 )
+        hostName = hostName.left( index );
+#endif
+    return hostName;
+}
+
+/**
+ * @brief ThreadGroupIndex::getThreadGroup
+ * @param indexes - the thread indexes in ascending order
+ * @return - the set of threads at the specified indexes
+ *
+ * The threads are stored in thread group order, so inserting them in ascending index order appends to the set.
+ */
+ThreadGroup ThreadGroupIndex::getThreadGroup(const QVector<int> &indexes) const
+{
+    ThreadGroup threadGroup;
+
+    foreach ( int index, indexes ) {
+        threadGroup.insert( threadGroup.end(), m_threads[ index ] );
+    }
+
+    return threadGroup;
+}
+
+/**
+ * @brief ThreadGroupIndex::getThreadGroupsByKey
+ * @param clusterNames - the set of selected cluster names
+ * @param keys - the key of each thread
+ * @param keyIndexes - map of key to thread indexes
+ * @return - for each distinct key of the selected threads, the set of all threads having that key
+ */
+template <typename KEY>
+QList<ThreadGroup> ThreadGroupIndex::getThreadGroupsByKey(const QSet<QString> &clusterNames, const QVector<KEY> &keys, const QHash<KEY, QVector<int> > &keyIndexes) const
+{
+    QList< ThreadGroup > threadGroupList;
+    QSet< KEY > selectedKeys;
+
+    foreach ( const QString& clusterName, clusterNames ) {
+        const int index = indexOf( clusterName );
+        if ( index != -1 ) {
+            selectedKeys.insert( keys.at( index ) );
+        }
+    }
+
+    foreach ( const KEY& key, selectedKeys ) {
+        typename QHash< KEY, QVector< int > >::const_iterator iter = keyIndexes.constFind( key );
+        // don't insert an empty ThreadGroup
+        if ( iter != keyIndexes.constEnd() && ! iter.value().isEmpty() ) {
+            threadGroupList.append( getThreadGroup( iter.value() ) );
+        }
+    }
+
+    return threadGroupList;
+}
+
+
+} // GUI
+} // ArgoNavis
@@ -0,0 +1,106 @@
+/*!
+   \file ThreadGroupIndex.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef THREADGROUPINDEX_H
+#define THREADGROUPINDEX_H
+
+#include "Thread.hxx"
+#include "ThreadGroup.hxx"
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QHash>
+#include <QSet>
+#include <QList>
+
+#include <vector>
+
+#include "common/openss-gui-config.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/*!
+ * \brief The ThreadGroupIndex class
+ *
+ * Index of the threads of an experiment built once when the experiment is loaded.  Each thread is assigned a
+ * dense index in thread group order and its unique cluster name, MPI rank, host name (with the domain stripped
+ * if configured) and process id are computed once.  The threads for a set of selected cluster names and the
+ * thread groups for the compare by rank, host and process views are then found without scanning all threads
+ * for each selected item.
+ */
+
+class ThreadGroupIndex
+{
+public:
+
+    explicit ThreadGroupIndex(const OpenSpeedShop::Framework::ThreadGroup& group);
+    virtual ~ThreadGroupIndex();
+
+    int size() const;
+
+    const OpenSpeedShop::Framework::Thread& thread(int index) const;
+    QString clusterName(int index) const;
+    int rank(int index) const;
+    int indexOf(const QString& clusterName) const;
+
+    QStringList getClusterNames() const;
+
+    OpenSpeedShop::Framework::ThreadGroup getThreadGroup(const QSet< QString >& clusterNames) const;
+
+    QList< OpenSpeedShop::Framework::ThreadGroup > getThreadGroupsByRank(const QSet< QString >& clusterNames) const;
+    QList< OpenSpeedShop::Framework::ThreadGroup > getThreadGroupsByHost(const QSet< QString >& clusterNames) const;
+    QList< OpenSpeedShop::Framework::ThreadGroup > getThreadGroupsByProcess(const QSet< QString >& clusterNames) const;
+
+    static QString getHostName(const OpenSpeedShop::Framework::Thread& thread);
+
+private:
+
+    OpenSpeedShop::Framework::ThreadGroup getThreadGroup(const QVector< int >& indexes) const;
+
+    template <typename KEY>
+    QList< OpenSpeedShop::Framework::ThreadGroup > getThreadGroupsByKey(const QSet< QString >& clusterNames,
+                                                                         const QVector< KEY >& keys,
+                                                                         const QHash< KEY, QVector< int > >& keyIndexes) const;
+
+    std::vector< OpenSpeedShop::Framework::Thread > m_threads;
+    QVector< QString > m_clusterNames;
+    QHash< QString, int > m_clusterIndexes;       // map cluster name to thread index
+
+    QVector< int > m_ranks;                       // MPI rank of each thread (-1 if none)
+    QVector< QString > m_hosts;                   // host name of each thread
+    QVector< int > m_pids;                        // process id of each thread
+
+    QHash< int, QVector< int > > m_rankIndexes;       // map rank to thread indexes
+    QHash< QString, QVector< int > > m_hostIndexes;   // map host name to thread indexes
+    QHash< int, QVector< int > > m_pidIndexes;        // map process id to thread indexes
+
+};
+
+
+} // GUI
+} // ArgoNavis
+
+#endif // THREADGROUPINDEX_H
@@ -0,0 +1,432 @@
+/*!
+   \file TraceEventStore.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "TraceEventStore.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/**
+ * @brief TraceEventStore::TraceEventStore
+ *
+ * Constructs an empty TraceEventStore instance.  The kind of the store is determined by the first event appended.
+ */
+TraceEventStore::TraceEventStore()
+    : m_kind( Unknown )
+{
+
+}
+
+/**
+ * @brief TraceEventStore::kind
+ * @return - the kind of trace events in the store
+ */
+TraceEventStore::Kind TraceEventStore::kind() const
+{
+    return m_kind;
+}
+
+/**
+ * @brief TraceEventStore::size
+ * @return - the number of events in the store
+ */
+int TraceEventStore::size() const
+{
+    return m_begin.size();
+}
+
+/**
+ * @brief TraceEventStore::isEmpty
+ * @return - whether the store contains no events
+ */
+bool TraceEventStore::isEmpty() const
+{
+    return m_begin.isEmpty();
+}
+
+/**
+ * @brief TraceEventStore::reserve
+ * @param size - the number of events expected
+ *
+ * Reserves space in the attribute vectors used by every kind of trace event.
+ */
+void TraceEventStore::reserve(int size)
+{
+    m_functionIds.reserve( size );
+    m_begin.reserve( size );
+    m_end.reserve( size );
+    m_duration.reserve( size );
+    m_rank.reserve( size );
+}
+
+/**
+ * @brief TraceEventStore::addFunction
+ * @param functionName - the function name displayed for events
+ * @return - the function id of the function name
+ *
+ * Interns the function name.  The same function id is returned for each occurrence of a function name.
+ */
+int TraceEventStore::addFunction(const QString &functionName)
+{
+    QHash< QString, int >::const_iterator iter = m_functionIndexes.constFind( functionName );
+
+    if ( iter != m_functionIndexes.constEnd() )
+        return iter.value();
+
+    const int functionId = m_functionNames.size();
+
+    m_functionNames << functionName;
+    m_functionIndexes.insert( functionName, functionId );
+
+    return functionId;
+}
+
+/**
+ * @brief TraceEventStore::getFunctionLabel
+ * @param functionName - the name of the traced function
+ * @param definingLocation - the defining location of the call site (may be empty)
+ * @return - the function label shown in the function column of the details table
+ *
+ * The label is the function name followed by the defining location of the call site in parentheses.
+ */
+QString TraceEventStore::getFunctionLabel(const QString &functionName, const QString &definingLocation)
+{
+    if ( definingLocation.isEmpty() )
+        return functionName;
+
+    return functionName + QStringLiteral(" (") + definingLocation + QStringLiteral(" )");
+}
+
+/**
+ * @brief TraceEventStore::getFunctionName
+ * @param functionLabel - the function label shown in the function column of the details table
+ * @return - the name of the traced function without the defining location
+ *
+ * Reverses TraceEventStore::getFunctionLabel.  The timeline names trace events by the function name only.
+ */
+QString TraceEventStore::getFunctionName(const QString &functionLabel)
+{
+    if ( ! functionLabel.endsWith( QStringLiteral(" )") ) )
+        return functionLabel;
+
+    const int index = functionLabel.lastIndexOf( QStringLiteral(" (") );
+
+    if ( index <= 0 )
+        return functionLabel;
+
+    return functionLabel.left( index );
+}
+
+/**
+ * @brief TraceEventStore::functionNames
+ * @return - the interned function names indexed by function id
+ */
+const QStringList &TraceEventStore::functionNames() const
+{
+    return m_functionNames;
+}
+
+/**
+ * @brief TraceEventStore::appendMPITEvent
+ * @param functionId - the function id of the event
+ * @param begin - the time begin (ms)
+ * @param end - the time end (ms)
+ * @param duration - the duration (ms)
+ * @param rank - the MPI rank
+ * @param source - the rank the message is from
+ * @param destination - the rank the message is to
+ * @param size - the message size
+ * @param retval - the return value of the function
+ */
+void TraceEventStore::appendMPITEvent(int functionId, double begin, double end, double duration, int rank, int source, int destination, quint64 size, int retval)
+{
+    appendEvent( MPITrace, functionId, begin, end, duration, rank );
+
+    m_arg1.push_back( source );
+    m_arg2.push_back( destination );
+    m_bytes.push_back( size );
+    m_retval.push_back( retval );
+}
+
+/**
+ * @brief TraceEventStore::appendIOTEvent
+ * @param functionId - the function id of the event
+ * @param begin - the time begin (ms)
+ * @param end - the time end (ms)
+ * @param duration - the duration (ms)
+ * @param rank - the MPI rank
+ * @param syscallno - the system call id
+ * @param retval - the return value of the function
+ */
+void TraceEventStore::appendIOTEvent(int functionId, double begin, double end, double duration, int rank, int syscallno, qint64 retval)
+{
+    appendEvent( IOTrace, functionId, begin, end, duration, rank );
+
+    m_arg1.push_back( syscallno );
+    m_retval.push_back( retval );
+}
+
+/**
+ * @brief TraceEventStore::appendMemEvent
+ * @param functionId - the function id of the event
+ * @param begin - the time begin (ms)
+ * @param end - the time end (ms)
+ * @param duration - the duration (ms)
+ * @param rank - the MPI rank
+ * @param threadId - the process/thread id
+ * @param allocation - the allocation size
+ * @param highwater - the new highwater
+ */
+void TraceEventStore::appendMemEvent(int functionId, double begin, double end, double duration, int rank, quint64 threadId, quint64 allocation, quint64 highwater)
+{
+    appendEvent( MemTrace, functionId, begin, end, duration, rank );
+
+    m_threadId.push_back( threadId );
+    m_bytes.push_back( allocation );
+    m_highwater.push_back( highwater );
+}
+
+/**
+ * @brief TraceEventStore::columnCount
+ * @return - the number of columns of the details table for the kind of trace events in the store
+ *
+ * The columns match the metric descriptions of the trace view: the function, time begin, time end, duration and rank of each
+ * event followed by the attributes specific to the kind of trace events.
+ */
+int TraceEventStore::columnCount() const
+{
+    switch ( m_kind ) {
+    case MPITrace:
+        return 9;
+    case IOTrace:
+        return 7;
+    case MemTrace:
+        return 8;
+    default:
+        return 5;
+    }
+}
+
+/**
+ * @brief TraceEventStore::columnType
+ * @param column - the column of the details table
+ * @return - the type of the vector holding the values of the column
+ */
+MetricViewDataBlock::ColumnType TraceEventStore::columnType(int column) const
+{
+    switch ( column ) {
+    case 0:
+        return MetricViewDataBlock::String;
+    case 1:
+    case 2:
+    case 3:
+        return MetricViewDataBlock::Double;
+    case 4:
+        return MetricViewDataBlock::SignedInteger;
+    default:
+        break;
+    }
+
+    if ( MemTrace == m_kind || ( MPITrace == m_kind && 7 == column ) )
+        return MetricViewDataBlock::UnsignedInteger;
+
+    return MetricViewDataBlock::SignedInteger;
+}
+
+/**
+ * @brief TraceEventStore::columnUserType
+ * @param column - the column of the details table
+ * @return - the QVariant user type of the values of the column
+ */
+int TraceEventStore::columnUserType(int column) const
+{
+    switch ( column ) {
+    case 0:
+        return QMetaType::QString;
+    case 1:
+    case 2:
+    case 3:
+        return QMetaType::Double;
+    case 4:
+        return QMetaType::Int;
+    default:
+        break;
+    }
+
+    switch ( m_kind ) {
+    case MPITrace:
+        return ( 7 == column ) ? QMetaType::ULong : QMetaType::Int;
+    case IOTrace:
+        return ( 5 == column ) ? QMetaType::Int : QMetaType::LongLong;
+    default:
+        return QMetaType::ULongLong;
+    }
+}
+
+/**
+ * @brief TraceEventStore::functionIdColumn
+ * @return - the function id of each event (the values of the function column)
+ */
+const QVector< int > &TraceEventStore::functionIdColumn() const
+{
+    return m_functionIds;
+}
+
+/**
+ * @brief TraceEventStore::doubleColumn
+ * @param column - a Double column of the details table
+ * @return - the values of the column
+ */
+const QVector< double > &TraceEventStore::doubleColumn(int column) const
+{
+    switch ( column ) {
+    case 1:
+        return m_begin;
+    case 2:
+        return m_end;
+    default:
+        return m_duration;
+    }
+}
+
+/**
+ * @brief TraceEventStore::signedColumn
+ * @param column - a SignedInteger column of the details table
+ * @return - the values of the column
+ */
+const QVector< qint64 > &TraceEventStore::signedColumn(int column) const
+{
+    switch ( column ) {
+    case 4:
+        return m_rank;
+    case 5:
+        return m_arg1;
+    case 6:
+        return ( MPITrace == m_kind ) ? m_arg2 : m_retval;
+    default:
+        return m_retval;
+    }
+}
+
+/**
+ * @brief TraceEventStore::unsignedColumn
+ * @param column - an UnsignedInteger column of the details table
+ * @return - the values of the column
+ */
+const QVector< quint64 > &TraceEventStore::unsignedColumn(int column) const
+{
+    switch ( column ) {
+    case 5:
+        return m_threadId;
+    case 6:
+        return m_bytes;
+    case 7:
+        return ( MPITrace == m_kind ) ? m_bytes : m_highwater;
+    default:
+        return m_highwater;
+    }
+}
+
+/**
+ * @brief TraceEventStore::getDataBlock
+ * @param first - the index of the first event
+ * @param count - the number of events
+ * @return - the rows of the details table for the specified events
+ *
+ * Builds the block for the details table from the typed attribute vectors of the columns of the details table.  The function
+ * names referenced by the events are re-encoded into a dictionary local to the block.
+ */
+MetricViewDataBlock TraceEventStore::getDataBlock(int first, int count) const
+{
+    MetricViewDataBlock block( count );
+
+    if ( first < 0 || count <= 0 || first + count > size() )
+        return block;
+
+    QVector< int > indexes;
+    QStringList dictionary;
+    QHash< int, int > dictionaryIndexes;    // map function id to index in the block dictionary
+
+    indexes.reserve( count );
+
+    for ( int i=first; i<first+count; ++i ) {
+        const int functionId = m_functionIds[ i ];
+        QHash< int, int >::const_iterator iter = dictionaryIndexes.constFind( functionId );
+        if ( iter == dictionaryIndexes.constEnd() ) {
+            const int index = dictionary.size();
+            dictionary << m_functionNames.at( functionId );
+            dictionaryIndexes.insert( functionId, index );
+            indexes.push_back( index );
+        }
+        else {
+            indexes.push_back( iter.value() );
+        }
+    }
+
+    block.appendStringColumn( indexes, dictionary );
+
+    for ( int column=1; column<columnCount(); ++column ) {
+        switch ( columnType( column ) ) {
+        case MetricViewDataBlock::Double:
+            block.appendDoubleColumn( doubleColumn( column ).mid( first, count ), columnUserType( column ) );
+            break;
+        case MetricViewDataBlock::SignedInteger:
+            block.appendSignedColumn( signedColumn( column ).mid( first, count ), columnUserType( column ) );
+            break;
+        default:
+            block.appendUnsignedColumn( unsignedColumn( column ).mid( first, count ), columnUserType( column ) );
+            break;
+        }
+    }
+
+    return block;
+}
+
+/**
+ * @brief TraceEventStore::appendEvent
+ * @param kind - the kind of the trace event
+ * @param functionId - the function id of the event
+ * @param begin - the time begin (ms)
+ * @param end - the time end (ms)
+ * @param duration - the duration (ms)
+ * @param rank - the MPI rank
+ *
+ * Appends the attributes common to every kind of trace event.
+ */
+void TraceEventStore::appendEvent(Kind kind, int functionId, double begin, double end, double duration, int rank)
+{
+    Q_ASSERT( Unknown == m_kind || kind == m_kind );
+
+    m_kind = kind;
+
+    m_functionIds.push_back( functionId );
+    m_begin.push_back( begin );
+    m_end.push_back( end );
+    m_duration.push_back( duration );
+    m_rank.push_back( rank );
+}
+
+
+} // GUI
+} // ArgoNavis
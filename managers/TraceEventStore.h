@@ -0,0 +1,135 @@
+/*!
+   \file TraceEventStore.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef TRACEEVENTSTORE_H
+#define TRACEEVENTSTORE_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QHash>
+#include <QSharedPointer>
+#include <QMetaType>
+
+#include "managers/MetricViewDataBlock.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/*!
+ * \brief The TraceEventStore class
+ *
+ * Typed struct-of-arrays storage of the events of a trace experiment (mpit, iot or mem).  The store is filled once
+ * from the query results of the trace view and, once finished, handed to the timeline and the details table as a
+ * shared pointer to const (TraceEventStorePtr), so it is not modified once published.  Each attribute is kept in its
+ * own typed vector, so reading the begin time or rank of an event does not unbox a QVariant.  The details table keeps
+ * the shared store and reads its cells in place through the column accessors, which map the columns of the details
+ * table for the kind of trace events to the typed vectors.  The timeline lane copies the begin time, end time and rank
+ * of each event into its own arrays, which it sorts by begin time across all functions, CUDA and sample events to
+ * build its interval index and summary.  The function name of each event is interned and referenced by a function id.
+ */
+
+class TraceEventStore
+{
+public:
+
+    enum Kind {
+        Unknown,
+        MPITrace,       // MPI function trace events (mpit)
+        IOTrace,        // I/O function trace events (iot)
+        MemTrace        // memory function trace events (mem)
+    };
+
+    explicit TraceEventStore();
+
+    Kind kind() const;
+    int size() const;
+    bool isEmpty() const;
+
+    void reserve(int size);
+
+    int addFunction(const QString& functionName);
+    const QStringList& functionNames() const;
+
+    void appendMPITEvent(int functionId, double begin, double end, double duration, int rank,
+                         int source, int destination, quint64 size, int retval);
+    void appendIOTEvent(int functionId, double begin, double end, double duration, int rank,
+                        int syscallno, qint64 retval);
+    void appendMemEvent(int functionId, double begin, double end, double duration, int rank,
+                        quint64 threadId, quint64 allocation, quint64 highwater);
+
+    int functionId(int index) const { return m_functionIds[ index ]; }
+    double begin(int index) const { return m_begin[ index ]; }
+    double end(int index) const { return m_end[ index ]; }
+    double duration(int index) const { return m_duration[ index ]; }
+    int rank(int index) const { return m_rank[ index ]; }
+    quint64 bytes(int index) const { return m_bytes[ index ]; }
+    qint64 retval(int index) const { return m_retval[ index ]; }
+    quint64 highwater(int index) const { return m_highwater[ index ]; }
+
+    int columnCount() const;
+    MetricViewDataBlock::ColumnType columnType(int column) const;
+    int columnUserType(int column) const;
+    const QVector< int >& functionIdColumn() const;
+    const QVector< double >& doubleColumn(int column) const;
+    const QVector< qint64 >& signedColumn(int column) const;
+    const QVector< quint64 >& unsignedColumn(int column) const;
+
+    MetricViewDataBlock getDataBlock(int first, int count) const;
+
+    static QString getFunctionLabel(const QString& functionName, const QString& definingLocation);
+    static QString getFunctionName(const QString& functionLabel);
+
+private:
+
+    void appendEvent(Kind kind, int functionId, double begin, double end, double duration, int rank);
+
+    Kind m_kind;
+
+    QStringList m_functionNames;
+    QHash< QString, int > m_functionIndexes;    // map function name to function id
+
+    QVector< int > m_functionIds;
+    QVector< double > m_begin;                  // time begin (ms)
+    QVector< double > m_end;                    // time end (ms)
+    QVector< double > m_duration;               // duration (ms)
+    QVector< qint64 > m_rank;                   // MPI rank
+    QVector< qint64 > m_arg1;                   // mpit: from rank  iot: system call id
+    QVector< qint64 > m_arg2;                   // mpit: to rank
+    QVector< quint64 > m_threadId;              // mem: process/thread id
+    QVector< quint64 > m_bytes;                 // mpit: message size  mem: allocation size
+    QVector< qint64 > m_retval;                 // mpit, iot: return value
+    QVector< quint64 > m_highwater;             // mem: new highwater
+
+};
+
+typedef QSharedPointer< const TraceEventStore > TraceEventStorePtr;
+
+
+} // GUI
+} // ArgoNavis
+
+Q_DECLARE_METATYPE( ArgoNavis::GUI::TraceEventStorePtr )
+
+#endif // TRACEEVENTSTORE_H
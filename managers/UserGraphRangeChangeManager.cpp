@@ -24,8 +24,8 @@
 #include "UserGraphRangeChangeManager.h"
 
 #include <QThread>
-#include <QTimer>
-#include <QVariant>
+#include <QMutexLocker>
+#include <QList>
 #include <QDebug>
 
 #define GRAPH_RANGE_CHANGE_DELAY_TO_CUDA_EVENT_PROCESSING 800
@@ -34,6 +34,10 @@
 namespace ArgoNavis { namespace GUI {
 
 
+// interval of the shared timer checking the deadlines of the pending changes
+const int TIMER_TICK_INTERVAL = 50;
+
+
 /**
  * @brief UserGraphRangeChangeManager::UserGraphRangeChangeManager
  * @param parent - the parent QObject instance
@@ -42,8 +46,16 @@ namespace ArgoNavis { namespace GUI {
  */
 UserGraphRangeChangeManager::UserGraphRangeChangeManager(QObject *parent)
     : QObject( parent )
+    , m_timer( this )
+    , m_delay( GRAPH_RANGE_CHANGE_DELAY_TO_CUDA_EVENT_PROCESSING )
+    , m_maxWait( 0 )
+    , m_timerActive( false )
 {
-    m_thread.start();
+    m_clock.start();
+
+    m_timer.setInterval( TIMER_TICK_INTERVAL );
+
+    connect( &m_timer, SIGNAL(timeout()), this, SLOT(handleTimeout()) );
 }
 
 /**
@@ -53,8 +65,29 @@ UserGraphRangeChangeManager::UserGraphRangeChangeManager(QObject *parent)
  */
 UserGraphRangeChangeManager::~UserGraphRangeChangeManager()
 {
-    m_thread.quit();
-    m_thread.wait();
+
+}
+
+/**
+ * @brief UserGraphRangeChangeManager::setDelay
+ * @param msec - the period without further changes after which the trailing timeout is emitted
+ */
+void UserGraphRangeChangeManager::setDelay(int msec)
+{
+    QMutexLocker guard( &m_mutex );
+
+    m_delay = msec;
+}
+
+/**
+ * @brief UserGraphRangeChangeManager::setMaxWait
+ * @param msec - the maximum period between timeouts during a continuous series of changes (0 disables intermediate timeouts)
+ */
+void UserGraphRangeChangeManager::setMaxWait(int msec)
+{
+    QMutexLocker guard( &m_mutex );
+
+    m_maxWait = msec;
 }
 
 /**
@@ -65,40 +98,41 @@ UserGraphRangeChangeManager::~UserGraphRangeChangeManager()
  * @param upper - the upper value of the graph range change
  * @param size - the size of the axis rect
  *
- * This method creates and starts a timer to delay processing of the graph range change until the timeout threshold has
- * been reached without further user interaction to change the graph range.
+ * This method records the graph range change as the latest change of the item and moves the deadline of the item so that
+ * processing of the graph range change is delayed until the timeout threshold has been reached without further user
+ * interaction to change the graph range.  The shared timer is started when the first change becomes pending.
  */
 void UserGraphRangeChangeManager::create(const QString &group, const QString &item, double lower, double upper, const QSize &size)
 {
-    QTimer* timer = new QTimer;
-    if ( timer ) {
-        // timer is single-shot expiring in 500ms
-        timer->setSingleShot( true );
-        timer->setInterval( GRAPH_RANGE_CHANGE_DELAY_TO_CUDA_EVENT_PROCESSING );
-        // add timer to timer map
-        {
-            QMutexLocker guard( &m_mutex );
-            m_timers.insert( item, timer );
-            m_activeMap[ group ].insert( item );
+    bool startTimer( false );
+
+    {
+        QMutexLocker guard( &m_mutex );
+
+        const qint64 now = m_clock.elapsed();
+
+        QMap< QString, PendingChange >& pending = m_pending[ group ];
+
+        if ( ! pending.contains( item ) ) {
+            PendingChange& change = pending[ item ];
+            change.maxDeadline = now + m_maxWait;
+        }
+
+        PendingChange& change = pending[ item ];
+        change.lower = lower;
+        change.upper = upper;
+        change.size = size;
+        change.deadline = now + m_delay;
+
+        if ( ! m_timerActive ) {
+            m_timerActive = true;
+            startTimer = true;
         }
-        // move timer to thread to let signals manage timer start/stop state
-        timer->moveToThread( &m_thread );
-        // setup the timer expiry handler to process the graph range change only if the waiting period completes
-        timer->setProperty( "group", group );
-        timer->setProperty( "item", item );
-        timer->setProperty( "lower", lower );
-        timer->setProperty( "upper", upper );
-        timer->setProperty( "size", size );
-        // connect timer timeout signal to handler
-        connect( timer, SIGNAL(timeout()), this, SLOT(handleTimeout()) );
-#ifdef HAS_TIMER_THREAD_DESTROYED_CHECKING
-        connect( timer, SIGNAL(destroyed(QObject*)), this, SLOT(timerDestroyed(QObject*)) );
-#endif
-        // start the timer
-        QMetaObject::invokeMethod( timer, "start", Qt::QueuedConnection );
     }
-    else {
-        qWarning() << "Not able to allocate timer";
+
+    if ( startTimer ) {
+        // the timer can only be started from the thread of this instance
+        QMetaObject::invokeMethod( &m_timer, "start", ( QThread::currentThread() == thread() ) ? Qt::DirectConnection : Qt::QueuedConnection );
     }
 }
 
@@ -106,16 +140,17 @@ void UserGraphRangeChangeManager::create(const QString &group, const QString &it
  * @brief UserGraphRangeChangeManager::cancel
  * @param item - the name of the item being tracked
  *
- * This method cancels the timer associated with the named item.
+ * This method discards the pending change of the named item.
  */
 void UserGraphRangeChangeManager::cancel(const QString &item)
 {
     QMutexLocker guard( &m_mutex );
-    if ( m_timers.contains( item ) ) {
-        QTimer* timer = m_timers.take( item );
-        if ( timer ) {
-            QMetaObject::invokeMethod( timer, "stop", Qt::QueuedConnection );
-            timer->deleteLater();
+
+    QMutableMapIterator< QString, QMap< QString, PendingChange > > iter( m_pending );
+    while ( iter.hasNext() ) {
+        iter.next();
+        if ( iter.value().remove( item ) && iter.value().isEmpty() ) {
+            iter.remove();
         }
     }
 }
@@ -123,52 +158,66 @@ void UserGraphRangeChangeManager::cancel(const QString &item)
 /**
  * @brief UserGraphRangeChangeManager::handleTimeout
  *
- * This is the handler for the QTimer::timeout signal for any timer created and started by the UserGraphRangeChangeManager::create method.
+ * This is the handler for the QTimer::timeout signal of the shared timer.  The timeouts of all pending changes whose
+ * deadline has passed are emitted.  The timer is stopped once no changes are pending.
  */
 void UserGraphRangeChangeManager::handleTimeout()
 {
-    QTimer* timer = qobject_cast< QTimer* >( sender() );
-
-    if ( ! timer )
-        return;
-
-    QString group = timer->property( "group" ).toString();
-    QString item = timer->property( "item" ).toString();
-
-    double lower = timer->property( "lower" ).toDouble();
-    double upper = timer->property( "upper" ).toDouble();
-    QSize size = timer->property( "size" ).toSize();
+    QList< FiredChange > fired;
+
+    {
+        QMutexLocker guard( &m_mutex );
+
+        const qint64 now = m_clock.elapsed();
+
+        QMutableMapIterator< QString, QMap< QString, PendingChange > > giter( m_pending );
+        while ( giter.hasNext() ) {
+            giter.next();
+
+            QMutableMapIterator< QString, PendingChange > iter( giter.value() );
+            while ( iter.hasNext() ) {
+                iter.next();
+
+                PendingChange& change = iter.value();
+
+                if ( now >= change.deadline ) {
+                    FiredChange firedChange = { giter.key(), iter.key(), change, false };
+                    iter.remove();
+                    firedChange.last = giter.value().isEmpty();
+                    fired << firedChange;
+                }
+                else if ( m_maxWait > 0 && now >= change.maxDeadline ) {
+                    FiredChange firedChange = { giter.key(), iter.key(), change, false };
+                    change.maxDeadline = now + m_maxWait;
+                    fired << firedChange;
+                }
+            }
+
+            if ( giter.value().isEmpty() ) {
+                giter.remove();
+            }
+        }
 
-    qDebug() << "UserGraphRangeChangeManager::handleTimeout: item=" << item << " lower=" << lower << " upper=" << upper;
+        if ( m_pending.isEmpty() ) {
+            m_timer.stop();
+            m_timerActive = false;
+        }
+    }
 
-    emit timeout( group, item, lower, upper, size );
+    // emit the signals without holding the lock so handlers may request further changes
+    foreach ( const FiredChange& firedChange, fired ) {
+        const PendingChange& change = firedChange.change;
 
-    cancel( item );
+        qDebug() << "UserGraphRangeChangeManager::handleTimeout: item=" << firedChange.item << " lower=" << change.lower << " upper=" << change.upper;
 
-    QMutexLocker guard( &m_mutex );
+        emit timeout( firedChange.group, firedChange.item, change.lower, change.upper, change.size );
 
-    if ( m_activeMap.contains( group ) ) {
-        QSet< QString>& active = m_activeMap[ group ];
-        if ( active.remove( item ) && active.isEmpty() ) {
-            emit timeoutGroup( group, lower, upper, size );
+        if ( firedChange.last ) {
+            emit timeoutGroup( firedChange.group, change.lower, change.upper, change.size );
         }
     }
 }
 
-#ifdef HAS_TIMER_THREAD_DESTROYED_CHECKING
-/**
- * @brief UserGraphRangeChangeManager::timerDestroyed
- * @param obj - the QObject instance destroyed
- *
- * This is the handler for the QTimer::destroyed signal used for debugging purposes.
- */
-void UserGraphRangeChangeManager::timerDestroyed(QObject* obj)
-{
-    Q_UNUSED( obj )
-    qDebug() << "TIMER DESTROYED!!";
-}
-#endif
-
 
 } // GUI
 } // ArgoNavis
@@ -29,9 +29,8 @@
 #include <QMap>
 #include <QSize>
 #include <QString>
-#include <QThread>
-
-class QTimer;
+#include <QTimer>
+#include <QElapsedTimer>
 
 
 #include "common/openss-gui-config.h"
@@ -40,6 +39,17 @@ class QTimer;
 namespace ArgoNavis { namespace GUI {
 
 
+/*!
+ * \brief The UserGraphRangeChangeManager class
+ *
+ * Coalesces graph range changes made by the user while zooming and panning.  The latest requested range of each
+ * (group, item) key is kept in a table and a single shared timer checks the deadlines of all keys.  The 'timeout'
+ * signal is emitted once no further change of the item was requested for the delay period (trailing edge).  When a
+ * maximum wait is set, 'timeout' is also emitted for the latest range each time the maximum wait elapses during a
+ * continuous series of changes, so long drags still produce periodic intermediate refreshes.  The 'timeoutGroup' signal
+ * is emitted when the trailing timeout of the last pending item of a group has been emitted.
+ */
+
 class UserGraphRangeChangeManager : public QObject
 {
     Q_OBJECT
@@ -50,6 +60,9 @@ public:
     explicit UserGraphRangeChangeManager(QObject *parent = 0);
     virtual ~UserGraphRangeChangeManager();
 
+    void setDelay(int msec);
+    void setMaxWait(int msec);
+
     void create(const QString &group, const QString &item, double lower, double upper, const QSize& size );
 
     void cancel(const QString& item);
@@ -63,16 +76,33 @@ private slots:
 
     void handleTimeout();
 
-#ifdef HAS_TIMER_THREAD_DESTROYED_CHECKING
-    void timerDestroyed(QObject* obj = Q_NULLPTR);
-#endif
-
 private:
 
+    struct PendingChange {
+        double lower;
+        double upper;
+        QSize size;
+        qint64 deadline;            // time of the trailing timeout
+        qint64 maxDeadline;         // time of the next intermediate timeout (if maximum wait is set)
+    };
+
+    struct FiredChange {
+        QString group;
+        QString item;
+        PendingChange change;
+        bool last;                  // trailing timeout of the last pending item of the group
+    };
+
     QMutex m_mutex;
-    QThread m_thread;
-    QMap< QString, QTimer* > m_timers;              // key=item
-    QMap< QString, QSet< QString > > m_activeMap;   // key=group
+    QTimer m_timer;
+    QElapsedTimer m_clock;
+    int m_delay;
+    int m_maxWait;
+    bool m_timerActive;
+
+    // outer map: key=group  value: inner map of pending changes
+    // inner map: key=item  value: the latest requested range change of the item
+    QMap< QString, QMap< QString, PendingChange > > m_pending;
 
 };
 
@@ -0,0 +1,318 @@
+/*!
+   \file ViewTaskScheduler.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "ViewTaskScheduler.h"
+
+#include <QRunnable>
+#include <QMutexLocker>
+
+#ifdef HAS_CONCURRENT_PROCESSING_VIEW_DEBUG
+#include <QDebug>
+#endif
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+// the cancellation token of the task group being run by the current thread (if any)
+static thread_local const ViewTaskCancellationToken* s_currentToken = Q_NULLPTR;
+
+
+/**
+ * @brief ViewTaskCancellationToken::ViewTaskCancellationToken
+ *
+ * Constructs a new token which has not been canceled.
+ */
+ViewTaskCancellationToken::ViewTaskCancellationToken()
+    : m_canceled( new QAtomicInt( 0 ) )
+{
+
+}
+
+/**
+ * @brief ViewTaskCancellationToken::cancel
+ *
+ * Cancel the token.  All copies of the token are canceled.
+ */
+void ViewTaskCancellationToken::cancel()
+{
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
+    m_canceled->storeRelease( 1 );
+#else
+    m_canceled->fetchAndStoreRelease( 1 );
+#endif
+}
+
+/**
+ * @brief ViewTaskCancellationToken::isCanceled
+ * @return - indicates whether the token has been canceled
+ */
+bool ViewTaskCancellationToken::isCanceled() const
+{
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
+    return m_canceled->loadAcquire() != 0;
+#else
+    return *m_canceled != 0;
+#endif
+}
+
+/**
+ * @brief ViewTaskCancellationToken::current
+ * @return - the token of the task run by the calling thread
+ *
+ * Returns the token of the task group whose task is run by the calling thread.  When the calling thread is not running
+ * a task of the ViewTaskScheduler a token is returned that is never canceled.
+ */
+ViewTaskCancellationToken ViewTaskCancellationToken::current()
+{
+    if ( s_currentToken )
+        return *s_currentToken;
+
+    return ViewTaskCancellationToken();
+}
+
+/**
+ * @brief ViewTaskCancellationToken::setCurrent
+ * @param token - the token of the task run by the calling thread or null when the task has finished
+ */
+void ViewTaskCancellationToken::setCurrent(const ViewTaskCancellationToken *token)
+{
+    s_currentToken = token;
+}
+
+
+/*!
+ * \brief The ViewTaskScheduler::TaskRunnable class
+ *
+ * Runs one task of a task group in the thread pool.  A task whose group was canceled before it was dequeued is skipped.
+ */
+class ViewTaskScheduler::TaskRunnable : public QRunnable
+{
+public:
+
+    TaskRunnable(ViewTaskScheduler* scheduler, const QSharedPointer< TaskGroup >& group, const Task& task)
+        : m_scheduler( scheduler )
+        , m_group( group )
+        , m_task( task )
+    {
+        setAutoDelete( true );
+    }
+
+    virtual void run() Q_DECL_OVERRIDE
+    {
+        if ( ! m_group->token.isCanceled() ) {
+            ViewTaskCancellationToken::setCurrent( &m_group->token );
+            m_task();
+            ViewTaskCancellationToken::setCurrent( Q_NULLPTR );
+        }
+
+        m_scheduler->taskFinished( m_group );
+    }
+
+private:
+
+    ViewTaskScheduler* m_scheduler;
+    QSharedPointer< TaskGroup > m_group;
+    Task m_task;
+
+};
+
+
+/**
+ * @brief ViewTaskScheduler::ViewTaskScheduler
+ *
+ * Constructs a ViewTaskScheduler instance with a dedicated thread pool.
+ */
+ViewTaskScheduler::ViewTaskScheduler()
+{
+
+}
+
+/**
+ * @brief ViewTaskScheduler::~ViewTaskScheduler
+ *
+ * Destroys the ViewTaskScheduler instance.  All task groups are canceled and the running tasks are waited for.
+ */
+ViewTaskScheduler::~ViewTaskScheduler()
+{
+    cancelAll();
+
+    m_pool.waitForDone();
+}
+
+/**
+ * @brief ViewTaskScheduler::submit
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @param metricViewName - the metric view name
+ * @param priority - the priority class of the task group
+ * @param tasks - the tasks to run for the metric view
+ * @param handler - the completion handler invoked once all tasks have finished
+ *
+ * Queue the tasks needed to generate the metric view.  Any active task group for the same metric view is canceled
+ * and its completion handler is invoked with the canceled flag set once its running tasks have returned.  The
+ * completion handler is invoked immediately when there are no tasks.
+ */
+void ViewTaskScheduler::submit(const QString &clusteringCriteriaName, const QString &metricViewName, Priority priority, const QList<Task> &tasks, const CompletionHandler &handler)
+{
+    QSharedPointer< TaskGroup > group( new TaskGroup );
+
+    group->clusteringCriteriaName = clusteringCriteriaName;
+    group->metricViewName = metricViewName;
+    group->handler = handler;
+
+    if ( tasks.isEmpty() ) {
+        if ( handler )
+            handler( false );
+        return;
+    }
+
+    // the completion handler is only invoked when the remaining count drops to zero after all tasks are queued
+    group->remaining.fetchAndStoreRelaxed( tasks.size() + 1 );
+
+    {
+        QMutexLocker guard( &m_mutex );
+
+        QMap< QString, QSharedPointer< TaskGroup > >& groups = m_groups[ clusteringCriteriaName ];
+
+        if ( groups.contains( metricViewName ) ) {
+#ifdef HAS_CONCURRENT_PROCESSING_VIEW_DEBUG
+            qDebug() << "ViewTaskScheduler::submit: canceling active task group for metricViewName=" << metricViewName;
+#endif
+            groups.value( metricViewName )->token.cancel();
+        }
+
+        groups.insert( metricViewName, group );
+    }
+
+    foreach ( const Task& task, tasks ) {
+        m_pool.start( new TaskRunnable( this, group, task ), priority );
+    }
+
+    taskFinished( group );
+}
+
+/**
+ * @brief ViewTaskScheduler::cancel
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @param metricViewName - the metric view name
+ *
+ * Cancel the active task group for the metric view.
+ */
+void ViewTaskScheduler::cancel(const QString &clusteringCriteriaName, const QString &metricViewName)
+{
+    QMutexLocker guard( &m_mutex );
+
+    if ( m_groups.contains( clusteringCriteriaName ) ) {
+        QSharedPointer< TaskGroup > group = m_groups[ clusteringCriteriaName ].value( metricViewName );
+        if ( group )
+            group->token.cancel();
+    }
+}
+
+/**
+ * @brief ViewTaskScheduler::cancelAll
+ * @param clusteringCriteriaName - the clustering criteria name
+ *
+ * Cancel all active task groups for the clustering criteria.
+ */
+void ViewTaskScheduler::cancelAll(const QString &clusteringCriteriaName)
+{
+    QMutexLocker guard( &m_mutex );
+
+    if ( m_groups.contains( clusteringCriteriaName ) ) {
+        foreach ( const QSharedPointer< TaskGroup >& group, m_groups[ clusteringCriteriaName ] ) {
+            group->token.cancel();
+        }
+    }
+}
+
+/**
+ * @brief ViewTaskScheduler::cancelAll
+ *
+ * Cancel all active task groups.
+ */
+void ViewTaskScheduler::cancelAll()
+{
+    QMutexLocker guard( &m_mutex );
+
+    foreach ( const QString& clusteringCriteriaName, m_groups.keys() ) {
+        foreach ( const QSharedPointer< TaskGroup >& group, m_groups[ clusteringCriteriaName ] ) {
+            group->token.cancel();
+        }
+    }
+}
+
+/**
+ * @brief ViewTaskScheduler::isActive
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @param metricViewName - the metric view name
+ * @return - indicates whether a task group for the metric view has not finished
+ */
+bool ViewTaskScheduler::isActive(const QString &clusteringCriteriaName, const QString &metricViewName) const
+{
+    QMutexLocker guard( &m_mutex );
+
+    return m_groups.contains( clusteringCriteriaName ) && m_groups[ clusteringCriteriaName ].contains( metricViewName );
+}
+
+/**
+ * @brief ViewTaskScheduler::waitForDone
+ *
+ * Wait for all queued and running tasks to finish.
+ */
+void ViewTaskScheduler::waitForDone()
+{
+    m_pool.waitForDone();
+}
+
+/**
+ * @brief ViewTaskScheduler::taskFinished
+ * @param group - the task group of the finished task
+ *
+ * Account for a finished task of the task group.  The last task to finish removes the group from the set of active
+ * groups (unless it has been replaced already) and invokes the completion handler.
+ */
+void ViewTaskScheduler::taskFinished(const QSharedPointer<TaskGroup> &group)
+{
+    if ( group->remaining.deref() )
+        return;
+
+    {
+        QMutexLocker guard( &m_mutex );
+
+        if ( m_groups.contains( group->clusteringCriteriaName ) ) {
+            QMap< QString, QSharedPointer< TaskGroup > >& groups = m_groups[ group->clusteringCriteriaName ];
+            if ( groups.value( group->metricViewName ) == group )
+                groups.remove( group->metricViewName );
+            if ( groups.isEmpty() )
+                m_groups.remove( group->clusteringCriteriaName );
+        }
+    }
+
+    if ( group->handler )
+        group->handler( group->token.isCanceled() );
+}
+
+
+} // GUI
+} // ArgoNavis
@@ -0,0 +1,139 @@
+/*!
+   \file ViewTaskScheduler.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VIEWTASKSCHEDULER_H
+#define VIEWTASKSCHEDULER_H
+
+#include <QString>
+#include <QList>
+#include <QMap>
+#include <QMutex>
+#include <QAtomicInt>
+#include <QSharedPointer>
+#include <QThreadPool>
+
+#include <functional>
+
+#include "common/openss-gui-config.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/*!
+ * \brief The ViewTaskCancellationToken class
+ *
+ * A cancellation token shared by all tasks of one task group.  Tasks check the token periodically and return
+ * early once it has been canceled.  Copies of a token share the same cancellation state.
+ */
+
+class ViewTaskCancellationToken
+{
+public:
+
+    ViewTaskCancellationToken();
+
+    void cancel();
+    bool isCanceled() const;
+
+    static ViewTaskCancellationToken current();
+
+private:
+
+    friend class ViewTaskScheduler;
+
+    static void setCurrent(const ViewTaskCancellationToken* token);
+
+    QSharedPointer< QAtomicInt > m_canceled;
+
+};
+
+
+/*!
+ * \brief The ViewTaskScheduler class
+ *
+ * Runs the work units needed to generate a metric view on a dedicated thread pool.  The work units of a metric view
+ * form a task group identified by clustering criteria name and metric view name.  Task groups have a priority class
+ * so that the work for the metric view the user is looking at is dequeued ahead of refresh and prefetch work.  When
+ * the last task of a group finishes the completion handler is invoked in that worker thread - no thread is blocked
+ * waiting for the group.  Submitting a group with the name of an active group cancels the active group.
+ */
+
+class ViewTaskScheduler
+{
+public:
+
+    enum Priority {
+        PrefetchPriority = 0,           // views computed in advance and not currently shown
+        RefreshPriority = 1,            // views recomputed for a change of the time interval
+        VisiblePriority = 2             // views explicitly requested by the user
+    };
+
+    typedef std::function< void() > Task;
+    typedef std::function< void(bool canceled) > CompletionHandler;
+
+    explicit ViewTaskScheduler();
+    virtual ~ViewTaskScheduler();
+
+    void submit(const QString& clusteringCriteriaName,
+                const QString& metricViewName,
+                Priority priority,
+                const QList< Task >& tasks,
+                const CompletionHandler& handler);
+
+    void cancel(const QString& clusteringCriteriaName, const QString& metricViewName);
+    void cancelAll(const QString& clusteringCriteriaName);
+    void cancelAll();
+
+    bool isActive(const QString& clusteringCriteriaName, const QString& metricViewName) const;
+
+    void waitForDone();
+
+private:
+
+    struct TaskGroup {
+        QString clusteringCriteriaName;
+        QString metricViewName;
+        ViewTaskCancellationToken token;
+        QAtomicInt remaining;           // number of tasks not yet finished
+        CompletionHandler handler;
+    };
+
+    class TaskRunnable;
+
+    void taskFinished(const QSharedPointer< TaskGroup >& group);
+
+    QThreadPool m_pool;
+
+    // outer map: key=clustering criteria name  value: inner map of active task groups for each metric view
+    // inner map: key=metric view name  value: the active task group generating the metric view
+    QMap< QString, QMap< QString, QSharedPointer< TaskGroup > > > m_groups;
+    mutable QMutex m_mutex;
+
+};
+
+
+} // GUI
+} // ArgoNavis
+
+#endif // VIEWTASKSCHEDULER_H
@@ -137,11 +137,11 @@ greaterThan(QT_MAJOR_VERSION, 4) {
 #DEFINES += HAS_EXPERIMENTAL_CONCURRENT_PLOT_TO_IMAGE
 }
 DEFINES += HAS_CONCURRENT_PROCESSING_VIEW_DEBUG
-#DEFINES += HAS_TIMER_THREAD_DESTROYED_CHECKING
 #DEFINES += HAS_PROCESS_EVENT_DEBUG
 #DEFINES += HAS_TEST_DATA_RANGE_CONSTRAINT
 DEFINES += HAS_SOURCE_CODE_LINE_HIGHLIGHTS
 DEFINES += HAS_STACKED_BAR_GRAPHS
+DEFINES += HAS_METRIC_VIEW_CACHE
 
 message("BOOST_ROOT="$$BOOST_ROOT)
 INCLUDEPATH += $$BOOST_ROOT/include
@@ -188,12 +188,8 @@ SOURCES += \
     QCustomPlot/CustomPlot.cpp \
     main/main.cpp \
     main/MainWindow.cpp \
-    graphitems/OSSDataTransferItem.cpp \
-    graphitems/OSSKernelExecutionItem.cpp \
-    graphitems/OSSEventItem.cpp \
-    graphitems/OSSPeriodicSampleItem.cpp \
+    graphitems/OSSEventLanePlottable.cpp \
     graphitems/OSSEventsSummaryItem.cpp \
-    graphitems/OSSTraceItem.cpp \
     widgets/TreeItem.cpp \
     widgets/TreeModel.cpp \
     widgets/ExperimentPanel.cpp \
@@ -218,6 +214,14 @@ SOURCES += \
     CBTF-ArgoNavis-Ext/CudaDeviceHelper.cpp \
     widgets/ThreadSelectionCommand.cpp \
     managers/MetricTableViewInfo.cpp \
+    managers/MetricViewDataBlock.cpp \
+    managers/MetricViewCache.cpp \
+    managers/ViewTaskScheduler.cpp \
+    managers/ThreadGroupIndex.cpp \
+    managers/TraceEventStore.cpp \
+    managers/EventIntervalIndex.cpp \
+    managers/CudaEventTileCache.cpp \
+    managers/CudaEventRasterizer.cpp \
     SourceView/SourceViewMetricsCache.cpp \
     graphitems/OSSHighlightItem.cpp \
     widgets/MetricViewFilterDialog.cpp \
@@ -228,7 +232,9 @@ SOURCES += \
     managers/DerivedMetricsSolver.cpp \
     widgets/DerivedMetricInformationDialog.cpp \
     widgets/ConfigureUserDerivedMetricsDialog.cpp \
-    widgets/DerivedMetricInformation.cpp
+    widgets/DerivedMetricInformation.cpp \
+    widgets/MetricTableModel.cpp \
+    widgets/MetricTableFilter.cpp
 
 greaterThan(QT_MAJOR_VERSION, 4): {
 # uncomment the following to produce XML dump of database
@@ -244,12 +250,8 @@ HEADERS += \
     QCustomPlot/$$QCUSTOMPLOTVER/qcustomplot.h \
     QCustomPlot/CustomPlot.h \
     main/MainWindow.h \
-    graphitems/OSSDataTransferItem.h \
-    graphitems/OSSKernelExecutionItem.h \
-    graphitems/OSSEventItem.h \
-    graphitems/OSSPeriodicSampleItem.h \
+    graphitems/OSSEventLanePlottable.h \
     graphitems/OSSEventsSummaryItem.h \
-    graphitems/OSSTraceItem.h \
     widgets/TreeItem.h \
     widgets/TreeModel.h \
     widgets/ExperimentPanel.h \
@@ -275,6 +277,15 @@ HEADERS += \
     CBTF-ArgoNavis-Ext/CudaDeviceHelper.h \
     widgets/ThreadSelectionCommand.h \
     managers/MetricTableViewInfo.h \
+    managers/MetricViewDataBlock.h \
+    managers/MetricReduction.h \
+    managers/MetricViewCache.h \
+    managers/ViewTaskScheduler.h \
+    managers/ThreadGroupIndex.h \
+    managers/TraceEventStore.h \
+    managers/EventIntervalIndex.h \
+    managers/CudaEventTileCache.h \
+    managers/CudaEventRasterizer.h \
     SourceView/SourceViewMetricsCache.h \
     graphitems/OSSHighlightItem.h \
     widgets/MetricViewFilterDialog.h \
@@ -285,7 +296,9 @@ HEADERS += \
     managers/DerivedMetricsSolver.h \
     widgets/DerivedMetricInformationDialog.h \
     widgets/ConfigureUserDerivedMetricsDialog.h \
-    widgets/DerivedMetricInformation.h
+    widgets/DerivedMetricInformation.h \
+    widgets/MetricTableModel.h \
+    widgets/MetricTableFilter.h
 
 FORMS += main/mainwindow.ui \
     widgets/PerformanceDataMetricView.ui \
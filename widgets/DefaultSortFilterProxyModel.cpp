@@ -23,6 +23,8 @@
 
 #include "DefaultSortFilterProxyModel.h"
 
+#include "MetricTableModel.h"
+
 
 namespace ArgoNavis { namespace GUI {
 
@@ -44,19 +46,191 @@ DefaultSortFilterProxyModel::DefaultSortFilterProxyModel(const QString &type, QO
 /**
  * @brief DefaultSortFilterProxyModel::~DefaultSortFilterProxyModel
  *
- * Destroys this DefaultSortFilterProxyModel instance.
+ * Destroys the DefaultSortFilterProxyModel instance.  A MetricTableModel source model no longer filters its rows by this proxy model.
+ */
+DefaultSortFilterProxyModel::~DefaultSortFilterProxyModel()
+{
+    MetricTableModel* model = qobject_cast< MetricTableModel* >( sourceModel() );
+
+    if ( model ) {
+        disconnect( model, Q_NULLPTR, this, Q_NULLPTR );
+        model->setRowFilter( MetricTableModel::RowFilter() );
+    }
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::setSourceModel
+ * @param sourceModel - the source model
+ *
+ * The method reimplements QSortFilterProxyModel::setSourceModel.  The current filter criteria are compiled for the new source model.
+ * A MetricTableModel source model is given the row filter of the proxy model so that it only exposes the rows accepted by the proxy
+ * model; the previous source model exposes all its rows again.
+ */
+void DefaultSortFilterProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    MetricTableModel* model = qobject_cast< MetricTableModel* >( this->sourceModel() );
+
+    if ( model && model != sourceModel )
+        model->setRowFilter( MetricTableModel::RowFilter() );
+
+    QSortFilterProxyModel::setSourceModel( sourceModel );
+
+    compileFilter();
+
+    invalidateRowFilter();
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::sort
+ * @param column - the proxy column to sort by
+ * @param order - the sort order
+ *
+ * The method reimplements QSortFilterProxyModel::sort.  When the source model is a MetricTableModel that can sort by the source
+ * column with the default string comparison, the source model exposes its rows in the order of its cached sort permutation and
+ * the proxy keeps the order of the source rows, so no rows are compared - the permutation is computed by a parallel sort on the
+ * first sort by the column and reused by later sorts in either order.  Otherwise the proxy sorts the rows by
+ * QSortFilterProxyModel::lessThan.
+ */
+void DefaultSortFilterProxyModel::sort(int column, Qt::SortOrder order)
+{
+    MetricTableModel* model = qobject_cast< MetricTableModel* >( sourceModel() );
+
+    if ( model ) {
+        const int modelColumn = sourceColumn( column );
+
+        if ( modelColumn >= 0 && model->isSortable( modelColumn ) &&
+             Qt::DisplayRole == sortRole() && Qt::CaseSensitive == sortCaseSensitivity() && ! isSortLocaleAware() ) {
+            if ( QSortFilterProxyModel::sortColumn() != -1 )
+                QSortFilterProxyModel::sort( -1, order );
+            model->sort( modelColumn, order );
+            return;
+        }
+
+        // restore the order of appending before the proxy sorts the rows
+        model->sort( -1, order );
+    }
+
+    QSortFilterProxyModel::sort( column, order );
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::setFilterCriteria
+ * @param criteria - list of criteria items - each consisting of a column name and filter regular expression
+ *
+ * Replaces the filter criteria and updates the proxy model.  When the source model is a MetricTableModel the criteria are
+ * compiled and evaluated for all source rows at once.
  */
 void DefaultSortFilterProxyModel::setFilterCriteria(const QList<QPair<QString, QString> > &criteria)
+{
+    m_filterCriteria = getColumnCriteria( criteria );
+
+    compileFilter();
+
+    invalidateRowFilter();
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::invalidateRowFilter
+ *
+ * Updates the proxy model after a change of the filter.  A MetricTableModel source model pages over its rows and would only offer
+ * the rows of the pages fetched so far to be filtered, so it is given a row filter testing its storage rows by
+ * DefaultSortFilterProxyModel::filterAcceptsStorageRow and finds the accepted rows of the first page again.  The source model is
+ * reset, which filters the rows of the proxy model again.  Otherwise the rows of the proxy model are filtered again.
+ */
+void DefaultSortFilterProxyModel::invalidateRowFilter()
+{
+    MetricTableModel* model = qobject_cast< MetricTableModel* >( sourceModel() );
+
+    if ( ! model ) {
+        invalidateFilter();
+        return;
+    }
+
+    if ( filtersStorageRows() )
+        model->setRowFilter( [this](int storageRow) { return filterAcceptsStorageRow( storageRow ); } );
+    else
+        model->setRowFilter( MetricTableModel::RowFilter() );
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::filtersStorageRows
+ * @return - indicates whether the proxy model rejects any rows of a MetricTableModel source model
+ */
+bool DefaultSortFilterProxyModel::filtersStorageRows() const
+{
+    return ! m_compiledFilter.isEmpty();
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::filterAcceptsStorageRow
+ * @param storageRow - the storage row of a MetricTableModel source model
+ * @return - indicates whether the storage row is accepted - the same as DefaultSortFilterProxyModel::filterAcceptsRow for the source row
+ *
+ * The result is looked up in the bitmap of the rows accepted by the compiled criteria.
+ */
+bool DefaultSortFilterProxyModel::filterAcceptsStorageRow(int storageRow) const
+{
+    return m_compiledFilter.acceptsStorageRow( storageRow );
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::countAcceptedRows
+ * @param criteria - list of criteria items - each consisting of a column name and filter regular expression
+ * @return - the number of source rows the criteria would accept
+ *
+ * Counts the source rows accepted by the criteria without changing the current filter criteria.  This allows the number of
+ * matching rows to be shown while the criteria are being edited.
+ */
+int DefaultSortFilterProxyModel::countAcceptedRows(const QList<QPair<QString, QString> > &criteria) const
+{
+    return countFilteredRows( criteria, QBitArray() );
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::countFilteredRows
+ * @param criteria - list of criteria items - each consisting of a column name and filter regular expression
+ * @param rejectedRows - set bit for each row (in storage order of a MetricTableModel) rejected by another filter
+ * @return - the number of source rows accepted by the criteria and not rejected
+ *
+ * When the source model is a MetricTableModel the cached compiled criteria items are combined and only new criteria items
+ * are evaluated; otherwise each source row is matched against the criteria.
+ */
+int DefaultSortFilterProxyModel::countFilteredRows(const QList<QPair<QString, QString> > &criteria, const QBitArray &rejectedRows) const
+{
+    const QList< QPair<int, QRegExp> > columnCriteria = getColumnCriteria( criteria );
+
+    if ( m_compiledFilter.model() && m_compiledFilter.model() == sourceModel() )
+        return m_compiledFilter.countAccepted( columnCriteria, rejectedRows );
+
+    int count( 0 );
+
+    for ( int row=0; sourceModel() && row<sourceModel()->rowCount(); ++row ) {
+        if ( acceptsCriteria( columnCriteria, row, QModelIndex() ) )
+            ++count;
+    }
+
+    return count;
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::getColumnCriteria
+ * @param criteria - list of criteria items - each consisting of a column name and filter regular expression
+ * @return - list of criteria items - each consisting of a column index and filter regular expression
+ *
+ * Maps the column names to column indexes of the source model.  Criteria items for unknown columns or having an invalid
+ * regular expression are dropped.
+ */
+QList< QPair<int, QRegExp> > DefaultSortFilterProxyModel::getColumnCriteria(const QList<QPair<QString, QString> > &criteria) const
 {
     QAbstractItemModel* model = sourceModel();
 
     QStringList modelColumnHeaders;
 
-    for (int i=0; i<model->columnCount(); ++i) {
-        modelColumnHeaders << sourceModel()->headerData( i, Qt::Horizontal ).toString();
+    for (int i=0; model && i<model->columnCount(); ++i) {
+        modelColumnHeaders << model->headerData( i, Qt::Horizontal ).toString();
     }
 
-    m_filterCriteria.clear();
+    QList< QPair<int, QRegExp> > columnCriteria;
 
     for ( QList< QPair<QString, QString> >::const_iterator iter = criteria.begin(); iter != criteria.end(); iter++ ) {
         const QPair<QString, QString>& item( *iter );
@@ -64,12 +238,49 @@ void DefaultSortFilterProxyModel::setFilterCriteria(const QList<QPair<QString, Q
         if ( modelColumnHeaders.contains( filterColumnName ) ) {
             QRegExp regularExpression( item.second );
             if ( regularExpression.isValid() ) {
-                m_filterCriteria << qMakePair( modelColumnHeaders.indexOf( filterColumnName ), regularExpression );
+                columnCriteria << qMakePair( modelColumnHeaders.indexOf( filterColumnName ), regularExpression );
             }
         }
     }
 
-    invalidateFilter();
+    return columnCriteria;
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::compileFilter
+ *
+ * Compiles the filter criteria for the typed column storage of the source model if it is a MetricTableModel.  The compiled
+ * criteria items of the previous criteria remain cached.
+ */
+void DefaultSortFilterProxyModel::compileFilter()
+{
+    const MetricTableModel* model = qobject_cast< const MetricTableModel* >( sourceModel() );
+
+    if ( model )
+        m_compiledFilter.setCriteria( model, m_filterCriteria );
+    else
+        m_compiledFilter.clear();
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::sourceColumn
+ * @param column - the proxy column
+ * @return - the source model column shown as the proxy column or -1 if there is none
+ *
+ * Maps the proxy column by the columns accepted by filterAcceptsColumn, so that the column is mapped while no rows are accepted.
+ */
+int DefaultSortFilterProxyModel::sourceColumn(int column) const
+{
+    QAbstractItemModel* model = sourceModel();
+
+    int proxyColumn( -1 );
+
+    for ( int i=0; model && column >= 0 && i<model->columnCount(); ++i ) {
+        if ( filterAcceptsColumn( i, QModelIndex() ) && ++proxyColumn == column )
+            return i;
+    }
+
+    return -1;
 }
 
 /**
@@ -82,12 +293,28 @@ void DefaultSortFilterProxyModel::setFilterCriteria(const QList<QPair<QString, Q
  *
  * This method implements a filter to keep the specified row only if the filter criteria matches the source row contents.
  * If no filter criteria was specified by DefaultSortFilterProxyModel::setFilterCriteria(), then the source row is accepted.
+ * When the criteria were compiled for the source model the result is looked up in the bitmap of accepted rows.
  */
 bool DefaultSortFilterProxyModel::filterAcceptsRow(int source_row, const QModelIndex &source_parent) const
+{
+    if ( m_compiledFilter.model() && m_compiledFilter.model() == sourceModel() && ! source_parent.isValid() )
+        return m_compiledFilter.acceptsRow( source_row );
+
+    return acceptsCriteria( m_filterCriteria, source_row, source_parent );
+}
+
+/**
+ * @brief DefaultSortFilterProxyModel::acceptsCriteria
+ * @param criteria - list of criteria items - each consisting of a column index and filter regular expression
+ * @param source_row - the row of the item in the model
+ * @param source_parent - the model index of the parent of the item in the model
+ * @return - indicates whether the source row contents match all criteria items
+ */
+bool DefaultSortFilterProxyModel::acceptsCriteria(const QList<QPair<int, QRegExp> > &criteria, int source_row, const QModelIndex &source_parent) const
 {
     bool keepRow( true );
 
-    for ( QList< QPair<int, QRegExp> >::const_iterator iter = m_filterCriteria.begin(); iter != m_filterCriteria.end(); iter++ ) {
+    for ( QList< QPair<int, QRegExp> >::const_iterator iter = criteria.begin(); iter != criteria.end(); iter++ ) {
         const QPair<int, QRegExp>& item( *iter );
 
         const QModelIndex sourceModelIndex = sourceModel()->index( source_row, item.first, source_parent );
@@ -100,6 +327,5 @@ bool DefaultSortFilterProxyModel::filterAcceptsRow(int source_row, const QModelI
     return keepRow;
 }
 
-
 } // GUI
 } // ArgoNavis
@@ -31,13 +31,19 @@
 #include <QString>
 #include <QStringList>
 #include <QRegExp>
+#include <QBitArray>
 
 #include "common/openss-gui-config.h"
 
+#include "MetricTableFilter.h"
+
 
 namespace ArgoNavis { namespace GUI {
 
 
+class MetricTableModel;
+
+
 class DefaultSortFilterProxyModel : public QSortFilterProxyModel
 {
     Q_OBJECT
@@ -45,6 +51,13 @@ class DefaultSortFilterProxyModel : public QSortFilterProxyModel
 public:
 
     explicit DefaultSortFilterProxyModel(const QString& type = QString(), QObject *parent = Q_NULLPTR);
+    virtual ~DefaultSortFilterProxyModel();
+
+    virtual void setSourceModel(QAbstractItemModel *sourceModel) Q_DECL_OVERRIDE;
+
+    virtual int countAcceptedRows(const QList<QPair<QString,QString>>& criteria) const;
+
+    virtual void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) Q_DECL_OVERRIDE;
 
 public slots:
 
@@ -54,6 +67,20 @@ protected:
 
     bool filterAcceptsRow(int source_row, const QModelIndex &source_parent) const Q_DECL_OVERRIDE;
 
+    int countFilteredRows(const QList<QPair<QString,QString>>& criteria, const QBitArray& rejectedRows) const;
+
+    virtual bool filtersStorageRows() const;
+    virtual bool filterAcceptsStorageRow(int storageRow) const;
+
+    void invalidateRowFilter();
+
+private:
+
+    QList< QPair<int, QRegExp> > getColumnCriteria(const QList<QPair<QString,QString>>& criteria) const;
+    bool acceptsCriteria(const QList< QPair<int, QRegExp> >& criteria, int source_row, const QModelIndex &source_parent) const;
+    void compileFilter();
+    int sourceColumn(int column) const;
+
 protected:
 
     QString m_type;
@@ -61,6 +88,9 @@ protected:
     // list of criteria - each individual criteria item consists of a column index and filter regular expression
     QList< QPair<int, QRegExp> > m_filterCriteria;
 
+    // criteria compiled for the typed column storage when the source model is a MetricTableModel
+    mutable MetricTableFilter m_compiledFilter;
+
 };
 
 
@@ -0,0 +1,532 @@
+/*!
+   \file MetricTableFilter.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "MetricTableFilter.h"
+
+#include "MetricTableModel.h"
+
+#include <QThread>
+#include <QtConcurrentRun>
+#include <QFutureSynchronizer>
+
+#include <limits>
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+// minimum number of rows evaluated by one task
+const int MIN_TASK_ROWS = 65536;
+
+// number of rows in one word of the bitmap of accepted rows
+const int WORD_ROWS = 32;
+
+// maximum number of compiled predicates cached in addition to those of the current criteria
+const int MAX_CACHED_PREDICATES = 16;
+
+
+/**
+ * @brief MetricTableFilter::MetricTableFilter
+ *
+ * Constructs an empty MetricTableFilter instance accepting all rows.
+ */
+MetricTableFilter::MetricTableFilter()
+    : m_model( Q_NULLPTR )
+    , m_evaluatedRows( 0 )
+{
+
+}
+
+/**
+ * @brief MetricTableFilter::~MetricTableFilter
+ *
+ * Destroys the MetricTableFilter instance.
+ */
+MetricTableFilter::~MetricTableFilter()
+{
+
+}
+
+/**
+ * @brief MetricTableFilter::setCriteria
+ * @param model - the model whose rows are filtered
+ * @param criteria - list of criteria items - each consisting of a column index and filter regular expression
+ *
+ * Sets the criteria and evaluates them for all rows of the model.  Criteria items compiled for the model before are taken
+ * from the cache and only their rows appended since are evaluated.  The cache is emptied when the model changes.
+ */
+void MetricTableFilter::setCriteria(const MetricTableModel *model, const QList<QPair<int, QRegExp> > &criteria)
+{
+    if ( model != m_model ) {
+        clear();
+        m_model = model;
+    }
+
+    m_predicates = getPredicates( criteria );
+
+    update( m_predicates );
+
+    combine( 0 );
+}
+
+/**
+ * @brief MetricTableFilter::clear
+ *
+ * Removes the model, criteria and cached predicates from the filter.
+ */
+void MetricTableFilter::clear()
+{
+    m_model = Q_NULLPTR;
+    m_predicates.clear();
+    m_cache.clear();
+    m_accepted.clear();
+    m_evaluatedRows = 0;
+}
+
+/**
+ * @brief MetricTableFilter::model
+ * @return - the model the criteria were compiled for
+ */
+const MetricTableModel *MetricTableFilter::model() const
+{
+    return m_model;
+}
+
+/**
+ * @brief MetricTableFilter::isEmpty
+ * @return - indicates whether the filter has no criteria (and so accepts all rows)
+ */
+bool MetricTableFilter::isEmpty() const
+{
+    return m_predicates.isEmpty();
+}
+
+/**
+ * @brief MetricTableFilter::acceptsRow
+ * @param row - the model row
+ * @return - indicates whether the row satisfies all criteria
+ *
+ * Tests the bit of the row in the bitmap of accepted rows.  When the row was appended after the last evaluation all rows
+ * not yet evaluated are evaluated first.
+ */
+bool MetricTableFilter::acceptsRow(int row)
+{
+    if ( ! m_model || m_predicates.isEmpty() )
+        return true;
+
+    return acceptsStorageRow( m_model->storageRow( row ) );
+}
+
+/**
+ * @brief MetricTableFilter::acceptsStorageRow
+ * @param storageRow - the storage row index
+ * @return - indicates whether the storage row satisfies all criteria
+ *
+ * Same as MetricTableFilter::acceptsRow for a storage row, which need not be exposed by the model.
+ */
+bool MetricTableFilter::acceptsStorageRow(int storageRow)
+{
+    if ( ! m_model || m_predicates.isEmpty() )
+        return true;
+
+    if ( storageRow < 0 )
+        return false;
+
+    if ( storageRow >= m_evaluatedRows ) {
+        update( m_predicates );
+        combine( m_evaluatedRows );
+        if ( storageRow >= m_evaluatedRows )
+            return false;
+    }
+
+    return ( m_accepted.at( storageRow / WORD_ROWS ) & ( 1u << ( storageRow % WORD_ROWS ) ) ) != 0;
+}
+
+/**
+ * @brief MetricTableFilter::countAccepted
+ * @param criteria - list of criteria items - each consisting of a column index and filter regular expression
+ * @param rejectedRows - set bit for each storage row rejected by another filter
+ * @return - the number of rows of the model satisfying all criteria items and not rejected
+ *
+ * Counts the rows accepted by the criteria without changing the current criteria.  The compiled criteria items are cached
+ * so a following call of MetricTableFilter::setCriteria with the same criteria only combines the cached bitmaps.
+ */
+int MetricTableFilter::countAccepted(const QList<QPair<int, QRegExp> > &criteria, const QBitArray &rejectedRows)
+{
+    if ( ! m_model )
+        return 0;
+
+    const QVector< PredicatePtr > predicates = getPredicates( criteria );
+
+    update( predicates );
+
+    const int rowCount = m_model->storageRowCount();
+    const int wordCount = ( rowCount + WORD_ROWS - 1 ) / WORD_ROWS;
+
+    int count( 0 );
+
+    for ( int word=0; word<wordCount; ++word ) {
+        quint32 bits = ( ( word + 1 ) * WORD_ROWS <= rowCount ) ? ~0u : ( ( 1u << ( rowCount % WORD_ROWS ) ) - 1 );
+
+        for ( int i=0; bits && i<predicates.size(); ++i ) {
+            bits &= predicates.at( i )->words.at( word );
+        }
+
+        if ( word * WORD_ROWS < rejectedRows.size() ) {
+            for ( int bit=0; bits && bit<WORD_ROWS; ++bit ) {
+                const int row = word * WORD_ROWS + bit;
+                if ( ( bits & ( 1u << bit ) ) && row < rejectedRows.size() && rejectedRows.testBit( row ) )
+                    bits &= ~( 1u << bit );
+            }
+        }
+
+        count += countBits( bits );
+    }
+
+    return count;
+}
+
+/**
+ * @brief MetricTableFilter::getPredicates
+ * @param criteria - list of criteria items - each consisting of a column index and filter regular expression
+ * @return - the compiled predicate of each criteria item
+ *
+ * Looks up the compiled predicate of each criteria item in the cache and compiles the criteria items not found.  Criteria
+ * items for a column not in the model are ignored.  The least recently used predicates beyond the cache limit are dropped.
+ */
+QVector< MetricTableFilter::PredicatePtr > MetricTableFilter::getPredicates(const QList<QPair<int, QRegExp> > &criteria)
+{
+    QVector< PredicatePtr > predicates;
+
+    for ( QList< QPair<int, QRegExp> >::const_iterator iter = criteria.begin(); iter != criteria.end(); iter++ ) {
+        const QPair<int, QRegExp>& item( *iter );
+
+        if ( item.first < 0 || item.first >= m_model->columnCount() )
+            continue;
+
+        PredicatePtr predicate;
+
+        for ( int i=0; i<m_cache.size(); ++i ) {
+            if ( m_cache.at( i )->column == item.first && m_cache.at( i )->regExp == item.second ) {
+                predicate = m_cache.takeAt( i );
+                break;
+            }
+        }
+
+        if ( ! predicate ) {
+            predicate = PredicatePtr( new Predicate );
+            predicate->column = item.first;
+            predicate->regExp = item.second;
+            compile( *predicate );
+        }
+
+        m_cache.prepend( predicate );
+
+        predicates << predicate;
+    }
+
+    for ( int i=m_cache.size()-1; i>=0 && m_cache.size()>MAX_CACHED_PREDICATES; --i ) {
+        if ( ! predicates.contains( m_cache.at( i ) ) && ! m_predicates.contains( m_cache.at( i ) ) )
+            m_cache.removeAt( i );
+    }
+
+    return predicates;
+}
+
+/**
+ * @brief MetricTableFilter::compile
+ * @param predicate - the predicate to compile
+ *
+ * Compiles the criteria item of the predicate for the current storage type of its column.  The bitmap of the predicate is emptied.
+ */
+void MetricTableFilter::compile(Predicate &predicate) const
+{
+    predicate.type = m_model->columnType( predicate.column );
+    predicate.nullMatches = ( predicate.regExp.indexIn( QString() ) != -1 );
+    predicate.stringMatches.clear();
+    predicate.words.clear();
+    predicate.evaluatedRows = 0;
+
+    if ( MetricViewDataBlock::String == predicate.type )
+        predicate.kind = StringMatch;
+    else if ( parseRange( predicate.regExp.pattern(), predicate ) )
+        predicate.kind = NumericRange;
+    else
+        predicate.kind = TextMatch;
+}
+
+/**
+ * @brief MetricTableFilter::update
+ * @param predicates - the predicates to update
+ *
+ * Evaluates each predicate for the rows appended since it was last evaluated.  If the storage type of the column of a
+ * predicate has changed since it was compiled, the predicate is compiled again and all rows are evaluated.
+ */
+void MetricTableFilter::update(const QVector<PredicatePtr> &predicates)
+{
+    foreach ( const PredicatePtr& predicate, predicates ) {
+        if ( m_model->columnType( predicate->column ) != predicate->type ) {
+            compile( *predicate );
+            m_evaluatedRows = 0;
+        }
+
+        evaluate( *predicate );
+    }
+}
+
+/**
+ * @brief MetricTableFilter::evaluate
+ * @param predicate - the predicate to evaluate
+ *
+ * Evaluates the predicate for the storage rows not yet evaluated.  The rows are split into ranges of whole bitmap words
+ * evaluated in parallel.
+ */
+void MetricTableFilter::evaluate(Predicate &predicate)
+{
+    const int rowCount = m_model->storageRowCount();
+
+    // the word holding the first row not yet evaluated is evaluated again in full
+    const int first = predicate.evaluatedRows - predicate.evaluatedRows % WORD_ROWS;
+
+    if ( predicate.evaluatedRows >= rowCount )
+        return;
+
+    if ( StringMatch == predicate.kind ) {
+        // run the regular expression for the strings interned since the last evaluation
+        const int count = m_model->internedStringCount();
+        int id = predicate.stringMatches.size();
+        predicate.stringMatches.resize( count );
+        for ( ; id < count; ++id ) {
+            if ( predicate.regExp.indexIn( m_model->internedString( id ) ) != -1 )
+                predicate.stringMatches.setBit( id );
+        }
+    }
+
+    predicate.words.resize( ( rowCount + WORD_ROWS - 1 ) / WORD_ROWS );
+
+    const int count = rowCount - first;
+    const int taskCount = qBound( 1, count / MIN_TASK_ROWS, QThread::idealThreadCount() );
+
+    if ( 1 == taskCount ) {
+        evaluateRange( &predicate, first, rowCount );
+    }
+    else {
+        // detach the bitmap once so that each task writes a disjoint range of words of the same bitmap
+        predicate.words.data();
+
+        QFutureSynchronizer<void> synchronizer;
+
+        for ( int task = 0; task < taskCount; ++task ) {
+            const int begin = first + ( qint64( count ) * task / taskCount ) / WORD_ROWS * WORD_ROWS;
+            const int end = ( task + 1 == taskCount ) ? rowCount : first + ( qint64( count ) * ( task + 1 ) / taskCount ) / WORD_ROWS * WORD_ROWS;
+            synchronizer.addFuture( QtConcurrent::run( this, &MetricTableFilter::evaluateRange, &predicate, begin, end ) );
+        }
+
+        synchronizer.waitForFinished();
+    }
+
+    predicate.evaluatedRows = rowCount;
+}
+
+/**
+ * @brief MetricTableFilter::evaluateRange
+ * @param predicate - the predicate to evaluate
+ * @param first - the first storage row of the range (the first row of a bitmap word)
+ * @param last - the storage row following the range
+ *
+ * Evaluates the predicate for the storage rows of the range and stores the result in the words of its bitmap covering the range.
+ */
+void MetricTableFilter::evaluateRange(Predicate *predicate, int first, int last) const
+{
+    // QRegExp keeps the state of the last match so each task uses its own copy
+    QRegExp regExp( predicate->regExp );
+
+    quint32* words = predicate->words.data();
+
+    for ( int word = first / WORD_ROWS; word * WORD_ROWS < last; ++word ) {
+        const int end = qMin( last, ( word + 1 ) * WORD_ROWS );
+
+        quint32 bits( 0 );
+
+        for ( int row = word * WORD_ROWS; row < end; ++row ) {
+            if ( acceptsValue( *predicate, regExp, row ) )
+                bits |= ( 1u << ( row % WORD_ROWS ) );
+        }
+
+        words[ word ] = bits;
+    }
+}
+
+/**
+ * @brief MetricTableFilter::acceptsValue
+ * @param predicate - the compiled criteria item
+ * @param regExp - the copy of the regular expression of the criteria item used by the calling task
+ * @param row - the storage row
+ * @return - indicates whether the cell of the row in the column of the criteria item satisfies the criteria item
+ */
+bool MetricTableFilter::acceptsValue(const Predicate &predicate, QRegExp &regExp, int row) const
+{
+    switch ( predicate.kind ) {
+    case StringMatch:
+    {
+        // empty cells of a String column have no interned string
+        const int id = m_model->stringId( row, predicate.column );
+        return ( id < 0 ) ? predicate.nullMatches : predicate.stringMatches.testBit( id );
+    }
+    case NumericRange:
+    {
+        if ( m_model->isNull( row, predicate.column ) )
+            return false;
+
+        double value;
+
+        switch ( predicate.type ) {
+        case MetricViewDataBlock::Double:
+            value = m_model->doubleValue( row, predicate.column );
+            break;
+        case MetricViewDataBlock::SignedInteger:
+            value = m_model->signedValue( row, predicate.column );
+            break;
+        case MetricViewDataBlock::UnsignedInteger:
+            value = m_model->unsignedValue( row, predicate.column );
+            break;
+        default:
+        {
+            bool ok;
+            value = m_model->storedValue( row, predicate.column ).toDouble( &ok );
+            if ( ! ok )
+                return false;
+            break;
+        }
+        }
+
+        if ( value < predicate.lower || ( value == predicate.lower && ! predicate.lowerInclusive ) )
+            return false;
+
+        return value < predicate.upper || ( value == predicate.upper && predicate.upperInclusive );
+    }
+    default:
+        return regExp.indexIn( m_model->storedValue( row, predicate.column ).toString() ) != -1;
+    }
+}
+
+/**
+ * @brief MetricTableFilter::combine
+ * @param first - the first storage row to combine
+ *
+ * Combines the bitmaps of the current predicates into the bitmap of accepted rows for the storage rows from the first row
+ * to the last row of the model.
+ */
+void MetricTableFilter::combine(int first)
+{
+    const int rowCount = m_model ? m_model->storageRowCount() : 0;
+    const int wordCount = ( rowCount + WORD_ROWS - 1 ) / WORD_ROWS;
+
+    m_accepted.resize( wordCount );
+
+    for ( int word = first / WORD_ROWS; word < wordCount; ++word ) {
+        quint32 bits( ~0u );
+
+        foreach ( const PredicatePtr& predicate, m_predicates ) {
+            bits &= predicate->words.at( word );
+        }
+
+        m_accepted[ word ] = bits;
+    }
+
+    m_evaluatedRows = rowCount;
+}
+
+/**
+ * @brief MetricTableFilter::parseRange
+ * @param pattern - the filter expression
+ * @param predicate - the predicate receiving the bounds of the range
+ * @return - indicates whether the filter expression consists only of numeric comparisons
+ *
+ * Parses a filter expression of one or more comparisons using the operators '<', '<=', '>', '>=', '=' and '==' separated by
+ * white space (e.g. ">=1.5 <10").  Such an expression can never match the text of a numeric cell as a regular expression.
+ */
+bool MetricTableFilter::parseRange(const QString &pattern, Predicate &predicate)
+{
+    const QRegExp comparison( "^(<=|>=|==|<|>|=)\\s*([-+]?(\\d+\\.?\\d*|\\.\\d+)([eE][-+]?\\d+)?)" );
+
+    predicate.lower = -std::numeric_limits<double>::infinity();
+    predicate.upper = std::numeric_limits<double>::infinity();
+    predicate.lowerInclusive = true;
+    predicate.upperInclusive = true;
+
+    bool found( false );
+    int pos( 0 );
+
+    forever {
+        while ( pos < pattern.size() && pattern.at( pos ).isSpace() )
+            ++pos;
+
+        if ( pos == pattern.size() )
+            break;
+
+        if ( comparison.indexIn( pattern, pos, QRegExp::CaretAtOffset ) != pos )
+            return false;
+
+        const QString op = comparison.cap( 1 );
+        const double value = comparison.cap( 2 ).toDouble();
+
+        if ( op.startsWith( '<' ) || op.startsWith( '=' ) ) {
+            const bool inclusive = ( op != "<" );
+            if ( value < predicate.upper || ( value == predicate.upper && ! inclusive ) ) {
+                predicate.upper = value;
+                predicate.upperInclusive = inclusive;
+            }
+        }
+
+        if ( op.startsWith( '>' ) || op.startsWith( '=' ) ) {
+            const bool inclusive = ( op != ">" );
+            if ( value > predicate.lower || ( value == predicate.lower && ! inclusive ) ) {
+                predicate.lower = value;
+                predicate.lowerInclusive = inclusive;
+            }
+        }
+
+        pos += comparison.matchedLength();
+        found = true;
+    }
+
+    return found;
+}
+
+/**
+ * @brief MetricTableFilter::countBits
+ * @param word - a word of a bitmap
+ * @return - the number of set bits of the word
+ */
+int MetricTableFilter::countBits(quint32 word)
+{
+    word = word - ( ( word >> 1 ) & 0x55555555u );
+    word = ( word & 0x33333333u ) + ( ( word >> 2 ) & 0x33333333u );
+
+    return ( ( ( word + ( word >> 4 ) ) & 0x0f0f0f0fu ) * 0x01010101u ) >> 24;
+}
+
+
+} // GUI
+} // ArgoNavis
@@ -0,0 +1,129 @@
+/*!
+   \file MetricTableFilter.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef METRICTABLEFILTER_H
+#define METRICTABLEFILTER_H
+
+#include <QList>
+#include <QPair>
+#include <QVector>
+#include <QRegExp>
+#include <QBitArray>
+#include <QSharedPointer>
+
+#include "common/openss-gui-config.h"
+
+#include "managers/MetricViewDataBlock.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+class MetricTableModel;
+
+
+/*!
+ * \brief The MetricTableFilter class
+ *
+ * Compiled form of the filter criteria of a metric table view.  Each criteria item is compiled once against the typed
+ * column storage of a MetricTableModel:
+ *  - for a String column the regular expression is run once for each interned string so that each row is tested by
+ *    looking up the interned string id of the cell;
+ *  - for a numeric column an expression consisting only of comparisons (e.g. ">=1.5 <10") is evaluated as a numeric
+ *    range on the stored values;
+ *  - any other criteria item is a regular expression matched against the text of the cell.
+ * Each compiled criteria item keeps the bitmap of the rows it accepts, evaluated in parallel over ranges of rows.  The
+ * compiled items of recently used criteria are cached so that adding or removing one criteria item only evaluates a
+ * new item (if any) and combines the cached bitmaps.  Rows appended to the model later are evaluated the first time
+ * one of them is tested.
+ */
+
+class MetricTableFilter
+{
+public:
+
+    explicit MetricTableFilter();
+    virtual ~MetricTableFilter();
+
+    void setCriteria(const MetricTableModel* model, const QList< QPair<int, QRegExp> >& criteria);
+    void clear();
+
+    const MetricTableModel* model() const;
+    bool isEmpty() const;
+
+    bool acceptsRow(int row);
+    bool acceptsStorageRow(int storageRow);
+
+    int countAccepted(const QList< QPair<int, QRegExp> >& criteria, const QBitArray& rejectedRows = QBitArray());
+
+private:
+
+    enum PredicateKind {
+        StringMatch,            // regular expression result looked up by interned string id
+        NumericRange,           // comparisons of the numeric cell value
+        TextMatch               // regular expression matched against the cell text
+    };
+
+    typedef struct {
+        PredicateKind kind;
+        int column;
+        MetricViewDataBlock::ColumnType type;
+        QRegExp regExp;
+        bool nullMatches;       // whether an empty cell (empty text) matches the regular expression
+        QBitArray stringMatches; // set bit for each interned string id matched by the regular expression
+        double lower;
+        double upper;
+        bool lowerInclusive;
+        bool upperInclusive;
+        QVector< quint32 > words; // bitmap of the rows accepted by the predicate in storage row order
+        int evaluatedRows;      // number of storage rows evaluated
+    } Predicate;
+
+    typedef QSharedPointer< Predicate > PredicatePtr;
+
+    QVector< PredicatePtr > getPredicates(const QList< QPair<int, QRegExp> >& criteria);
+    void compile(Predicate& predicate) const;
+    void update(const QVector< PredicatePtr >& predicates);
+    void evaluate(Predicate& predicate);
+    void evaluateRange(Predicate* predicate, int first, int last) const;
+    bool acceptsValue(const Predicate& predicate, QRegExp& regExp, int row) const;
+    void combine(int first);
+
+    static bool parseRange(const QString& pattern, Predicate& predicate);
+    static int countBits(quint32 word);
+
+    const MetricTableModel* m_model;
+
+    QVector< PredicatePtr > m_predicates;   // predicates of the current criteria
+    QList< PredicatePtr > m_cache;          // compiled predicates - the most recently used first
+
+    QVector< quint32 > m_accepted;          // bitmap of the rows accepted by all current predicates in storage row order
+    int m_evaluatedRows;                    // number of storage rows combined
+
+};
+
+
+} // GUI
+} // ArgoNavis
+
+#endif // METRICTABLEFILTER_H
@@ -0,0 +1,1417 @@
+/*!
+   \file MetricTableModel.cpp
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "MetricTableModel.h"
+
+#include <QThread>
+#include <QtConcurrentRun>
+#include <QFutureSynchronizer>
+#include <qnumeric.h>
+
+#include <algorithm>
+#include <iterator>
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+// minimum number of rows sorted by one task
+const int MIN_SORT_TASK_ROWS = 65536;
+
+
+/**
+ * @brief lessKey
+ * @param a - the first key
+ * @param b - the second key
+ * @return - indicates whether the first key orders before the second key
+ */
+template <typename T>
+static inline bool lessKey(T a, T b)
+{
+    return a < b;
+}
+
+/**
+ * @brief lessKey
+ * @param a - the first key
+ * @param b - the second key
+ * @return - indicates whether the first key orders before the second key (NaN values order after all other values)
+ */
+static inline bool lessKey(double a, double b)
+{
+    return a < b || ( ! qIsNaN( a ) && qIsNaN( b ) );
+}
+
+/*!
+ * \brief The KeyLess struct
+ *
+ * Compares storage rows by the keys of the rows.
+ */
+template <typename T>
+struct KeyLess {
+    explicit KeyLess(const T* keys) : keys( keys ) { }
+    bool operator()(int a, int b) const { return lessKey( keys[ a ], keys[ b ] ); }
+    const T* keys;
+};
+
+/**
+ * @brief sortRows
+ * @param first - the first storage row of the run
+ * @param last - the end of the run
+ * @param keys - the key of each storage row
+ */
+template <typename T>
+static void sortRows(int* first, int* last, const T* keys)
+{
+    std::stable_sort( first, last, KeyLess< T >( keys ) );
+}
+
+/**
+ * @brief mergeRows
+ * @param first - the first storage row of the first sorted run
+ * @param middle - the first storage row of the second sorted run
+ * @param last - the end of the second sorted run
+ * @param keys - the key of each storage row
+ */
+template <typename T>
+static void mergeRows(int* first, int* middle, int* last, const T* keys)
+{
+    std::inplace_merge( first, middle, last, KeyLess< T >( keys ) );
+}
+
+/**
+ * @brief isNullRow
+ * @param nulls - set bit for each storage row without a value (sized on demand)
+ * @param row - the storage row
+ * @return - indicates whether the storage row has no value
+ */
+static inline bool isNullRow(const QBitArray& nulls, int row)
+{
+    return row < nulls.size() && nulls.testBit( row );
+}
+
+/**
+ * @brief sortRowsInParallel
+ * @param rows - the storage rows to sort
+ * @param keys - the key of each storage row
+ *
+ * Runs of rows are sorted in parallel and adjacent runs are merged in parallel until one run remains.
+ */
+template <typename T>
+static void sortRowsInParallel(QVector< int >& rows, const T* keys)
+{
+    const int rowCount = rows.size();
+    const int taskCount = qBound( 1, rowCount / MIN_SORT_TASK_ROWS, QThread::idealThreadCount() );
+
+    int* data = rows.data();
+
+    if ( 1 == taskCount ) {
+        sortRows( data, data + rowCount, keys );
+        return;
+    }
+
+    QVector< int > bounds;
+
+    for ( int task = 0; task <= taskCount; ++task ) {
+        bounds << qint64( rowCount ) * task / taskCount;
+    }
+
+    {
+        QFutureSynchronizer<void> synchronizer;
+
+        for ( int task = 0; task < taskCount; ++task ) {
+            synchronizer.addFuture( QtConcurrent::run( &sortRows< T >, data + bounds[ task ], data + bounds[ task + 1 ], keys ) );
+        }
+
+        synchronizer.waitForFinished();
+    }
+
+    while ( bounds.size() > 2 ) {
+        const int runs = bounds.size() - 1;
+
+        QVector< int > merged;
+
+        QFutureSynchronizer<void> synchronizer;
+
+        for ( int run = 0; run < runs; run += 2 ) {
+            merged << bounds[ run ];
+            if ( run + 1 < runs )
+                synchronizer.addFuture( QtConcurrent::run( &mergeRows< T >, data + bounds[ run ], data + bounds[ run + 1 ], data + bounds[ run + 2 ], keys ) );
+        }
+
+        merged << bounds.last();
+
+        synchronizer.waitForFinished();
+
+        bounds = merged;
+    }
+}
+
+/**
+ * @brief updateSortOrder
+ * @param keys - the key of each storage row
+ * @param nulls - set bit for each storage row without a value
+ * @param order - the storage rows in ascending sort order - extended by the rows appended since it was computed
+ * @param positions - the position of each storage row in the sort order - updated along with the order
+ *
+ * Sorts the storage rows not covered by the order yet and merges them into the order, so that appending a block only sorts
+ * the rows of the block.  Empty cells order before all values and rows with equal keys stay in the order they were appended.
+ */
+template <typename T>
+static void updateSortOrder(const QVector< T >& keys, const QBitArray& nulls, QVector< int >& order, QVector< int >& positions)
+{
+    const int count = keys.size();
+    const int first = positions.size();
+
+    QVector< int > rows;
+    rows.reserve( count - first );
+
+    QVector< int > nullRows;
+
+    for ( int row=first; row<count; ++row ) {
+        if ( isNullRow( nulls, row ) )
+            nullRows << row;
+        else
+            rows << row;
+    }
+
+    sortRowsInParallel( rows, keys.constData() );
+
+    // the empty cells lead the previous order
+    int nullCount( 0 );
+
+    while ( nullCount < order.size() && isNullRow( nulls, order.at( nullCount ) ) )
+        ++nullCount;
+
+    QVector< int > merged;
+    merged.reserve( count );
+
+    merged += order.mid( 0, nullCount );
+    merged += nullRows;
+
+    std::merge( order.constBegin() + nullCount, order.constEnd(), rows.constBegin(), rows.constEnd(), std::back_inserter( merged ), KeyLess< T >( keys.constData() ) );
+
+    order = merged;
+
+    positions.resize( count );
+
+    for ( int i=0; i<count; ++i ) {
+        positions[ order.at( i ) ] = i;
+    }
+}
+
+/**
+ * @brief storeKeys
+ * @param stores - the trace event stores holding the rows
+ * @param values - the accessor of the column values of a trace event store
+ * @param column - the column of the trace event stores
+ * @return - the values of the column of all stores in storage row order
+ *
+ * The keys of a column read from the trace event stores are only gathered for the duration of the sort.
+ */
+template <typename T>
+static QVector< T > storeKeys(const QVector< TraceEventStorePtr >& stores, const QVector< T >& (TraceEventStore::*values)(int) const, int column)
+{
+    QVector< T > keys;
+
+    foreach ( const TraceEventStorePtr& store, stores ) {
+        keys += ( ( *store ).*values )( column );
+    }
+
+    return keys;
+}
+
+
+/**
+ * @brief MetricTableModel::MetricTableModel
+ * @param columnHeaders - the column headers of the model
+ * @param parent - the parent object
+ *
+ * Constructs an empty MetricTableModel instance with the specified columns.
+ */
+MetricTableModel::MetricTableModel(const QStringList &columnHeaders, QObject *parent)
+    : QAbstractTableModel( parent )
+    , m_storage( new Storage )
+    , m_rowCount( 0 )
+    , m_pageSize( 0 )
+    , m_fetchedRows( 0 )
+    , m_scannedRows( 0 )
+    , m_sortColumn( -1 )
+    , m_sortOrder( Qt::AscendingOrder )
+{
+    m_storage->columnHeaders = columnHeaders;
+    m_storage->columns.resize( columnHeaders.size() );
+    m_storage->sortOrders.resize( columnHeaders.size() );
+    m_storage->sortPositions.resize( columnHeaders.size() );
+
+    for ( int i=0; i<columnHeaders.size(); ++i ) {
+        if ( ! m_storage->columnIndexes.contains( columnHeaders.at( i ) ) )
+            m_storage->columnIndexes.insert( columnHeaders.at( i ), i );
+    }
+
+    m_storage->models << this;
+}
+
+/**
+ * @brief MetricTableModel::MetricTableModel
+ * @param model - the model whose rows are exposed
+ * @param parent - the parent object
+ *
+ * Constructs a MetricTableModel instance exposing the rows of the typed storage of another model.  Rows appended to either
+ * model are exposed by both, but each model has its own sort order and paging, so several views can show the same rows
+ * sorted differently without copying them.
+ */
+MetricTableModel::MetricTableModel(MetricTableModel *model, QObject *parent)
+    : QAbstractTableModel( parent )
+    , m_storage( model->m_storage )
+    , m_rowCount( m_storage->rowCount )
+    , m_pageSize( 0 )
+    , m_fetchedRows( m_rowCount )
+    , m_scannedRows( 0 )
+    , m_sortColumn( -1 )
+    , m_sortOrder( Qt::AscendingOrder )
+{
+    m_storage->models << this;
+}
+
+/**
+ * @brief MetricTableModel::~MetricTableModel
+ *
+ * Destroys the MetricTableModel instance.  The typed storage is released with the last model exposing its rows.
+ */
+MetricTableModel::~MetricTableModel()
+{
+    m_storage->models.removeOne( this );
+}
+
+/**
+ * @brief MetricTableModel::rowCount
+ * @param parent - the parent model index
+ * @return - the number of rows exposed by the model
+ */
+int MetricTableModel::rowCount(const QModelIndex &parent) const
+{
+    if ( parent.isValid() )
+        return 0;
+
+    return m_fetchedRows;
+}
+
+/**
+ * @brief MetricTableModel::columnCount
+ * @param parent - the parent model index
+ * @return - the number of columns in the model
+ */
+int MetricTableModel::columnCount(const QModelIndex &parent) const
+{
+    if ( parent.isValid() )
+        return 0;
+
+    return m_storage->columns.size();
+}
+
+/**
+ * @brief MetricTableModel::data
+ * @param index - the model index
+ * @param role - the data role
+ * @return - the value for the display and edit roles; otherwise an invalid QVariant
+ */
+QVariant MetricTableModel::data(const QModelIndex &index, int role) const
+{
+    if ( ! index.isValid() || index.row() >= m_fetchedRows || index.column() >= m_storage->columns.size() )
+        return QVariant();
+
+    if ( role != Qt::DisplayRole && role != Qt::EditRole )
+        return QVariant();
+
+    return columnValue( m_storage->columns.at( index.column() ), storageRow( index.row() ) );
+}
+
+/**
+ * @brief MetricTableModel::headerData
+ * @param section - the column number
+ * @param orientation - the header orientation
+ * @param role - the data role
+ * @return - the column header for horizontal headers; otherwise the default header data
+ */
+QVariant MetricTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if ( Qt::Horizontal == orientation && ( Qt::DisplayRole == role || Qt::EditRole == role ) ) {
+        if ( section >= 0 && section < m_storage->columnHeaders.size() )
+            return m_storage->columnHeaders.at( section );
+        return QVariant();
+    }
+
+    return QAbstractTableModel::headerData( section, orientation, role );
+}
+
+/**
+ * @brief MetricTableModel::flags
+ * @param index - the model index
+ * @return - the item flags
+ */
+Qt::ItemFlags MetricTableModel::flags(const QModelIndex &index) const
+{
+    if ( ! index.isValid() )
+        return Qt::NoItemFlags;
+
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+/**
+ * @brief MetricTableModel::canFetchMore
+ * @param parent - the parent model index
+ * @return - indicates whether rows of the typed storage are not exposed yet
+ *
+ * The method reimplements QAbstractItemModel::canFetchMore.  With a row filter, rows may be fetched until all rows have been
+ * tested by the row filter.
+ */
+bool MetricTableModel::canFetchMore(const QModelIndex &parent) const
+{
+    if ( parent.isValid() )
+        return false;
+
+    return m_rowFilter ? m_scannedRows < m_rowCount : m_fetchedRows < m_rowCount;
+}
+
+/**
+ * @brief MetricTableModel::fetchMore
+ * @param parent - the parent model index
+ *
+ * The method reimplements QAbstractItemModel::fetchMore.  The next page of rows is exposed after the rows already exposed,
+ * so the rows are fetched in the order they are shown.  With a row filter, the rows following the rows already tested are
+ * tested until a page of accepted rows has been found.
+ */
+void MetricTableModel::fetchMore(const QModelIndex &parent)
+{
+    if ( ! canFetchMore( parent ) )
+        return;
+
+    if ( m_rowFilter ) {
+        exposeRows( scanRows( ( m_pageSize > 0 ) ? m_pageSize : m_rowCount ) );
+        return;
+    }
+
+    const int remaining = m_rowCount - m_fetchedRows;
+    const int count = ( m_pageSize > 0 ) ? qMin( m_pageSize, remaining ) : remaining;
+
+    beginInsertRows( QModelIndex(), m_fetchedRows, m_fetchedRows + count - 1 );
+
+    m_fetchedRows += count;
+
+    endInsertRows();
+}
+
+/**
+ * @brief MetricTableModel::setPageSize
+ * @param rows - the number of rows exposed by each fetch or zero to expose all rows
+ *
+ * Sets the number of rows exposed initially and by each fetch.  A model holding rows for millions of events then only exposes
+ * the rows a view has been scrolled to, so the view only lays out and formats those rows.
+ */
+void MetricTableModel::setPageSize(int rows)
+{
+    rows = qMax( 0, rows );
+
+    if ( rows == m_pageSize )
+        return;
+
+    m_pageSize = rows;
+
+    // the rows accepted by the row filter are found again for the new page size
+    if ( m_rowFilter ) {
+        setRowFilter( m_rowFilter );
+        return;
+    }
+
+    const int fetchedRows = ( m_pageSize > 0 ) ? qMin( m_pageSize, m_rowCount ) : m_rowCount;
+
+    if ( fetchedRows < m_fetchedRows ) {
+        beginRemoveRows( QModelIndex(), fetchedRows, m_fetchedRows - 1 );
+        m_fetchedRows = fetchedRows;
+        endRemoveRows();
+    }
+    else if ( fetchedRows > m_fetchedRows ) {
+        beginInsertRows( QModelIndex(), m_fetchedRows, fetchedRows - 1 );
+        m_fetchedRows = fetchedRows;
+        endInsertRows();
+    }
+}
+
+/**
+ * @brief MetricTableModel::setRowFilter
+ * @param filter - the filter of the storage rows exposed or an empty filter to expose all rows
+ *
+ * Restricts the rows exposed by the model to the storage rows accepted by the filter.  The rows are tested in the order they
+ * are shown and only until a page of accepted rows has been found, so a filter accepting few rows still fills the first page
+ * and the view fetches further pages as it is scrolled.  The model is reset; setting the same filter again after the rows it
+ * accepts have changed finds the accepted rows again.  Appended rows are tested by the filter as they are exposed.
+ */
+void MetricTableModel::setRowFilter(const RowFilter &filter)
+{
+    if ( ! filter && ! m_rowFilter )
+        return;
+
+    beginResetModel();
+
+    m_rowFilter = filter;
+    m_exposedRows.clear();
+    m_scannedRows = 0;
+
+    if ( m_rowFilter ) {
+        m_exposedRows = scanRows( ( m_pageSize > 0 ) ? m_pageSize : m_rowCount );
+        m_fetchedRows = m_exposedRows.size();
+    }
+    else {
+        m_fetchedRows = ( m_pageSize > 0 ) ? qMin( m_pageSize, m_rowCount ) : m_rowCount;
+    }
+
+    endResetModel();
+}
+
+/**
+ * @brief MetricTableModel::sort
+ * @param column - the model column to sort by or -1 to restore the order of appending
+ * @param order - the sort order
+ *
+ * The method reimplements QAbstractItemModel::sort.  The rows are exposed in the order of the cached sort permutation of the
+ * column (computed by a parallel sort on the first sort by the column), read forwards for the ascending order and backwards
+ * for the descending order.  A column that is not sortable restores the order of appending (most recently appended first).
+ * The number of exposed rows is unchanged.
+ */
+void MetricTableModel::sort(int column, Qt::SortOrder order)
+{
+    QVector< int > sortedRows;
+    QVector< int > sortedPositions;
+
+    if ( column >= 0 && ! getSortOrder( column, sortedRows, sortedPositions ) )
+        column = -1;
+
+    if ( column == m_sortColumn && ( column < 0 || order == m_sortOrder ) )
+        return;
+
+    changeLayout( column, order, sortedRows, sortedPositions, m_rowCount );
+}
+
+/**
+ * @brief MetricTableModel::isSortable
+ * @param column - the model column
+ * @return - indicates whether MetricTableModel::sort orders the rows by the column
+ *
+ * Typed columns of the types QSortFilterProxyModel::lessThan compares numerically or as strings are sortable; the rows are
+ * ordered the same as by QSortFilterProxyModel::lessThan for a case sensitive sort that is not locale aware.
+ */
+bool MetricTableModel::isSortable(int column) const
+{
+    QVector< int > sortedRows;
+    QVector< int > sortedPositions;
+
+    return getSortOrder( column, sortedRows, sortedPositions );
+}
+
+/**
+ * @brief MetricTableModel::appendRows
+ * @param block - the block of rows to append
+ * @param columnHeaders - if present provides the names of the columns for each column of the block
+ *
+ * Appends all rows of the block to the typed storage.  Without column headers the columns of the block are
+ * mapped to the model columns in order.  Model columns without a value in the block are left empty for the
+ * new rows.  Each model exposing the rows of the storage then exposes the new rows.
+ */
+void MetricTableModel::appendRows(const MetricViewDataBlock &block, const QStringList &columnHeaders)
+{
+    if ( block.isEmpty() )
+        return;
+
+    // rows appended from trace event stores are copied into the typed columns before appending rows of another form
+    detachStores();
+
+    appendBlock( block, columnHeaders );
+
+    // each model exposing the rows of the storage exposes the appended rows in its own order
+    foreach ( MetricTableModel* model, m_storage->models ) {
+        model->handleRowsAppended();
+    }
+}
+
+/**
+ * @brief MetricTableModel::appendTraceEvents
+ * @param store - the trace events to append
+ *
+ * Appends a row for each trace event of the store.  The store is shared with the timeline and its typed arrays hold the values
+ * of the columns of the rows; the model only interns the function names of the store.  If rows were appended in blocks before,
+ * or the store holds another kind of trace events than the stores appended before, the rows are appended in blocks instead.
+ * Each model exposing the rows of the storage then exposes the new rows.
+ */
+void MetricTableModel::appendTraceEvents(const TraceEventStorePtr &store)
+{
+    if ( store.isNull() || store->isEmpty() )
+        return;
+
+    Storage& storage( *m_storage );
+
+    if ( ( storage.rowCount > 0 && storage.stores.isEmpty() ) ||
+         ( ! storage.stores.isEmpty() && storage.stores.first()->kind() != store->kind() ) ) {
+        const int last = store->size();
+        for ( int i=0; i<last; i+=MetricViewDataBlock::DEFAULT_BLOCK_SIZE ) {
+            appendRows( store->getDataBlock( i, qMin( last - i, (int) MetricViewDataBlock::DEFAULT_BLOCK_SIZE ) ) );
+        }
+        return;
+    }
+
+    if ( storage.stores.isEmpty() ) {
+        // the columns read their values from the trace event stores
+        for ( int column=0; column<qMin( storage.columns.size(), store->columnCount() ); ++column ) {
+            Column& values( storage.columns[ column ] );
+            values.defined = true;
+            values.type = store->columnType( column );
+            values.userType = store->columnUserType( column );
+            values.storeColumn = column;
+        }
+    }
+
+    QVector< int > stringIds;
+
+    foreach ( const QString& functionName, store->functionNames() ) {
+        stringIds << internString( functionName );
+    }
+
+    storage.stores << store;
+    storage.storeRows << storage.rowCount;
+    storage.storeStringIds << stringIds;
+
+    storage.rowCount += store->size();
+
+    // each model exposing the rows of the storage exposes the appended rows in its own order
+    foreach ( MetricTableModel* model, storage.models ) {
+        model->handleRowsAppended();
+    }
+}
+
+/**
+ * @brief MetricTableModel::appendBlock
+ * @param block - the block of rows to append
+ * @param columnHeaders - if present provides the names of the columns for each column of the block
+ *
+ * Appends all rows of the block to the typed columns without exposing them.
+ */
+void MetricTableModel::appendBlock(const MetricViewDataBlock &block, const QStringList &columnHeaders)
+{
+    Storage& storage( *m_storage );
+
+    QVector< int > modelColumns( block.columnCount(), -1 );
+
+    for ( int i=0; i<block.columnCount(); ++i ) {
+        if ( columnHeaders.isEmpty() )
+            modelColumns[ i ] = ( i < storage.columns.size() ) ? i : -1;
+        else if ( i < columnHeaders.size() )
+            modelColumns[ i ] = storage.columnIndexes.value( columnHeaders.at( i ), -1 );
+    }
+
+    QVector< bool > filled( storage.columns.size(), false );
+
+    for ( int i=0; i<modelColumns.size(); ++i ) {
+        const int column = modelColumns.at( i );
+        if ( column != -1 && ! filled.at( column ) ) {
+            appendColumn( storage.columns[ column ], block, i );
+            filled[ column ] = true;
+        }
+    }
+
+    for ( int column=0; column<storage.columns.size(); ++column ) {
+        if ( ! filled.at( column ) ) {
+            appendNulls( storage.columns[ column ], block.rowCount() );
+        }
+    }
+
+    storage.rowCount += block.rowCount();
+}
+
+/**
+ * @brief MetricTableModel::detachStores
+ *
+ * Copies the values of the rows appended from trace event stores into the typed columns and releases the stores.  The storage
+ * rows are unchanged, so the cached sort orders and the rows exposed by the models remain valid.
+ */
+void MetricTableModel::detachStores()
+{
+    Storage& storage( *m_storage );
+
+    if ( storage.stores.isEmpty() )
+        return;
+
+    const QVector< TraceEventStorePtr > stores = storage.stores;
+
+    storage.stores.clear();
+    storage.storeRows.clear();
+    storage.storeStringIds.clear();
+
+    for ( int column=0; column<storage.columns.size(); ++column ) {
+        storage.columns[ column ] = Column();
+    }
+
+    storage.rowCount = 0;
+
+    foreach ( const TraceEventStorePtr& store, stores ) {
+        const int last = store->size();
+        for ( int i=0; i<last; i+=MetricViewDataBlock::DEFAULT_BLOCK_SIZE ) {
+            appendBlock( store->getDataBlock( i, qMin( last - i, (int) MetricViewDataBlock::DEFAULT_BLOCK_SIZE ) ), QStringList() );
+        }
+    }
+}
+
+/**
+ * @brief MetricTableModel::storeIndex
+ * @param storageRow - the storage row index
+ * @return - the index of the trace event store holding the storage row
+ */
+int MetricTableModel::storeIndex(int storageRow) const
+{
+    const QVector< int >& rows( m_storage->storeRows );
+
+    return std::upper_bound( rows.constBegin(), rows.constEnd(), storageRow ) - rows.constBegin() - 1;
+}
+
+/**
+ * @brief MetricTableModel::handleRowsAppended
+ *
+ * Exposes the rows appended to the typed storage since the model last knew its size.  Without a sort order the appended rows
+ * are inserted at the top with a single row insertion and, when paging, the number of exposed rows only grows until the first
+ * page is full - the same number of the last exposed rows are no longer exposed.  With a sort order the appended rows are
+ * merged into the cached sort permutation and exposed at their sorted positions with a single layout change.  With a row filter
+ * only the appended rows accepted by the filter are exposed.
+ */
+void MetricTableModel::handleRowsAppended()
+{
+    const int storedRows = m_storage->rowCount;
+    const int count = storedRows - m_rowCount;
+
+    if ( count <= 0 )
+        return;
+
+    if ( m_sortColumn >= 0 ) {
+        QVector< int > sortedRows;
+        QVector< int > sortedPositions;
+
+        // a column converted to generic storage by the appended rows is no longer sortable
+        if ( getSortOrder( m_sortColumn, sortedRows, sortedPositions ) )
+            changeLayout( m_sortColumn, m_sortOrder, sortedRows, sortedPositions, storedRows );
+        else
+            changeLayout( -1, m_sortOrder, sortedRows, sortedPositions, storedRows );
+
+        if ( m_rowFilter ) {
+            const int pageRows = ( m_pageSize > 0 ) ? m_pageSize : m_rowCount;
+            if ( m_fetchedRows < pageRows )
+                exposeRows( scanRows( pageRows - m_fetchedRows ) );
+            return;
+        }
+
+        const int fetchedRows = ( m_pageSize > 0 ) ? qMin( m_rowCount, qMax( m_fetchedRows, m_pageSize ) ) : m_rowCount;
+
+        if ( fetchedRows > m_fetchedRows ) {
+            beginInsertRows( QModelIndex(), m_fetchedRows, fetchedRows - 1 );
+            m_fetchedRows = fetchedRows;
+            endInsertRows();
+        }
+
+        return;
+    }
+
+    if ( m_rowFilter ) {
+        // the appended rows are the first rows in the order of appending - the rows accepted are exposed at the top
+        QVector< int > rows;
+
+        for ( int row=storedRows-1; row>=m_rowCount; --row ) {
+            if ( m_rowFilter( row ) )
+                rows << row;
+        }
+
+        const int fetchedRows = ( m_pageSize > 0 ) ? qMax( m_fetchedRows, m_pageSize ) : m_fetchedRows + rows.size();
+        const bool truncated = ( m_fetchedRows + rows.size() > fetchedRows );
+        const int removed = qMin( m_fetchedRows, m_fetchedRows + rows.size() - fetchedRows );
+
+        if ( removed > 0 ) {
+            beginRemoveRows( QModelIndex(), m_fetchedRows - removed, m_fetchedRows - 1 );
+            m_fetchedRows -= removed;
+            m_exposedRows.resize( m_fetchedRows );
+            endRemoveRows();
+        }
+
+        if ( rows.size() > fetchedRows )
+            rows.resize( fetchedRows );
+
+        if ( ! rows.isEmpty() )
+            beginInsertRows( QModelIndex(), 0, rows.size() - 1 );
+
+        m_rowCount = storedRows;
+        m_exposedRows = rows + m_exposedRows;
+        m_fetchedRows = m_exposedRows.size();
+
+        // the rows tested follow the appended rows unless exposed rows were pushed past the end of the page
+        if ( truncated )
+            m_scannedRows = m_rowCount - m_exposedRows.last();
+        else
+            m_scannedRows += count;
+
+        if ( ! rows.isEmpty() )
+            endInsertRows();
+
+        return;
+    }
+
+    // the number of rows exposed after appending the rows
+    const int fetchedRows = ( m_pageSize > 0 ) ? qMin( storedRows, qMax( m_fetchedRows, m_pageSize ) ) : storedRows;
+
+    // exposed rows pushed past the end of the exposed rows by the appended rows
+    const int removed = qMin( m_fetchedRows, m_fetchedRows + count - fetchedRows );
+
+    if ( removed > 0 ) {
+        beginRemoveRows( QModelIndex(), m_fetchedRows - removed, m_fetchedRows - 1 );
+        m_fetchedRows -= removed;
+        endRemoveRows();
+    }
+
+    // the most recently appended rows are exposed at the top
+    const int inserted = qMin( count, fetchedRows );
+
+    beginInsertRows( QModelIndex(), 0, inserted - 1 );
+
+    m_rowCount = storedRows;
+    m_fetchedRows += inserted;
+
+    endInsertRows();
+}
+
+/**
+ * @brief MetricTableModel::changeLayout
+ * @param sortColumn - the sort column or -1 for the order of appending
+ * @param order - the sort order
+ * @param sortedRows - the storage rows in ascending sort order of the sort column
+ * @param sortedPositions - the position of each storage row in the sorted rows
+ * @param storedRows - the number of storage rows known to the model after the change
+ *
+ * Changes the order of the rows exposed by the model.  The same number of rows is exposed in the new order and persistent
+ * indexes of rows no longer exposed are invalidated.  With a row filter the same number of accepted rows is found again in
+ * the new order.
+ */
+void MetricTableModel::changeLayout(int sortColumn, Qt::SortOrder order, const QVector< int > &sortedRows, const QVector< int > &sortedPositions, int storedRows)
+{
+    emit layoutAboutToBeChanged();
+
+    const QModelIndexList oldIndexes = persistentIndexList();
+
+    QVector< int > rows;
+    rows.reserve( oldIndexes.size() );
+
+    foreach ( const QModelIndex& persistentIndex, oldIndexes ) {
+        rows << storageRow( persistentIndex.row() );
+    }
+
+    m_sortColumn = sortColumn;
+    m_sortOrder = order;
+    m_sortedRows = sortedRows;
+    m_sortedPositions = sortedPositions;
+    m_rowCount = storedRows;
+
+    // model row of each exposed storage row while a row filter is set
+    QHash< int, int > exposedPositions;
+
+    if ( m_rowFilter ) {
+        m_scannedRows = 0;
+        m_exposedRows = scanRows( m_fetchedRows );
+        m_fetchedRows = m_exposedRows.size();
+
+        for ( int i=0; ! oldIndexes.isEmpty() && i<m_exposedRows.size(); ++i ) {
+            exposedPositions.insert( m_exposedRows.at( i ), i );
+        }
+    }
+    else {
+        m_fetchedRows = qMin( m_fetchedRows, m_rowCount );
+    }
+
+    QModelIndexList newIndexes;
+
+    for ( int i=0; i<oldIndexes.size(); ++i ) {
+        const int row = m_rowFilter ? exposedPositions.value( rows.at( i ), -1 ) : displayRow( rows.at( i ) );
+        newIndexes << ( ( row >= 0 && row < m_fetchedRows ) ? index( row, oldIndexes.at( i ).column() ) : QModelIndex() );
+    }
+
+    changePersistentIndexList( oldIndexes, newIndexes );
+
+    emit layoutChanged();
+}
+
+/**
+ * @brief MetricTableModel::columnHeaders
+ * @return - the column headers of the model
+ */
+QStringList MetricTableModel::columnHeaders() const
+{
+    return m_storage->columnHeaders;
+}
+
+/**
+ * @brief MetricTableModel::storageRow
+ * @param row - the model row
+ * @return - the storage row index (in order of appending) of the model row
+ */
+int MetricTableModel::storageRow(int row) const
+{
+    // with a row filter only the accepted rows found so far are exposed
+    if ( m_rowFilter )
+        return ( row >= 0 && row < m_exposedRows.size() ) ? m_exposedRows.at( row ) : -1;
+
+    return sortedRow( row );
+}
+
+/**
+ * @brief MetricTableModel::sortedRow
+ * @param position - the position of the row in the order of the model ignoring any row filter
+ * @return - the storage row index (in order of appending) at the position
+ */
+int MetricTableModel::sortedRow(int position) const
+{
+    // the most recently appended row is the first row of the model unless sorted
+    if ( m_sortColumn < 0 )
+        return m_rowCount - 1 - position;
+
+    if ( position < 0 || position >= m_sortedRows.size() )
+        return -1;
+
+    return ( Qt::AscendingOrder == m_sortOrder ) ? m_sortedRows.at( position ) : m_sortedRows.at( m_sortedRows.size() - 1 - position );
+}
+
+/**
+ * @brief MetricTableModel::scanRows
+ * @param count - the maximum number of rows to find
+ * @return - the storage rows accepted by the row filter following the rows tested before (in the order of the model)
+ *
+ * Tests the rows following the rows already tested until the number of accepted rows has been found or all rows have been tested.
+ */
+QVector< int > MetricTableModel::scanRows(int count)
+{
+    QVector< int > rows;
+
+    while ( m_scannedRows < m_rowCount && rows.size() < count ) {
+        const int row = sortedRow( m_scannedRows++ );
+        if ( m_rowFilter( row ) )
+            rows << row;
+    }
+
+    return rows;
+}
+
+/**
+ * @brief MetricTableModel::exposeRows
+ * @param rows - the storage rows accepted by the row filter
+ *
+ * Exposes the rows after the rows already exposed.
+ */
+void MetricTableModel::exposeRows(const QVector< int > &rows)
+{
+    if ( rows.isEmpty() )
+        return;
+
+    beginInsertRows( QModelIndex(), m_fetchedRows, m_fetchedRows + rows.size() - 1 );
+
+    m_exposedRows += rows;
+    m_fetchedRows = m_exposedRows.size();
+
+    endInsertRows();
+}
+
+/**
+ * @brief MetricTableModel::displayRow
+ * @param storageRow - the storage row index
+ * @return - the model row of the storage row or -1 if the row is not known to the model
+ */
+int MetricTableModel::displayRow(int storageRow) const
+{
+    if ( storageRow < 0 || storageRow >= m_rowCount )
+        return -1;
+
+    if ( m_sortColumn < 0 )
+        return m_rowCount - 1 - storageRow;
+
+    const int position = m_sortedPositions.at( storageRow );
+
+    return ( Qt::AscendingOrder == m_sortOrder ) ? position : m_sortedPositions.size() - 1 - position;
+}
+
+/**
+ * @brief MetricTableModel::storageRowCount
+ * @return - the number of rows of the typed storage including the rows not exposed yet
+ *
+ * The count includes rows being appended, so that a row filter can test the appended rows before the model exposes them.
+ */
+int MetricTableModel::storageRowCount() const
+{
+    return m_storage->rowCount;
+}
+
+/**
+ * @brief MetricTableModel::columnType
+ * @param column - the model column
+ * @return - the storage type of the column (Variant if no value has been appended yet)
+ */
+MetricViewDataBlock::ColumnType MetricTableModel::columnType(int column) const
+{
+    const Column& storage( m_storage->columns.at( column ) );
+
+    return storage.defined ? storage.type : MetricViewDataBlock::Variant;
+}
+
+/**
+ * @brief MetricTableModel::columnUserType
+ * @param column - the model column
+ * @return - the QVariant user type of the values of the column
+ */
+int MetricTableModel::columnUserType(int column) const
+{
+    return m_storage->columns.at( column ).userType;
+}
+
+/**
+ * @brief MetricTableModel::doubleValue
+ * @param storageRow - the storage row index
+ * @param column - a Double model column
+ * @return - the value of the cell
+ */
+double MetricTableModel::doubleValue(int storageRow, int column) const
+{
+    const Column& values( m_storage->columns.at( column ) );
+
+    if ( values.storeColumn < 0 )
+        return values.doubles.at( storageRow );
+
+    const int store = storeIndex( storageRow );
+
+    return m_storage->stores.at( store )->doubleColumn( values.storeColumn ).at( storageRow - m_storage->storeRows.at( store ) );
+}
+
+/**
+ * @brief MetricTableModel::signedValue
+ * @param storageRow - the storage row index
+ * @param column - a SignedInteger model column
+ * @return - the value of the cell
+ */
+qint64 MetricTableModel::signedValue(int storageRow, int column) const
+{
+    const Column& values( m_storage->columns.at( column ) );
+
+    if ( values.storeColumn < 0 )
+        return values.signedValues.at( storageRow );
+
+    const int store = storeIndex( storageRow );
+
+    return m_storage->stores.at( store )->signedColumn( values.storeColumn ).at( storageRow - m_storage->storeRows.at( store ) );
+}
+
+/**
+ * @brief MetricTableModel::unsignedValue
+ * @param storageRow - the storage row index
+ * @param column - an UnsignedInteger model column
+ * @return - the value of the cell
+ */
+quint64 MetricTableModel::unsignedValue(int storageRow, int column) const
+{
+    const Column& values( m_storage->columns.at( column ) );
+
+    if ( values.storeColumn < 0 )
+        return values.unsignedValues.at( storageRow );
+
+    const int store = storeIndex( storageRow );
+
+    return m_storage->stores.at( store )->unsignedColumn( values.storeColumn ).at( storageRow - m_storage->storeRows.at( store ) );
+}
+
+/**
+ * @brief MetricTableModel::stringId
+ * @param storageRow - the storage row index
+ * @param column - a String model column
+ * @return - the interned string id of the cell (-1 for an empty cell)
+ */
+int MetricTableModel::stringId(int storageRow, int column) const
+{
+    const Column& values( m_storage->columns.at( column ) );
+
+    if ( values.storeColumn < 0 )
+        return values.stringIds.at( storageRow );
+
+    const int store = storeIndex( storageRow );
+    const int functionId = m_storage->stores.at( store )->functionIdColumn().at( storageRow - m_storage->storeRows.at( store ) );
+
+    return m_storage->storeStringIds.at( store ).at( functionId );
+}
+
+/**
+ * @brief MetricTableModel::isNull
+ * @param storageRow - the storage row index
+ * @param column - the model column
+ * @return - indicates whether the cell is empty
+ */
+bool MetricTableModel::isNull(int storageRow, int column) const
+{
+    const Column& storage( m_storage->columns.at( column ) );
+
+    return ! storage.defined || ( storageRow < storage.nulls.size() && storage.nulls.testBit( storageRow ) );
+}
+
+/**
+ * @brief MetricTableModel::storedValue
+ * @param storageRow - the storage row index
+ * @param column - the model column
+ * @return - the value of the cell as returned by MetricTableModel::data for the display role
+ */
+QVariant MetricTableModel::storedValue(int storageRow, int column) const
+{
+    return columnValue( m_storage->columns.at( column ), storageRow );
+}
+
+/**
+ * @brief MetricTableModel::internedStringCount
+ * @return - the number of strings in the interned string table
+ */
+int MetricTableModel::internedStringCount() const
+{
+    return m_storage->strings.size();
+}
+
+/**
+ * @brief MetricTableModel::internedString
+ * @param id - the interned string id
+ * @return - the string of the interned string table having the id
+ */
+const QString &MetricTableModel::internedString(int id) const
+{
+    return m_storage->strings.at( id );
+}
+
+/**
+ * @brief MetricTableModel::getSortOrder
+ * @param column - the model column
+ * @param sortedRows - receives the storage rows in ascending sort order of the column
+ * @param sortedPositions - receives the position of each storage row in the sorted rows
+ * @return - indicates whether the column has typed storage of a sortable type
+ *
+ * The sort order is computed on the first call for the column and cached with the storage.  Later calls only merge the rows
+ * appended since into the cached order; otherwise the cached vectors are returned without copying their elements.
+ */
+bool MetricTableModel::getSortOrder(int column, QVector< int > &sortedRows, QVector< int > &sortedPositions) const
+{
+    Storage& storage( *m_storage );
+
+    if ( column < 0 || column >= storage.columns.size() )
+        return false;
+
+    const Column& values( storage.columns.at( column ) );
+
+    QVector< int >& order = storage.sortOrders[ column ];
+    QVector< int >& positions = storage.sortPositions[ column ];
+
+    bool sortable( values.defined && values.type != MetricViewDataBlock::Variant );
+
+    // types QSortFilterProxyModel::lessThan compares numerically (other numeric types are compared as text)
+    switch ( values.userType ) {
+    case QMetaType::Double:
+    case QMetaType::Float:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::QString:
+        break;
+    default:
+        sortable = false;
+    }
+
+    if ( ! sortable ) {
+        order.clear();
+        positions.clear();
+        return false;
+    }
+
+    if ( positions.size() != storage.rowCount ) {
+        switch ( values.type ) {
+        case MetricViewDataBlock::Double:
+            if ( values.storeColumn < 0 )
+                updateSortOrder( values.doubles, values.nulls, order, positions );
+            else
+                updateSortOrder( storeKeys( storage.stores, &TraceEventStore::doubleColumn, values.storeColumn ), values.nulls, order, positions );
+            break;
+        case MetricViewDataBlock::SignedInteger:
+            if ( values.storeColumn < 0 )
+                updateSortOrder( values.signedValues, values.nulls, order, positions );
+            else
+                updateSortOrder( storeKeys( storage.stores, &TraceEventStore::signedColumn, values.storeColumn ), values.nulls, order, positions );
+            break;
+        case MetricViewDataBlock::UnsignedInteger:
+            if ( values.storeColumn < 0 )
+                updateSortOrder( values.unsignedValues, values.nulls, order, positions );
+            else
+                updateSortOrder( storeKeys( storage.stores, &TraceEventStore::unsignedColumn, values.storeColumn ), values.nulls, order, positions );
+            break;
+        case MetricViewDataBlock::String:
+        {
+            // order the interned strings once so that rows are sorted by the rank of their string - strings interned since the
+            // order was computed do not change the relative order of the previous strings
+            const QStringList& strings( storage.strings );
+            QVector< int > ids( strings.size() );
+            for ( int id=0; id<ids.size(); ++id ) {
+                ids[ id ] = id;
+            }
+            std::sort( ids.begin(), ids.end(), [&strings](int a, int b) { return strings.at( a ) < strings.at( b ); } );
+
+            QVector< int > stringRanks( ids.size() );
+            for ( int i=0; i<ids.size(); ++i ) {
+                stringRanks[ ids.at( i ) ] = i;
+            }
+
+            QVector< int > keys( storage.rowCount, 0 );
+            for ( int row=0; row<storage.rowCount; ++row ) {
+                const int id = stringId( row, column );
+                if ( id >= 0 )
+                    keys[ row ] = stringRanks.at( id );
+            }
+
+            updateSortOrder( keys, values.nulls, order, positions );
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    sortedRows = order;
+    sortedPositions = positions;
+
+    return true;
+}
+
+/**
+ * @brief MetricTableModel::appendColumn
+ * @param column - the model column
+ * @param block - the block of rows being appended
+ * @param blockColumn - the index of the block column providing the values
+ *
+ * Appends the values of a block column to the typed storage of the model column.
+ */
+void MetricTableModel::appendColumn(Column &column, const MetricViewDataBlock &block, int blockColumn)
+{
+    const MetricViewDataBlock::ColumnType blockType = block.columnType( blockColumn );
+    const int blockUserType = block.columnUserType( blockColumn );
+
+    if ( ! column.defined ) {
+        // the first values appended determine the type of the column; any previous rows are empty
+        column.defined = true;
+        column.type = blockType;
+        column.userType = blockUserType;
+        switch ( column.type ) {
+        case MetricViewDataBlock::Double:
+            column.doubles.fill( 0.0, m_storage->rowCount );
+            break;
+        case MetricViewDataBlock::SignedInteger:
+            column.signedValues.fill( 0, m_storage->rowCount );
+            break;
+        case MetricViewDataBlock::UnsignedInteger:
+            column.unsignedValues.fill( 0, m_storage->rowCount );
+            break;
+        case MetricViewDataBlock::String:
+            column.stringIds.fill( -1, m_storage->rowCount );
+            break;
+        default:
+            column.variants.fill( QVariant(), m_storage->rowCount );
+            break;
+        }
+    }
+    else if ( column.type != MetricViewDataBlock::Variant && ( column.type != blockType || column.userType != blockUserType ) ) {
+        convertToVariantColumn( column );
+    }
+
+    switch ( column.type ) {
+    case MetricViewDataBlock::Double:
+        column.doubles += block.doubleColumn( blockColumn );
+        break;
+    case MetricViewDataBlock::SignedInteger:
+        column.signedValues += block.signedColumn( blockColumn );
+        break;
+    case MetricViewDataBlock::UnsignedInteger:
+        column.unsignedValues += block.unsignedColumn( blockColumn );
+        break;
+    case MetricViewDataBlock::String:
+    {
+        // translate the block dictionary to interned string ids once for the whole block
+        const QStringList& dictionary = block.stringDictionary( blockColumn );
+        QVector< int > ids( dictionary.size() );
+        for ( int i=0; i<dictionary.size(); ++i ) {
+            ids[ i ] = internString( dictionary.at( i ) );
+        }
+        const QVector< int >& indexes = block.stringIndexColumn( blockColumn );
+        column.stringIds.reserve( column.stringIds.size() + indexes.size() );
+        foreach ( int index, indexes ) {
+            column.stringIds.push_back( ids.at( index ) );
+        }
+        break;
+    }
+    default:
+        column.variants.reserve( column.variants.size() + block.rowCount() );
+        for ( int row=0; row<block.rowCount(); ++row ) {
+            column.variants.push_back( block.value( row, blockColumn ) );
+        }
+        break;
+    }
+}
+
+/**
+ * @brief MetricTableModel::appendNulls
+ * @param column - the model column
+ * @param count - the number of empty cells to append
+ *
+ * Appends empty cells to the model column.
+ */
+void MetricTableModel::appendNulls(Column &column, int count)
+{
+    if ( column.defined ) {
+        switch ( column.type ) {
+        case MetricViewDataBlock::Double:
+            column.doubles.insert( column.doubles.size(), count, 0.0 );
+            break;
+        case MetricViewDataBlock::SignedInteger:
+            column.signedValues.insert( column.signedValues.size(), count, 0 );
+            break;
+        case MetricViewDataBlock::UnsignedInteger:
+            column.unsignedValues.insert( column.unsignedValues.size(), count, 0 );
+            break;
+        case MetricViewDataBlock::String:
+            column.stringIds.insert( column.stringIds.size(), count, -1 );
+            break;
+        default:
+            column.variants.insert( column.variants.size(), count, QVariant() );
+            break;
+        }
+    }
+
+    column.nulls.resize( m_storage->rowCount + count );
+    column.nulls.fill( true, m_storage->rowCount, m_storage->rowCount + count );
+}
+
+/**
+ * @brief MetricTableModel::convertToVariantColumn
+ * @param column - the model column
+ *
+ * Moves the values of a typed column into generic QVariant storage.  This is only needed when a column
+ * receives values of differing types.
+ */
+void MetricTableModel::convertToVariantColumn(Column &column)
+{
+    QVector< QVariant > variants;
+    variants.reserve( m_storage->rowCount );
+
+    for ( int row=0; row<m_storage->rowCount; ++row ) {
+        variants.push_back( columnValue( column, row ) );
+    }
+
+    column.doubles.clear();
+    column.signedValues.clear();
+    column.unsignedValues.clear();
+    column.stringIds.clear();
+
+    column.variants = variants;
+    column.type = MetricViewDataBlock::Variant;
+}
+
+/**
+ * @brief MetricTableModel::columnValue
+ * @param column - the model column
+ * @param row - the storage row index (in order of appending)
+ * @return - the value as a QVariant of the originally appended type or an invalid QVariant for an empty cell
+ */
+QVariant MetricTableModel::columnValue(const Column &column, int row) const
+{
+    if ( ! column.defined || ( row < column.nulls.size() && column.nulls.testBit( row ) ) )
+        return QVariant();
+
+    if ( column.storeColumn >= 0 )
+        return storeValue( column, row );
+
+    switch ( column.type ) {
+    case MetricViewDataBlock::Double:
+        return MetricViewDataBlock::toVariant( column.doubles.at( row ), column.userType );
+    case MetricViewDataBlock::SignedInteger:
+        return MetricViewDataBlock::toVariant( column.signedValues.at( row ), column.userType );
+    case MetricViewDataBlock::UnsignedInteger:
+        return MetricViewDataBlock::toVariant( column.unsignedValues.at( row ), column.userType );
+    case MetricViewDataBlock::String:
+        return QVariant( m_storage->strings.at( column.stringIds.at( row ) ) );
+    default:
+        return column.variants.at( row );
+    }
+}
+
+/**
+ * @brief MetricTableModel::storeValue
+ * @param column - a model column holding the values of a column of the trace event stores
+ * @param row - the storage row index (in order of appending)
+ * @return - the value as a QVariant of the type of the column of the trace event stores
+ */
+QVariant MetricTableModel::storeValue(const Column &column, int row) const
+{
+    const int store = storeIndex( row );
+    const TraceEventStore& events( *m_storage->stores.at( store ) );
+    const int event = row - m_storage->storeRows.at( store );
+
+    switch ( column.type ) {
+    case MetricViewDataBlock::Double:
+        return MetricViewDataBlock::toVariant( events.doubleColumn( column.storeColumn ).at( event ), column.userType );
+    case MetricViewDataBlock::SignedInteger:
+        return MetricViewDataBlock::toVariant( events.signedColumn( column.storeColumn ).at( event ), column.userType );
+    case MetricViewDataBlock::UnsignedInteger:
+        return MetricViewDataBlock::toVariant( events.unsignedColumn( column.storeColumn ).at( event ), column.userType );
+    default:
+        return QVariant( m_storage->strings.at( m_storage->storeStringIds.at( store ).at( events.functionIdColumn().at( event ) ) ) );
+    }
+}
+
+/**
+ * @brief MetricTableModel::internString
+ * @param str - the string to intern
+ * @return - the id of the string in the interned string table
+ */
+int MetricTableModel::internString(const QString &str)
+{
+    QHash< QString, int >::const_iterator iter = m_storage->stringIds.constFind( str );
+
+    if ( iter != m_storage->stringIds.constEnd() )
+        return iter.value();
+
+    const int id = m_storage->strings.size();
+
+    m_storage->strings << str;
+    m_storage->stringIds.insert( str, id );
+
+    return id;
+}
+
+
+} // GUI
+} // ArgoNavis
@@ -0,0 +1,185 @@
+/*!
+   \file MetricTableModel.h
+   \author Gregory Schultz <gregory.schultz@embarqmail.com>
+
+   \section LICENSE
+   This file is part of the Open|SpeedShop Graphical User Interface
+   Copyright (C) 2010-2018 Schultz Software Solutions, LLC
+
+   This library is free software; you can redistribute it and/or modify it
+   under the terms of the GNU Lesser General Public License as published by the
+   Free Software Foundation; either version 2.1 of the License, or (at your
+   option) any later version.
+
+   This library is distributed in the hope that it will be useful, but WITHOUT
+   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+   FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License
+   for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this library; if not, write to the Free Software Foundation,
+   Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef METRICTABLEMODEL_H
+#define METRICTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QStringList>
+#include <QVector>
+#include <QHash>
+#include <QBitArray>
+#include <QList>
+#include <QSharedPointer>
+
+#include <functional>
+
+#include "common/openss-gui-config.h"
+
+#include "managers/MetricViewDataBlock.h"
+#include "managers/TraceEventStore.h"
+
+
+namespace ArgoNavis { namespace GUI {
+
+
+/*!
+ * \brief The MetricTableModel class
+ *
+ * Read-only table model for the metric table view.  Cell values are held in contiguous typed column arrays
+ * and rows are only appended in blocks.  The rows of trace events are appended as the shared trace event stores
+ * instead, whose typed arrays are read in place rather than copied into the column arrays.  To match the presentation of the previous model, where each new row
+ * was inserted at the top, the most recently appended row is row zero of the model.  Sorting by a typed column
+ * exposes the rows in the order of a permutation computed by a parallel sort of the raw column values, which is
+ * cached with the storage and merged with the rows appended since, so repeated sorts and changing the sort order
+ * only copy the cached permutation.  When a page size is set, the model only exposes the first rows and the view
+ * fetches further pages from the typed storage as it is scrolled to the end of the exposed rows.  A row filter set by
+ * the proxy model of the view restricts the exposed rows to the storage rows it accepts, so each page holds rows shown
+ * by the view wherever they are stored.  Several models may expose the rows of the same storage, each with its own
+ * sort order, row filter and paging.
+ */
+
+class MetricTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+
+    // indicates whether the storage row is exposed by the model
+    typedef std::function< bool(int storageRow) > RowFilter;
+
+    explicit MetricTableModel(const QStringList& columnHeaders, QObject *parent = 0);
+    explicit MetricTableModel(MetricTableModel* model, QObject *parent = 0);
+    virtual ~MetricTableModel();
+
+    virtual int rowCount(const QModelIndex &parent = QModelIndex()) const Q_DECL_OVERRIDE;
+    virtual int columnCount(const QModelIndex &parent = QModelIndex()) const Q_DECL_OVERRIDE;
+    virtual QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+    virtual QVariant headerData(int section, Qt::Orientation orientation,
+                                int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+    virtual Qt::ItemFlags flags(const QModelIndex &index) const Q_DECL_OVERRIDE;
+    virtual bool canFetchMore(const QModelIndex &parent) const Q_DECL_OVERRIDE;
+    virtual void fetchMore(const QModelIndex &parent) Q_DECL_OVERRIDE;
+    virtual void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) Q_DECL_OVERRIDE;
+
+    bool isSortable(int column) const;
+
+    void setPageSize(int rows);
+
+    void setRowFilter(const RowFilter& filter);
+
+    void appendRows(const MetricViewDataBlock& block, const QStringList& columnHeaders = QStringList());
+    void appendTraceEvents(const TraceEventStorePtr& store);
+
+    QStringList columnHeaders() const;
+
+    int storageRow(int row) const;
+    int storageRowCount() const;
+
+    MetricViewDataBlock::ColumnType columnType(int column) const;
+    int columnUserType(int column) const;
+    double doubleValue(int storageRow, int column) const;
+    qint64 signedValue(int storageRow, int column) const;
+    quint64 unsignedValue(int storageRow, int column) const;
+    int stringId(int storageRow, int column) const;
+    bool isNull(int storageRow, int column) const;
+    QVariant storedValue(int storageRow, int column) const;
+
+    int internedStringCount() const;
+    const QString& internedString(int id) const;
+
+private:
+
+    struct Column {
+        Column() : defined( false ), type( MetricViewDataBlock::Variant ), userType( QVariant::Invalid ), storeColumn( -1 ) { }
+        bool defined;                            // column type determined by first value appended
+        MetricViewDataBlock::ColumnType type;
+        int userType;                            // QVariant user type of the values
+        int storeColumn;                         // column of the trace event stores holding the values (-1 if held below)
+        QVector< double > doubles;
+        QVector< qint64 > signedValues;
+        QVector< quint64 > unsignedValues;
+        QVector< int > stringIds;                // indexes into the interned string table
+        QVector< QVariant > variants;
+        QBitArray nulls;                         // set bit for each row without a value (sized on demand)
+    };
+
+    struct Storage {
+        Storage() : rowCount( 0 ) { }
+        QStringList columnHeaders;
+        QHash< QString, int > columnIndexes;     // map column header to column index
+        QVector< Column > columns;
+        int rowCount;                            // number of rows in the typed storage
+        QStringList strings;                     // interned string table shared by all string columns
+        QHash< QString, int > stringIds;
+        // storage rows of each column in ascending sort order computed on the first sort by the column (empty until then)
+        QVector< QVector< int > > sortOrders;
+        // position of each storage row in the sort order of each column
+        QVector< QVector< int > > sortPositions;
+        QList< MetricTableModel* > models;       // models exposing the rows of the storage
+        QVector< TraceEventStorePtr > stores;    // trace event stores holding the rows (empty if the rows were appended in blocks)
+        QVector< int > storeRows;                // first storage row of each trace event store
+        QVector< QVector< int > > storeStringIds; // interned string id of each function id of each trace event store
+    };
+
+    void appendBlock(const MetricViewDataBlock& block, const QStringList& columnHeaders);
+    void detachStores();
+    int storeIndex(int storageRow) const;
+    QVariant storeValue(const Column& column, int row) const;
+    void appendColumn(Column& column, const MetricViewDataBlock& block, int blockColumn);
+    void appendNulls(Column& column, int count);
+    void convertToVariantColumn(Column& column);
+    QVariant columnValue(const Column& column, int row) const;
+    int internString(const QString& str);
+
+    bool getSortOrder(int column, QVector< int >& sortedRows, QVector< int >& sortedPositions) const;
+    int sortedRow(int position) const;
+    int displayRow(int storageRow) const;
+    QVector< int > scanRows(int count);
+    void exposeRows(const QVector< int >& rows);
+    void changeLayout(int sortColumn, Qt::SortOrder order, const QVector< int >& sortedRows, const QVector< int >& sortedPositions, int storedRows);
+    void handleRowsAppended();
+
+    QSharedPointer< Storage > m_storage;        // typed storage shared with the models exposing the same rows
+
+    int m_rowCount;                              // number of storage rows known to the model
+
+    int m_pageSize;                              // number of rows exposed by each fetch (zero exposes all rows)
+    int m_fetchedRows;                           // number of rows exposed - the first rows of the model
+
+    RowFilter m_rowFilter;                       // storage rows exposed by the model (all rows if not set)
+    QVector< int > m_exposedRows;                // storage row of each exposed row while a row filter is set
+    int m_scannedRows;                           // number of rows in sort order tested by the row filter
+
+    int m_sortColumn;                            // sort column or -1 when the most recently appended row is first
+    Qt::SortOrder m_sortOrder;
+    QVector< int > m_sortedRows;                 // storage rows in ascending sort order of the sort column
+    QVector< int > m_sortedPositions;            // position of each storage row in the sorted rows
+
+};
+
+
+} // GUI
+} // ArgoNavis
+
+#endif // METRICTABLEMODEL_H
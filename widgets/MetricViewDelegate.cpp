@@ -23,10 +23,16 @@
 
 #include "MetricViewDelegate.h"
 
+#include <cstring>
+
 
 namespace ArgoNavis { namespace GUI {
 
 
+// maximum number of formatted numeric values cached - enough for the cells of the rows visible at once
+const int MAX_FORMATTED_VALUES = 4096;
+
+
 /**
  * @brief MetricViewDelegate::MetricViewDelegate
  * @param parent - the parent widget
@@ -35,6 +41,7 @@ namespace ArgoNavis { namespace GUI {
  */
 MetricViewDelegate::MetricViewDelegate(QObject *parent)
     : QStyledItemDelegate( parent )
+    , m_formattedValues( MAX_FORMATTED_VALUES )
 {
 
 }
@@ -46,17 +53,59 @@ MetricViewDelegate::MetricViewDelegate(QObject *parent)
  * @return - return the properly formatted display string
  *
  * Reimplements QStyledItemDelegate::displayText() method to reformat values in the model of type 'double' to show 6 digits of precision.
+ * The view formats the visible cells each time they are painted or sized, so the most recently formatted numeric values are cached.
+ * Strings are returned unchanged by the default implementation and are not cached.
  */
 QString MetricViewDelegate::displayText(const QVariant &value, const QLocale &locale) const
 {
-    // if the value is of user-type 'double' then reformat the value to have six digits of precision (digits to the right of the period)
-    if ( value.userType() == QVariant::Double ) {
-        return locale.toString( value.toDouble(), 'f', 6 );
+    const int userType = value.userType();
+
+    // the key of a numeric value is its user-type and the bits of the value
+    quint64 bits;
+
+    switch ( userType ) {
+    case QVariant::Double:
+    {
+        const double number = value.toDouble();
+        std::memcpy( &bits, &number, sizeof(bits) );
+        break;
     }
-    // all other QVariant user-types are formatted with the default implementation of displayText()
-    else {
+    case QVariant::Int:
+    case QVariant::LongLong:
+        bits = static_cast< quint64 >( value.toLongLong() );
+        break;
+    case QVariant::UInt:
+    case QVariant::ULongLong:
+        bits = value.toULongLong();
+        break;
+    default:
+        // all other QVariant user-types are formatted with the default implementation of displayText()
         return QStyledItemDelegate::displayText( value, locale );
     }
+
+    if ( locale != m_formattedLocale ) {
+        m_formattedValues.clear();
+        m_formattedLocale = locale;
+    }
+
+    const QPair< int, quint64 > key( userType, bits );
+
+    const QString* text = m_formattedValues.object( key );
+
+    if ( text )
+        return *text;
+
+    QString formatted;
+
+    // if the value is of user-type 'double' then reformat the value to have six digits of precision (digits to the right of the period)
+    if ( userType == QVariant::Double )
+        formatted = locale.toString( value.toDouble(), 'f', 6 );
+    else
+        formatted = QStyledItemDelegate::displayText( value, locale );
+
+    m_formattedValues.insert( key, new QString( formatted ) );
+
+    return formatted;
 }
 
 /**
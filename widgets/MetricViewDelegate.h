@@ -25,6 +25,10 @@
 #define METRICVIEWDELEGATE_H
 
 #include <QStyledItemDelegate>
+#include <QCache>
+#include <QPair>
+#include <QLocale>
+#include <QString>
 
 #include "common/openss-gui-config.h"
 
@@ -46,6 +50,12 @@ protected:
 
     void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const Q_DECL_OVERRIDE;
 
+private:
+
+    // least recently used formatted numeric values (keyed by user-type and bits of the value) for the locale used to format them
+    mutable QCache< QPair< int, quint64 >, QString > m_formattedValues;
+    mutable QLocale m_formattedLocale;
+
 };
 
 
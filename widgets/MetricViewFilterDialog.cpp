@@ -36,6 +36,10 @@
 namespace ArgoNavis { namespace GUI {
 
 
+// delay (in milliseconds) after the last edit of the filters before the matching row count is requested
+const int ROW_COUNT_DELAY = 150;
+
+
 /**
  * @brief MetricViewFilterDialog::MetricViewFilterDialog
  * @param parent - the parent widget
@@ -45,9 +49,17 @@ namespace ArgoNavis { namespace GUI {
 MetricViewFilterDialog::MetricViewFilterDialog(QWidget *parent)
     : QDialog( parent )
     , ui( new Ui::MetricViewFilterDialog )
+    , m_rowCountTimer( this )
 {
     ui->setupUi( this );
 
+    // the count of rows matching the filters being edited is requested once the user pauses editing
+    m_rowCountTimer.setSingleShot( true );
+    m_rowCountTimer.setInterval( ROW_COUNT_DELAY );
+
+    connect( &m_rowCountTimer, SIGNAL(timeout()), this, SLOT(handleRowCountTimeout()) );
+    connect( ui->comboBox_SelectColumn, SIGNAL(currentIndexChanged(int)), &m_rowCountTimer, SLOT(start()) );
+
     // create validator for filter expression entry to accept only valid regular expressions
     m_validator = new FilterExpressionValidator( this );
 
@@ -117,6 +129,40 @@ void MetricViewFilterDialog::handleValidateFilterExpression(const QString& text)
     QValidator::State state = m_validator->validate( validatorText, pos );
 
     ui->pushButton_Accept->setEnabled( QValidator::Acceptable == state );
+
+    m_rowCountTimer.start();
+}
+
+/**
+ * @brief MetricViewFilterDialog::setMatchingRowCount
+ * @param count - the number of rows matching the filters being edited or -1 if not known
+ * @param total - the total number of rows of the current metric view
+ *
+ * Shows the number of rows of the current metric view matching the defined filters and the filter expression being entered.
+ */
+void MetricViewFilterDialog::setMatchingRowCount(int count, int total)
+{
+    if ( count < 0 )
+        ui->label_MatchingRows->clear();
+    else
+        ui->label_MatchingRows->setText( tr("%1 of %2 rows match").arg( count ).arg( total ) );
+}
+
+/**
+ * @brief MetricViewFilterDialog::handleRowCountTimeout
+ *
+ * Handle the timeout of the row count timer once the filters have not been edited for ROW_COUNT_DELAY milliseconds.
+ * The filter expression being entered is included with the defined filters if it is a valid regular expression.
+ */
+void MetricViewFilterDialog::handleRowCountTimeout()
+{
+    QList< QPair<QString, QString> > filterList = getDefinedFilters();
+
+    if ( ui->pushButton_Accept->isEnabled() && ! ui->lineEdit_FilterText->text().isEmpty() ) {
+        filterList << qMakePair( ui->comboBox_SelectColumn->currentText(), ui->lineEdit_FilterText->text() );
+    }
+
+    emit requestMatchingRowCount( filterList );
 }
 
 /**
@@ -220,6 +266,8 @@ void MetricViewFilterDialog::handleClearPressed()
     ui->lineEdit_FilterText->clear();
     ui->comboBox_SelectColumn->setCurrentIndex( 0 );
     ui->pushButton_Accept->setEnabled( false );
+
+    m_rowCountTimer.start();
 }
 
 /**
@@ -257,6 +305,8 @@ void MetricViewFilterDialog::handleDeleteFilterItem()
         const QTableWidgetItem* item( selectedItems.at(i) );
         ui->tableWidget_DefinedFilters->removeRow( item->row() );
     }
+
+    m_rowCountTimer.start();
 }
 
 /**
@@ -269,15 +319,15 @@ void MetricViewFilterDialog::handleDeleteAllFilterItems()
     for( int row = ui->tableWidget_DefinedFilters->rowCount()-1; row >= 0; --row ) {
         ui->tableWidget_DefinedFilters->removeRow( row );
     }
+
+    m_rowCountTimer.start();
 }
 
 /**
- * @brief MetricViewFilterDialog::processDefinedFilters
- * @param applyNow - flag indicating whether the filters should be applied immediately
- *
- * This method processes the table of defined filters and emits the applyFilters signal.
+ * @brief MetricViewFilterDialog::getDefinedFilters
+ * @return - the list of filters defined in the table - each consisting of a column name and filter expression
  */
-void MetricViewFilterDialog::processDefinedFilters(bool applyNow)
+QList< QPair<QString, QString> > MetricViewFilterDialog::getDefinedFilters() const
 {
     QList< QPair<QString, QString> > filterList;
 
@@ -289,7 +339,20 @@ void MetricViewFilterDialog::processDefinedFilters(bool applyNow)
         filterList << qMakePair( columnItem->text(), filterItem->text() );
     }
 
-    emit applyFilters( filterList, applyNow );
+    return filterList;
+}
+
+/**
+ * @brief MetricViewFilterDialog::processDefinedFilters
+ * @param applyNow - flag indicating whether the filters should be applied immediately
+ *
+ * This method processes the table of defined filters and emits the applyFilters signal.
+ */
+void MetricViewFilterDialog::processDefinedFilters(bool applyNow)
+{
+    m_rowCountTimer.stop();
+
+    emit applyFilters( getDefinedFilters(), applyNow );
 }
 
 /**
@@ -339,6 +402,8 @@ void MetricViewFilterDialog::handleCancelPressed()
         }
     }
 
+    m_rowCountTimer.stop();
+
     QDialog::reject();
 }
 
@@ -27,6 +27,7 @@
 #include <QDialog>
 
 #include <QList>
+#include <QTimer>
 #include <set>
 
 #include "common/openss-gui-config.h"
@@ -59,9 +60,14 @@ public:
 
     void resetUI();
 
+public slots:
+
+    void setMatchingRowCount(int count, int total);
+
 signals:
 
     void applyFilters(const QList<QPair<QString, QString>>& filters, bool applyNow);
+    void requestMatchingRowCount(const QList<QPair<QString, QString>>& filters);
 
 protected:
 
@@ -83,9 +89,11 @@ private slots:
     void handleOkPressed();
     void handleCancelPressed();
     void handleValidateFilterExpression(const QString &text);
+    void handleRowCountTimeout();
 
 private:
 
+    QList< QPair<QString, QString> > getDefinedFilters() const;
     void processDefinedFilters(bool applyNow);
 
 private:
@@ -111,6 +119,8 @@ private:
 
     std::set< QString > m_columns;
 
+    QTimer m_rowCountTimer;     // restarted by each edit of the filters; the matching row count is requested once it times out
+
 };
 
 
@@ -32,6 +32,7 @@
 #include <QVector>
 
 #include <cmath>
+#include <algorithm>
 
 
 namespace ArgoNavis { namespace GUI {
@@ -100,8 +101,8 @@ PerformanceDataGraphView::PerformanceDataGraphView(QWidget *parent)
                  this, &PerformanceDataGraphView::handleInitGraphView );
         connect( dataMgr, static_cast<void(PerformanceDataManager::*)(const QString &metricName, const QString &viewName, const QString &eventName, int itemIndex, double data)>(&PerformanceDataManager::addGraphItem),
                  this, static_cast<void(PerformanceDataGraphView::*)(const QString &metricName, const QString &viewName, const QString &eventName, int itemIndex, double data)>(&PerformanceDataGraphView::handleAddGraphItem) );
-        connect( dataMgr, static_cast<void(PerformanceDataManager::*)(const QString &clusteringCriteriaName, const QString &metricNameTitle, const QString &metricName, double eventTime, double eventData, int rankOrThread)>(&PerformanceDataManager::addGraphItem),
-                 this, static_cast<void(PerformanceDataGraphView::*)(const QString &clusteringCriteriaName, const QString &metricNameTitle, const QString &metricName, double eventTime, double eventData, int rankOrThread)>(&PerformanceDataGraphView::handleAddGraphItem) );
+        connect( dataMgr, &PerformanceDataManager::addGraphItems,
+                 this, &PerformanceDataGraphView::handleAddGraphItems );
         connect( dataMgr, &PerformanceDataManager::requestMetricViewComplete,
                  this, &PerformanceDataGraphView::handleRequestMetricViewComplete, Qt::QueuedConnection );
         connect( dataMgr, &PerformanceDataManager::signalGraphMinAvgMaxRanks,
@@ -109,8 +110,8 @@ PerformanceDataGraphView::PerformanceDataGraphView(QWidget *parent)
 #else
         connect( dataMgr, SIGNAL(createGraphItems(QString,QString,QString,QString,QStringList,QStringList)),
                  this, SLOT(handleInitGraphView(QString,QString,QString,QString,QStringList,QStringList)) );
-        connect( dataMgr, SIGNAL(addGraphItem(QString,QString,QString,double,double,int)),
-                 this, SLOT(handleAddGraphItem(QString,QString,QString,double,double,int)) );
+        connect( dataMgr, SIGNAL(addGraphItems(QString,QString,QString,int,QVector<double>,QVector<double>)),
+                 this, SLOT(handleAddGraphItems(QString,QString,QString,int,QVector<double>,QVector<double>)) );
         connect( dataMgr, SIGNAL(addGraphItem(QString,QString,QString,int,double)),
                  this, SLOT(handleAddGraphItem(QString,QString,QString,int,double)) );
         connect( dataMgr, SIGNAL(requestMetricViewComplete(QString,QString,QString,QString,double,double)),
@@ -690,59 +691,64 @@ void PerformanceDataGraphView::handleAxisRangeChange(const QCPRange &requestedRa
 }
 
 /**
- * @brief PerformanceDataGraphView::handleAddGraphItem
+ * @brief PerformanceDataGraphView::handleAddGraphItems
  * @param clusteringCriteriaName - the clustering criteria name
  * @param metricNameTitle - the displayed metric name (for graph title on tab widget)
  * @param metricName - the metric name
- * @param eventTime - the time of the event
- * @param eventData - the metric data for the event
- * @param rankOrThread - the rank or thread id in which the trace event occurred
+ * @param rankOrThread - the rank or thread id in which the events occurred
+ * @param eventTimes - the times of the events in ascending order
+ * @param eventData - the metric data for each event
  *
- * This method handles adding a graph item to the graph (if it hasn't been created yet) and then adds the data to the graph.
+ * This method handles adding the graph of the rank or thread (if it hasn't been created yet) and then installs all its data
+ * points with one update of the already sorted data container instead of a sorted insert for each point.
  */
-void PerformanceDataGraphView::handleAddGraphItem(const QString &clusteringCriteriaName, const QString &metricNameTitle, const QString &metricName, double eventTime, double eventData, int rankOrThread)
+void PerformanceDataGraphView::handleAddGraphItems(const QString &clusteringCriteriaName, const QString &metricNameTitle, const QString &metricName, int rankOrThread, const QVector<double> &eventTimes, const QVector<double> &eventData)
 {
-    Q_UNUSED( rankOrThread );
+    if ( eventTimes.isEmpty() || eventTimes.size() != eventData.size() )
+        return;
 
-    CustomPlot* graphView( Q_NULLPTR);
+    const double largestValue = *std::max_element( eventData.constBegin(), eventData.constEnd() );
 
-    {
-        QMutexLocker guard( &m_mutex );
+    QMutexLocker guard( &m_mutex );
 
-        if ( ! m_metricGroup.contains( metricName ) ) {
+    if ( ! m_metricGroup.contains( metricName ) ) {
+        CustomPlot* graphView = initPlotView( clusteringCriteriaName, metricNameTitle, metricName, false );
 
-            graphView = initPlotView( clusteringCriteriaName, metricNameTitle, metricName, false );
+        m_metricGroup.insert( metricName, MetricGroup( graphView ) );
+    }
 
-            m_metricGroup.insert( metricName, MetricGroup( graphView ) );
-        }
-        else {
-            // get graph index for cluster
-            graphView = m_metricGroup[ metricName ].graph;
-        }
+    MetricGroup& metricGroup = m_metricGroup[ metricName ];
 
-        MetricGroup& metricGroup = m_metricGroup[ metricName ];
+    if ( metricGroup.yGraphRange.upper < largestValue ) {
+        metricGroup.yGraphRange.upper = largestValue;
+    }
 
-        if ( metricGroup.yGraphRange.upper < eventData ) {
-            metricGroup.yGraphRange.upper = eventData;
-        }
+    QCPGraph* graph( Q_NULLPTR );
 
-        QCPGraph* graph( Q_NULLPTR );
+    if ( metricGroup.subgraphs.contains( rankOrThread ) ) {
+        graph = metricGroup.subgraphs[ rankOrThread ];
+    }
+    else {
+        graph = initGraph( metricGroup.graph, rankOrThread );
 
-        if ( metricGroup.subgraphs.contains( rankOrThread ) ) {
-            graph = metricGroup.subgraphs[ rankOrThread ];
-        }
-        else {
-            graph = initGraph( graphView, rankOrThread );
+        // set plot colors for new graph
+        graph->setPen( QPen( goldenRatioColor( metricGroup.mt ), 2.0 ) );
 
-            // set plot colors for new graph
-            graph->setPen( QPen( goldenRatioColor( metricGroup.mt ), 2.0 ) );
+        metricGroup.subgraphs.insert( rankOrThread, graph );
+    }
 
-            metricGroup.subgraphs.insert( rankOrThread, graph );
-        }
-        if ( graph ) {
-            // pass data points to graphs
-            graph->addData( eventTime, eventData );
-        }
+    if ( graph ) {
+#if defined(HAS_QCUSTOMPLOT_V2)
+        if ( graph->data()->isEmpty() )
+            graph->setData( eventTimes, eventData, true );
+        else
+            graph->addData( eventTimes, eventData, true );
+#else
+        if ( graph->data()->isEmpty() )
+            graph->setData( eventTimes, eventData );
+        else
+            graph->addData( eventTimes, eventData );
+#endif
     }
 }
 
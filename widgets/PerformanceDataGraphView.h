@@ -66,12 +66,12 @@ private slots:
                              const QStringList &eventNames,
                              const QStringList &items);
 
-    void handleAddGraphItem(const QString &clusteringCriteriaName,
-                            const QString &metricNameTitle,
-                            const QString &metricName,
-                            double eventTime,
-                            double eventData,
-                            int rankOrThread);
+    void handleAddGraphItems(const QString &clusteringCriteriaName,
+                             const QString &metricNameTitle,
+                             const QString &metricName,
+                             int rankOrThread,
+                             const QVector< double > &eventTimes,
+                             const QVector< double > &eventData);
 
     void handleAddGraphItem(const QString &metricName,
                             const QString &viewName,
@@ -26,6 +26,7 @@
 #include "common/openss-gui-config.h"
 
 #include "ViewSortFilterProxyModel.h"
+#include "MetricTableModel.h"
 #include "MetricViewDelegate.h"
 
 #include "managers/PerformanceDataManager.h"
@@ -73,6 +74,9 @@ QString PerformanceDataMetricView::s_allEventsDetailsName( tr("All Events") );
 QString PerformanceDataMetricView::s_APPLY_FILTERS_STR = tr("Apply Filters");
 QString PerformanceDataMetricView::s_CLEAR_FILTERS_STR = tr("Clear Filters");
 
+// number of rows of a details or trace view fetched each time the view is scrolled to the end of its rows
+const int DETAILS_VIEW_PAGE_ROWS = 1000;
+
 
 /**
  * @brief PerformanceDataTableView::PerformanceDataTableView
@@ -140,6 +144,8 @@ PerformanceDataMetricView::PerformanceDataMetricView(QWidget *parent)
         connect( dataMgr, &PerformanceDataManager::addMetricView, this, &PerformanceDataMetricView::handleInitModel, Qt::QueuedConnection );
         connect( dataMgr, &PerformanceDataManager::addAssociatedMetricView, this, &PerformanceDataMetricView::handleInitModelView, Qt::QueuedConnection );
         connect( dataMgr, &PerformanceDataManager::addMetricViewData, this, &PerformanceDataMetricView::handleAddData, Qt::QueuedConnection );
+        connect( dataMgr, &PerformanceDataManager::addMetricViewDataBlock, this, &PerformanceDataMetricView::handleAddDataBlock, Qt::QueuedConnection );
+        connect( dataMgr, &PerformanceDataManager::addMetricViewTraceEvents, this, &PerformanceDataMetricView::handleAddTraceEvents, Qt::QueuedConnection );
         connect( dataMgr, &PerformanceDataManager::requestMetricViewComplete, this, &PerformanceDataMetricView::handleRequestMetricViewComplete, Qt::QueuedConnection );
 #else
         connect( dataMgr, SIGNAL(addMetricView(QString,QString,QString,QString,QStringList)),
@@ -148,6 +154,10 @@ PerformanceDataMetricView::PerformanceDataMetricView(QWidget *parent)
                  this, SLOT(handleInitModelView(QString,QString,QString,QString,QString,QStringList)), Qt::QueuedConnection );
         connect( dataMgr, SIGNAL(addMetricViewData(QString,QString,QString,QString,QVariantList,QStringList)),
                  this, SLOT(handleAddData(QString,QString,QString,QString,QVariantList,QStringList)), Qt::QueuedConnection );
+        connect( dataMgr, SIGNAL(addMetricViewDataBlock(QString,QString,QString,QString,MetricViewDataBlock,QStringList)),
+                 this, SLOT(handleAddDataBlock(QString,QString,QString,QString,MetricViewDataBlock,QStringList)), Qt::QueuedConnection );
+        connect( dataMgr, SIGNAL(addMetricViewTraceEvents(QString,QString,QString,QString,TraceEventStorePtr)),
+                 this, SLOT(handleAddTraceEvents(QString,QString,QString,QString,TraceEventStorePtr)), Qt::QueuedConnection );
         connect( dataMgr, SIGNAL(requestMetricViewComplete(QString,QString,QString,QString,double,double)),
                  this, SLOT(handleRequestMetricViewComplete(QString,QString,QString,QString,double,double)), Qt::QueuedConnection );
 #endif
@@ -200,6 +210,10 @@ PerformanceDataMetricView::PerformanceDataMetricView(QWidget *parent)
     connect( m_metricViewFilterDialog, SIGNAL(applyFilters(QList<QPair<QString,QString> >,bool)),
              this, SLOT(handleApplyFilter(QList<QPair<QString,QString> >,bool)) );
 
+    // connect metric view filter dialog's request for the number of rows matching the filters being edited to the handler in this class
+    connect( m_metricViewFilterDialog, SIGNAL(requestMatchingRowCount(QList<QPair<QString,QString> >)),
+             this, SLOT(handleRequestMatchingRowCount(QList<QPair<QString,QString> >)) );
+
     // connect 'Apply Filters' button to handler
     connect( ui->pushButton_ApplyClearFilters, SIGNAL(pressed()), this, SLOT(handleApplyClearFilters()) );
 }
@@ -446,7 +460,7 @@ void PerformanceDataMetricView::clearExistingModelsAndViews(const QString& metri
     }
 
     if ( deleteModel ) {
-        QStandardItemModel* model = m_models.value( metricViewName, Q_NULLPTR );
+        MetricTableModel* model = m_models.value( metricViewName, Q_NULLPTR );
         if ( model ) {
             m_models.remove( metricViewName );
             delete model;
@@ -484,15 +498,17 @@ void PerformanceDataMetricView::handleInitModel(const QString& clusteringCriteri
 
     clearExistingModelsAndViews( metricViewName );
 
-    QStandardItemModel* model = new QStandardItemModel( 0, metrics.size(), this );
+    MetricTableModel* model = new MetricTableModel( metrics, this );
 
     if ( Q_NULLPTR == model )
         return;
 
-    model->setHorizontalHeaderLabels( metrics );
-
     m_models[ metricViewName ] = model;
 
+    // only expose the rows scrolled to - there can be millions of events
+    if ( s_allEventsDetailsName == viewName )
+        model->setPageSize( DETAILS_VIEW_PAGE_ROWS );
+
     if ( s_detailsModeName == metricName  )
         return;
 
@@ -601,7 +617,7 @@ void PerformanceDataMetricView::handleInitModel(const QString& clusteringCriteri
  * @param attachedMetricViewName - name of metric view whose model should also be attached to this new metric view
  * @param metrics - list of metrics for setting column headers
  *
- * Create and initialize the model and view for the new metric view.  Attach the view to the model associated with the attached metric view.
+ * Create and initialize the model and view for the new metric view.  Attach the view to a model exposing the rows of the model associated with the attached metric view.
  */
 void PerformanceDataMetricView::handleInitModelView(const QString &clusteringCriteriaName, const QString& modeName, const QString &metricName, const QString &viewName, const QString &attachedMetricViewName, const QStringList &metrics)
 {
@@ -646,11 +662,18 @@ void PerformanceDataMetricView::handleInitModelView(const QString &clusteringCri
     {
         QMutexLocker guard( &m_mutex ); 
 
-        QStandardItemModel* model = m_models.value( attachedMetricViewName, Q_NULLPTR );
+        MetricTableModel* model = m_models.value( attachedMetricViewName, Q_NULLPTR );
 
         if ( Q_NULLPTR == model )
             return;
 
+        // each view sorts and pages its own model exposing the rows of the attached model without copying them
+        if ( metricViewName != attachedMetricViewName ) {
+            delete m_models.take( metricViewName );
+            model = new MetricTableModel( model, this );
+            m_models[ metricViewName ] = model;
+        }
+
         const QString type = ( viewName == s_allEventsDetailsName ) ? "*" : viewName;
 
         ViewSortFilterProxyModel* proxyModel = new ViewSortFilterProxyModel( type );
@@ -658,6 +681,9 @@ void PerformanceDataMetricView::handleInitModelView(const QString &clusteringCri
         if ( Q_NULLPTR == proxyModel )
             return;
 
+        // only expose the rows scrolled to - there can be millions of events
+        model->setPageSize( DETAILS_VIEW_PAGE_ROWS );
+
         proxyModel->setSourceModel( model );
         proxyModel->setColumnHeaders( metrics );
 
@@ -912,6 +938,33 @@ void PerformanceDataMetricView::handleApplyFilter(const QList<QPair<QString, QSt
     m_currentFilter = filters;
 }
 
+/**
+ * @brief PerformanceDataMetricView::handleRequestMatchingRowCount
+ * @param filters - the user-defined filter being edited
+ *
+ * Handler invoked when the MetricViewFilterDialog::requestMatchingRowCount signal is emitted.  The number of rows of the
+ * current metric view matching the filter is counted by the proxy model and shown by the dialog.
+ */
+void PerformanceDataMetricView::handleRequestMatchingRowCount(const QList<QPair<QString, QString> > &filters)
+{
+    const QString metricViewName = getMetricViewName();
+
+    QMutexLocker guard( &m_mutex );
+
+    DefaultSortFilterProxyModel* proxyModel =
+            qobject_cast< DefaultSortFilterProxyModel* >( m_proxyModels.value( metricViewName, Q_NULLPTR ) );
+
+    const MetricTableModel* model = proxyModel ? qobject_cast< const MetricTableModel* >( proxyModel->sourceModel() ) : Q_NULLPTR;
+
+    // the rows of the typed storage not exposed yet are counted as well
+    if ( model )
+        m_metricViewFilterDialog->setMatchingRowCount( proxyModel->countAcceptedRows( filters ), model->storageRowCount() );
+    else if ( proxyModel && proxyModel->sourceModel() )
+        m_metricViewFilterDialog->setMatchingRowCount( proxyModel->countAcceptedRows( filters ), proxyModel->sourceModel()->rowCount() );
+    else
+        m_metricViewFilterDialog->setMatchingRowCount( -1, 0 );
+}
+
 /**
  * @brief PerformanceDataMetricView::processCustomContextMenuRequested
  * @param view - pointer to QTreeView instance
@@ -956,45 +1009,68 @@ void PerformanceDataMetricView::processCustomContextMenuRequested(QTreeView* vie
  */
 void PerformanceDataMetricView::handleAddData(const QString& clusteringCriteriaName, const QString &modeName, const QString &metricName, const QString& viewName, const QVariantList& data, const QStringList &columnHeaders)
 {
-    if ( m_clusteringCritieriaName != clusteringCriteriaName || ( ! columnHeaders.isEmpty() && data.size() != columnHeaders.size() ) )
+    MetricViewDataBlock block( 1 );
+
+    block.appendRow( data );
+
+    handleAddDataBlock( clusteringCriteriaName, modeName, metricName, viewName, block, columnHeaders );
+}
+
+/**
+ * @brief PerformanceDataMetricView::handleAddDataBlock
+ * @param clusteringCriteriaName - clustering criteria name associated to the metric view
+ * @param modeName - the mode name
+ * @param metricName - name of metric view for which to add data to model
+ * @param viewName - name of the view for which to add data to model
+ * @param block - the block of rows to add to the model
+ * @param columnHeaders - if present provides the names of the columns for each index in the data
+ *
+ * Inserts all rows of the block into the model of the specified metric view.  The rows are inserted with a single
+ * insertion into the model and end up in the same order as if each row had been added by handleAddData.
+ */
+void PerformanceDataMetricView::handleAddDataBlock(const QString &clusteringCriteriaName, const QString &modeName, const QString &metricName, const QString &viewName, const MetricViewDataBlock &block, const QStringList &columnHeaders)
+{
+    if ( m_clusteringCritieriaName != clusteringCriteriaName || block.isEmpty() || ( ! columnHeaders.isEmpty() && block.columnCount() != columnHeaders.size() ) )
         return;
 
     const QString metricViewName = PerformanceDataMetricView::getMetricViewName( modeName, metricName, viewName );
 
     QMutexLocker guard( &m_mutex );
 
-    QStandardItemModel* model = m_models.value( metricViewName );
+    MetricTableModel* model = m_models.value( metricViewName );
 
     if ( Q_NULLPTR == model )
         return;
 
-    // make a new row for the data
-    model->insertRow( 0 );
+    model->appendRows( block, columnHeaders );
+}
 
-    if ( columnHeaders.isEmpty() ) {
-        // without column headers just insert into the model in sequential order of the data indexes
-        for ( int i=0; i<data.size(); ++i ) {
-            model->setData( model->index( 0, i ), data.at( i ) );
-        }
-    }
-    else {
-        // with column headers need to map the name of the column associated with each data index to
-        // the proper column index in the model
-        QStringList modelColumnHeaders;
+/**
+ * @brief PerformanceDataMetricView::handleAddTraceEvents
+ * @param clusteringCriteriaName - clustering criteria name associated to the metric view
+ * @param modeName - the mode name
+ * @param metricName - name of metric view for which to add data to model
+ * @param viewName - name of the view for which to add data to model
+ * @param store - the trace events to add to the model
+ *
+ * Inserts a row for each trace event of the store into the model of the specified metric view.  The model reads the cells of
+ * the rows from the typed arrays of the store shared with the timeline.
+ */
+void PerformanceDataMetricView::handleAddTraceEvents(const QString &clusteringCriteriaName, const QString &modeName, const QString &metricName, const QString &viewName, const TraceEventStorePtr &store)
+{
+    if ( m_clusteringCritieriaName != clusteringCriteriaName || store.isNull() )
+        return;
 
-        for (int i=0; i<model->columnCount(); ++i) {
-            modelColumnHeaders << model->headerData( i, Qt::Horizontal ).toString();
-        }
+    const QString metricViewName = PerformanceDataMetricView::getMetricViewName( modeName, metricName, viewName );
 
-        int count = 0;
-        foreach( const QString& name, columnHeaders ) {
-            int index = modelColumnHeaders.indexOf( name );
-            if ( index != -1 ) {
-                model->setData( model->index( 0, index ), data.at( count ) );
-            }
-            ++count;
-        }
-    }
+    QMutexLocker guard( &m_mutex );
+
+    MetricTableModel* model = m_models.value( metricViewName );
+
+    if ( Q_NULLPTR == model )
+        return;
+
+    model->appendTraceEvents( store );
 }
 
 /**
@@ -1314,15 +1390,9 @@ void PerformanceDataMetricView::handleRequestMetricViewComplete(const QString &c
             }
         }
 
-        QStandardItemModel* model = m_models.value( metricViewName, Q_NULLPTR );
+        MetricTableModel* model = m_models.value( metricViewName, Q_NULLPTR );
         if ( model ) {
-            QStringList columnList;
-
-            for ( int i=0; i<model->columnCount(); ++i ) {
-                columnList << model->headerData( i, Qt::Horizontal ).toString();
-            }
-
-            m_metricViewFilterDialog->setColumns( columnList );
+            m_metricViewFilterDialog->setColumns( model->columnHeaders() );
         }
 
         if ( Q_NULLPTR != view ) {
@@ -31,6 +31,8 @@
 #include <QStandardItemModel>
 
 #include "CBTF-ArgoNavis-Ext/NameValueDefines.h"
+#include "managers/MetricViewDataBlock.h"
+#include "managers/TraceEventStore.h"
 
 // [ Forward Declarations ]
 
@@ -50,6 +52,7 @@ namespace ArgoNavis { namespace GUI {
 class ModifyPathSubstitutionsDialog;
 class ShowDeviceDetailsDialog;
 class MetricViewFilterDialog;
+class MetricTableModel;
 class DerivedMetricInformationDialog;
 
 
@@ -118,6 +121,8 @@ public slots:
     void handleInitModel(const QString& clusteringCriteriaName, const QString& modeName, const QString& metricName, const QString& viewName, const QStringList& metrics);
     void handleInitModelView(const QString& clusteringCriteriaName, const QString& modeName, const QString& metricName, const QString& viewName, const QString& attachedMetricViewName, const QStringList& metrics);
     void handleAddData(const QString& clusteringCriteriaName, const QString& modeName, const QString &metricName, const QString& viewName, const QVariantList& data, const QStringList& columnHeaders);
+    void handleAddDataBlock(const QString& clusteringCriteriaName, const QString& modeName, const QString &metricName, const QString& viewName, const MetricViewDataBlock& block, const QStringList& columnHeaders);
+    void handleAddTraceEvents(const QString& clusteringCriteriaName, const QString& modeName, const QString &metricName, const QString& viewName, const TraceEventStorePtr& store);
     void handleRangeChanged(const QString& clusteringCriteriaName, const QString &modeName, const QString& metricName, const QString& viewName, double lower, double upper);
     void handleRequestViewUpdate(bool clearExistingViews);
 
@@ -131,6 +136,7 @@ private slots:
     void handleCustomContextMenuRequested(const QPoint& pos);
     void handleApplyClearFilters();
     void handleApplyFilter(const QList<QPair<QString,QString> >& filters, bool applyNow);
+    void handleRequestMatchingRowCount(const QList<QPair<QString,QString> >& filters);
 
 private:
 
@@ -178,7 +184,7 @@ private:
 
     QString m_clusteringCritieriaName;                      // clustering criteria name associated to metric views
     QMutex m_mutex;                                         // mutex for the following QMap objects
-    QMap< QString, QStandardItemModel* > m_models;          // map metric to model
+    QMap< QString, MetricTableModel* > m_models;            // map metric to model
     QMap< QString, QSortFilterProxyModel* > m_proxyModels;  // map metric to model
     QMap< QString, QTreeView* > m_views;                    // map metric to view
 
@@ -27,13 +27,14 @@
 #include "managers/PerformanceDataManager.h"
 #include "common/openss-gui-config.h"
 
-#include "graphitems/OSSDataTransferItem.h"
-#include "graphitems/OSSKernelExecutionItem.h"
-#include "graphitems/OSSPeriodicSampleItem.h"
+#include "graphitems/OSSEventLanePlottable.h"
 #include "graphitems/OSSEventsSummaryItem.h"
-#include "graphitems/OSSTraceItem.h"
 #include "graphitems/OSSHighlightItem.h"
 
+#include <ArgoNavis/Base/Time.hpp>
+#include <ArgoNavis/CUDA/DataTransfer.hpp>
+#include <ArgoNavis/CUDA/KernelExecution.hpp>
+
 #include <QtGlobal>
 #include <qmath.h>
 #include <QPen>
@@ -43,6 +44,32 @@
 namespace ArgoNavis { namespace GUI {
 
 
+// time in milliseconds after the last range change until the event lanes are drawn exactly
+const int REFINE_DELAY = 200;
+
+// maximum number of rank rows the height of a trace graph is sized for; more ranks are folded or scrolled
+const int MAX_RANK_ROWS = 16;
+
+// minimum number of ranks spanned by the visible value range of a trace graph
+const double MIN_RANK_SPREAD = 2.0;
+
+
+/**
+ * @brief getTimelineTime
+ * @param time - the event time
+ * @param time_origin - the time origin of the experiment
+ * @return - the event time on the x axis timeline (milliseconds relative to the time origin)
+ */
+static double getTimelineTime(const Base::Time& time, const Base::Time& time_origin)
+{
+    double timelineTime = static_cast<uint64_t>(time - time_origin) / 1000000.0;
+#if defined(USE_DISCRETE_SAMPLES)
+    timelineTime /= 10.0;
+#endif
+    return timelineTime;
+}
+
+
 /**
  * @brief PerformanceDataTimelineView::PerformanceDataTimelineView
  * @param parent - specify parent of the PerformanceDataTimelineView instance
@@ -55,6 +82,7 @@ PerformanceDataTimelineView::PerformanceDataTimelineView(QWidget *parent)
     , ui( new Ui::PerformanceDataTimelineView )
     , m_metricCount( 0 )
     , m_highlightItem( Q_NULLPTR )
+    , m_refineTimer( this )
 {
     qsrand( QDateTime::currentDateTime().toTime_t() );
 
@@ -69,6 +97,11 @@ PerformanceDataTimelineView::PerformanceDataTimelineView(QWidget *parent)
 
     ui->graphView->setNoAntialiasingOnDrag( true );
 
+    m_refineTimer.setSingleShot( true );
+    m_refineTimer.setInterval( REFINE_DELAY );
+
+    connect( &m_refineTimer, SIGNAL(timeout()), this, SLOT(handleRefineTimeout()) );
+
     ui->graphView->setInteractions( QCP::iRangeDrag | QCP::iRangeZoom );
     //                              QCP::iSelectAxes | QCP::iSelectPlottables | QCP::iSelectItems );
 
@@ -78,11 +111,13 @@ PerformanceDataTimelineView::PerformanceDataTimelineView(QWidget *parent)
     // connect some interaction slots:
     connect( ui->graphView, SIGNAL(axisDoubleClick(QCPAxis*,QCPAxis::SelectablePart,QMouseEvent*)), this, SLOT(handleAxisLabelDoubleClick(QCPAxis*,QCPAxis::SelectablePart)) );
 
-    // connect slot when an item is clicked
+    // connect slot when an event lane is clicked
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
-    connect( ui->graphView, &QCustomPlot::itemClick, this, &PerformanceDataTimelineView::handleItemClick );
+    connect( ui->graphView, &QCustomPlot::plottableClick, this, &PerformanceDataTimelineView::handlePlottableClick );
+#elif defined(HAS_QCUSTOMPLOT_V2)
+    connect( ui->graphView, SIGNAL(plottableClick(QCPAbstractPlottable*,int,QMouseEvent*)), this, SLOT(handlePlottableClick(QCPAbstractPlottable*,int,QMouseEvent*)) );
 #else
-    connect( ui->graphView, SIGNAL(itemClick(QCPAbstractItem*,QMouseEvent*)), this, SLOT(handleItemClick(QCPAbstractItem*,QMouseEvent*)) );
+    connect( ui->graphView, SIGNAL(plottableClick(QCPAbstractPlottable*,QMouseEvent*)), this, SLOT(handlePlottableClick(QCPAbstractPlottable*,QMouseEvent*)) );
 #endif
 
     // connect performance data manager signals to performance data view slots
@@ -93,7 +128,7 @@ PerformanceDataTimelineView::PerformanceDataTimelineView(QWidget *parent)
         connect( dataMgr, &PerformanceDataManager::addDataTransfer, this, &PerformanceDataTimelineView::handleAddDataTransfer, Qt::QueuedConnection );
         connect( dataMgr, &PerformanceDataManager::addKernelExecution, this, &PerformanceDataTimelineView::handleAddKernelExecution, Qt::QueuedConnection );
         connect( dataMgr, &PerformanceDataManager::addPeriodicSample, this, &PerformanceDataTimelineView::handleAddPeriodicSample, Qt::QueuedConnection );
-        connect( dataMgr, &PerformanceDataManager::addTraceItem, this, &PerformanceDataTimelineView::handleAddTraceItem, Qt::QueuedConnection );
+        connect( dataMgr, &PerformanceDataManager::addTraceItems, this, &PerformanceDataTimelineView::handleAddTraceItems, Qt::QueuedConnection );
         connect( dataMgr, &PerformanceDataManager::addCudaEventSnapshot, this, &PerformanceDataTimelineView::handleCudaEventSnapshot, Qt::QueuedConnection );
         connect( this, &PerformanceDataTimelineView::graphRangeChanged, dataMgr, &PerformanceDataManager::graphRangeChanged );
         connect( dataMgr, &PerformanceDataManager::requestMetricViewComplete, this, &PerformanceDataTimelineView::handleRequestMetricViewComplete, Qt::QueuedConnection );
@@ -104,8 +139,8 @@ PerformanceDataTimelineView::PerformanceDataTimelineView(QWidget *parent)
         connect( dataMgr, SIGNAL(addDataTransfer(QString,QString,Base::Time,CUDA::DataTransfer)), this, SLOT(handleAddDataTransfer(QString,QString,Base::Time,CUDA::DataTransfer)), Qt::QueuedConnection );
         connect( dataMgr, SIGNAL(addKernelExecution(QString,QString,Base::Time,CUDA::KernelExecution)), this, SLOT(handleAddKernelExecution(QString,QString,Base::Time,CUDA::KernelExecution)), Qt::QueuedConnection );
         connect( dataMgr, SIGNAL(addPeriodicSample(QString,QString,double,double,double)), this, SLOT(handleAddPeriodicSample(QString,QString,double,double,double)), Qt::QueuedConnection );
-        connect( dataMgr, SIGNAL(addTraceItem(QString,QString,QString,double,double,int)),
-                 this, SLOT(handleAddTraceItem(QString,QString,QString,double,double,int)) );
+        connect( dataMgr, SIGNAL(addTraceItems(QString,QString,QString,TraceEventStorePtr)),
+                 this, SLOT(handleAddTraceItems(QString,QString,QString,TraceEventStorePtr)) );
         connect( dataMgr, SIGNAL(addCudaEventSnapshot(const QString&,const QString&,double,double,const QImage&)),
                  this, SLOT(handleCudaEventSnapshot(const QString&,const QString&,double,double,const QImage&)), Qt::QueuedConnection );
         connect( this, SIGNAL(graphRangeChanged(QString,QString,double,double,QSize)), dataMgr, SIGNAL(graphRangeChanged(QString,QString,double,double,QSize)) );
@@ -137,6 +172,8 @@ void PerformanceDataTimelineView::unloadExperimentDataFromView(const QString &ex
 {
     Q_UNUSED( experimentName )  // for now until view supports more than one experiment
 
+    m_refineTimer.stop();
+
     if ( m_highlightItem != Q_NULLPTR ) {
         disconnect( this, SIGNAL(signalTraceItemSelected(QString,double,double,int)),
                     m_highlightItem, SLOT(setData(QString,double,double,int)) );
@@ -145,7 +182,7 @@ void PerformanceDataTimelineView::unloadExperimentDataFromView(const QString &ex
 
     ui->graphView->clearGraphs();
     ui->graphView->clearItems();  // deletes 'm_highlightItem' as well
-    ui->graphView->clearPlottables();
+    ui->graphView->clearPlottables();  // deletes the event lanes as well
 
     ui->graphView->plotLayout()->clear();
 
@@ -214,6 +251,10 @@ void PerformanceDataTimelineView::handleAxisRangeChange(const QCPRange &requeste
 
     emit graphRangeChanged( clusteringCriteriaName, clusterName, lower, upper, size );
 
+    // draw a coarse approximation of the event lanes until the range changes have settled
+    setEventLanesCoarse( true );
+    m_refineTimer.start();
+
     QCPRange newRange = xAxis->range();
     //qDebug() << "newRange: lower: " << newRange.lower << "upper: " << newRange.upper;
 
@@ -270,6 +311,58 @@ void PerformanceDataTimelineView::handleAxisRangeChange(const QCPRange &requeste
     xAxis->blockSignals( false );
 }
 
+/**
+ * @brief PerformanceDataTimelineView::handleRankAxisRangeChange
+ * @param requestedRange - the range of this axis due to change
+ *
+ * Handle changes to the rank axis range of a trace graph.  The requested range is kept within the ranks of the experiment
+ * and spans at least MIN_RANK_SPREAD ranks.  The event lanes are drawn coarse until the range changes have settled.
+ */
+void PerformanceDataTimelineView::handleRankAxisRangeChange(const QCPRange &requestedRange)
+{
+    QCPAxis* yAxis = qobject_cast< QCPAxis* >( sender() );
+
+    if ( Q_NULLPTR == yAxis )
+        return;
+
+    const double rankLower = yAxis->property( "rankRangeLower" ).toDouble();
+    const double rankUpper = yAxis->property( "rankRangeUpper" ).toDouble();
+
+    double lower = qMax( requestedRange.lower, rankLower );
+    double upper = qMin( requestedRange.upper, rankUpper );
+
+    if ( upper - lower < MIN_RANK_SPREAD ) {
+        if ( upper - MIN_RANK_SPREAD > rankLower )
+            lower = upper - MIN_RANK_SPREAD;
+        else
+            upper = qMin( rankUpper, lower + MIN_RANK_SPREAD );
+    }
+
+    yAxis->blockSignals( true );
+    yAxis->setRange( lower, upper );
+    yAxis->blockSignals( false );
+
+    setEventLanesCoarse( true );
+    m_refineTimer.start();
+}
+
+/**
+ * @brief PerformanceDataTimelineView::handleRefineTimeout
+ *
+ * Handle the timeout of the refine timer once no range change has occurred for REFINE_DELAY milliseconds.  The event lanes
+ * are drawn exactly again.  A range change before the timeout restarts the timer so the exact drawing is abandoned.
+ */
+void PerformanceDataTimelineView::handleRefineTimeout()
+{
+    setEventLanesCoarse( false );
+
+#if defined(HAS_QCUSTOMPLOT_V2)
+    ui->graphView->replot( QCustomPlot::rpQueuedReplot );
+#else
+    ui->graphView->replot( QCustomPlot::rpQueued );
+#endif
+}
+
 /**
  * @brief PerformanceDataTimelineView::handleAxisRangeChangeForMetricGroup
  * @param senderAxis - the QCPAxis instance emitting the signal
@@ -304,7 +397,8 @@ void PerformanceDataTimelineView::handleAxisRangeChangeForMetricGroup(QCPAxis* s
  * @param axis - the axis that received the click
  * @param part - the part of the axis that was clicked
  *
- * Handler to process QCustomPlot::axisDoubleClick signal resulting when an axis is double clicked.
+ * Handler to process QCustomPlot::axisDoubleClick signal resulting when an axis is double clicked.  Double clicking the axis
+ * label edits the label and double clicking the rank tick labels of a trace graph toggles the rank folding.
  */
 void PerformanceDataTimelineView::handleAxisLabelDoubleClick(QCPAxis *axis, QCPAxis::SelectablePart part)
 {
@@ -317,6 +411,21 @@ void PerformanceDataTimelineView::handleAxisLabelDoubleClick(QCPAxis *axis, QCPA
             ui->graphView->replot();
         }
     }
+    // Toggle rank folding of a trace graph by double clicking the rank tick labels
+    else if ( part == QCPAxis::spTickLabels && axis->property( "rankRangeUpper" ).isValid() ) {
+        {
+            QMutexLocker guard( &m_mutex );
+
+            foreach ( MetricGroup* group, m_metricGroups ) {
+                foreach ( OSSEventLanePlottable* lane, group->eventLanes ) {
+                    if ( lane->valueAxis() == axis )
+                        lane->setRankFolding( ! lane->hasRankFolding() );
+                }
+            }
+        }
+
+        ui->graphView->replot();
+    }
 }
 
 /**
@@ -329,8 +438,9 @@ void PerformanceDataTimelineView::handleSelectionChanged()
     // synchronize selection of graphs with selection of corresponding legend items:
     for ( int i=0; i< ui->graphView->plottableCount(); ++i ) {
         QCPAbstractPlottable* graph =  ui->graphView->plottable(i);
-        QCPPlottableLegendItem *item =  ui->graphView->legend->itemWithPlottable( graph );
-        item->setSelected( item->selected() );
+        QCPPlottableLegendItem *item = ui->graphView->legend ? ui->graphView->legend->itemWithPlottable( graph ) : Q_NULLPTR;
+        if ( item )
+            item->setSelected( item->selected() );
 #if !defined(HAS_QCUSTOMPLOT_V2)
         graph->setSelected( graph->selected() );
 #endif
@@ -338,44 +448,37 @@ void PerformanceDataTimelineView::handleSelectionChanged()
 }
 
 /**
- * @brief PerformanceDataTimelineView::handleItemClick
- * @param item - the item that received the click
+ * @brief PerformanceDataTimelineView::handlePlottableClick
+ * @param plottable - the plottable that received the click
+ * @param dataIndex - the index of the event that was clicked
  * @param event - the mouse event that caused the click
  *
- * Handle the user clicking an item in the graph.  Present overlay popup with more detailed
- * information of the graph item represented by the item that was clicked.
+ * Handle the user clicking an event lane in the graph.  Present overlay popup with more detailed
+ * information of the event that was clicked.
  */
-void PerformanceDataTimelineView::handleItemClick(QCPAbstractItem *item, QMouseEvent *event)
+#if defined(HAS_QCUSTOMPLOT_V2)
+void PerformanceDataTimelineView::handlePlottableClick(QCPAbstractPlottable *plottable, int dataIndex, QMouseEvent *event)
+#else
+void PerformanceDataTimelineView::handlePlottableClick(QCPAbstractPlottable *plottable, QMouseEvent *event)
+#endif
 {
     Q_UNUSED( event )
-#ifdef HAS_ITEM_CLICK_DEBUG
-    QString text;
-    QTextStream output( &text );
-#endif
 
-    OSSDataTransferItem* dataXferItem = qobject_cast< OSSDataTransferItem* >( item );
-    if ( dataXferItem ) {
-#ifdef HAS_ITEM_CLICK_DEBUG
-        output << "Data Transfer: " << *dataXferItem;
-#endif
-    }
-    else {
-        OSSKernelExecutionItem* kernelExecItem = qobject_cast< OSSKernelExecutionItem* >( item );
-        if ( kernelExecItem ) {
-#ifdef HAS_ITEM_CLICK_DEBUG
-            output << "Kernel Execution: " << *kernelExecItem;
+    OSSEventLanePlottable* lane = qobject_cast< OSSEventLanePlottable* >( plottable );
+
+    if ( Q_NULLPTR == lane )
+        return;
+
+#if !defined(HAS_QCUSTOMPLOT_V2)
+    const int dataIndex = lane->eventAt( event->pos() );
 #endif
-        }
-        else {
-            OSSPeriodicSampleItem* sampleItem = qobject_cast< OSSPeriodicSampleItem* >( item );
-            if ( sampleItem ) {
 
-            }
-        }
-    }
+    if ( dataIndex < 0 || dataIndex >= lane->eventCount() )
+        return;
 
 #ifdef HAS_ITEM_CLICK_DEBUG
-    qDebug() << "PerformanceDataTimelineView::handleItemClick: " << text;
+    qDebug() << "PerformanceDataTimelineView::handlePlottableClick: " << lane->styleName( dataIndex )
+             << "timeBegin=" << lane->timeBegin( dataIndex ) << "timeEnd=" << lane->timeEnd( dataIndex ) << "value=" << lane->value( dataIndex );
 #endif
 }
 
@@ -565,7 +668,7 @@ QCPRange PerformanceDataTimelineView::getGraphInfoForMetricGroup(const QCPAxis *
  * - no auto tick value and label computation
  * - font for tick labels
  * - set lower value of axis range to be zero and make the axis grid visible but no sub-grid
- * - allow dragging and zoom of axis range
+ * - allow dragging and zoom of axis range (of both axes for the rank axis of a trace graph)
  * - setup signal/slot connections to handle axis range changes for individual axis and for metric group
  */
 void PerformanceDataTimelineView::initPlotView(const QString &clusteringCriteriaName, const QString clusterName, QCPAxisRect *axisRect, double xAxisLower, double xAxisUpper, bool yAxisVisible, double yAxisLower, double yAxisUpper)
@@ -659,13 +762,32 @@ void PerformanceDataTimelineView::initPlotView(const QString &clusteringCriteria
             yAxis->setAutoTicks( true );
             yAxis->setAutoTickLabels( true );
 #else
-            // create ticker
+            // create ticker with a tick on every rank unless there are too many visible ranks
             QSharedPointer< QCPAxisTickerFixed > ticker( new QCPAxisTickerFixed );
-            ticker->setTickCount( yAxisUpper );
+            ticker->setTickStep( 1.0 );
+            ticker->setScaleStrategy( QCPAxisTickerFixed::ssMultiples );
+            ticker->setTickCount( qMin( yAxisUpper, (double) MAX_RANK_ROWS ) );
             yAxis->setTicker( ticker );
 #endif
+            // the height is sized for at most MAX_RANK_ROWS ranks; only the lanes of the visible ranks are drawn
             const int factor = ( yAxisUpper > 8 ) ? 50 : 80;
-            setFixedHeight( factor * qMax( 2.0, yAxisUpper ) );
+            setFixedHeight( factor * qBound( 2.0, yAxisUpper, (double) MAX_RANK_ROWS ) );
+
+            // the rank axis can be dragged and zoomed to scroll through the ranks
+            if ( xAxis ) {
+                axisRect->setRangeDragAxes( xAxis, yAxis );
+                axisRect->setRangeZoomAxes( xAxis, yAxis );
+            }
+
+            yAxis->setProperty( "rankRangeLower", yAxisLower );
+            yAxis->setProperty( "rankRangeUpper", yAxisUpper );
+
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
+            connect( yAxis, static_cast<void(QCPAxis::*)(const QCPRange &newRange)>(&QCPAxis::rangeChanged),
+                     this, &PerformanceDataTimelineView::handleRankAxisRangeChange );
+#else
+            connect( yAxis, SIGNAL(rangeChanged(QCPRange)), this, SLOT(handleRankAxisRangeChange(QCPRange)) );
+#endif
         }
         else {
             setFixedHeight( QWIDGETSIZE_MAX );
@@ -883,70 +1005,35 @@ void PerformanceDataTimelineView::handleAddCluster(const QString &clusteringCrit
  * @param time_origin - the time origin of the experiment
  * @param details - the details of the data transfer event
  *
- * Find the axis rect associated with the specified metric group and metric name.  Create the data transfer graph item from the details using the associated axis rect.
- * Add graph item to QCustomPlot instance.
+ * Find the event lane associated with the specified metric group and metric name.  Add the data transfer event from the details to the event lane.
  */
 void PerformanceDataTimelineView::handleAddDataTransfer(const QString &clusteringCriteriaName, const QString &clusterName, const Base::Time &time_origin, const CUDA::DataTransfer &details)
 {
-    QCPAxisRect* axisRect( Q_NULLPTR );
-
-    {
-        QMutexLocker guard( &m_mutex );
-
-        if ( m_metricGroups.contains( clusteringCriteriaName ) ) {
-            QMap< QString, QCPAxisRect* >& axisRects = m_metricGroups[ clusteringCriteriaName ]->axisRects;
-            if ( axisRects.contains( clusterName ) )
-                axisRect = axisRects[ clusterName ];
-        }
-    }
+    OSSEventLanePlottable* lane = getEventLane( clusteringCriteriaName, clusterName );
 
-    if ( Q_NULLPTR == axisRect )
+    if ( Q_NULLPTR == lane )
         return;
 
-    OSSDataTransferItem* dataXferItem = new OSSDataTransferItem( axisRect, ui->graphView );
-
-    dataXferItem->setData( time_origin, details );
-
-#if !defined(HAS_QCUSTOMPLOT_V2)
-    ui->graphView->addItem( dataXferItem );
-#endif
+    lane->addDataTransfer( getTimelineTime( details.time_begin, time_origin ), getTimelineTime( details.time_end, time_origin ) );
 }
 
 /**
- * @brief PerformanceDataTimelineView::handleAddTraceItem
+ * @brief PerformanceDataTimelineView::handleAddTraceItems
  * @param clusteringCriteriaName - the clustering criteria name
  * @param clusterName - the cluster name
  * @param functionName - name of function that was traced
- * @param startTime - the start time of the trace event
- * @param endTime - the end time of the trace event
- * @param rankOrThread - the rank or thread id in which the trace event occurred
+ * @param store - the trace events of the function
  *
- * This method handles adding a trace event to the axis rect for the trace graph.
+ * This method handles adding the trace events of a function to the event lane of the axis rect for the trace graph.
  */
-void PerformanceDataTimelineView::handleAddTraceItem(const QString &clusteringCriteriaName, const QString &clusterName, const QString &functionName, double startTime, double endTime, int rankOrThread)
+void PerformanceDataTimelineView::handleAddTraceItems(const QString &clusteringCriteriaName, const QString &clusterName, const QString &functionName, const TraceEventStorePtr &store)
 {
-    QCPAxisRect* axisRect( Q_NULLPTR );
-
-    {
-        QMutexLocker guard( &m_mutex );
+    OSSEventLanePlottable* lane = getEventLane( clusteringCriteriaName, clusterName );
 
-        if ( m_metricGroups.contains( clusteringCriteriaName ) ) {
-            QMap< QString, QCPAxisRect* >& axisRects = m_metricGroups[ clusteringCriteriaName ]->axisRects;
-            if ( axisRects.contains( clusterName ) )
-                axisRect = axisRects[ clusterName ];
-        }
-    }
-
-    if ( Q_NULLPTR == axisRect )
+    if ( Q_NULLPTR == lane || store.isNull() )
         return;
 
-    OSSTraceItem* traceItem = new OSSTraceItem( axisRect, ui->graphView );
-
-    traceItem->setData( functionName, startTime, endTime, rankOrThread );
-
-#if !defined(HAS_QCUSTOMPLOT_V2)
-    ui->graphView->addItem( traceItem );
-#endif
+    lane->addTraceEvents( functionName, *store );
 }
 
 /**
@@ -956,33 +1043,16 @@ void PerformanceDataTimelineView::handleAddTraceItem(const QString &clusteringCr
  * @param time_origin - the time origin of the experiment
  * @param details - the details of the kernel execution event
  *
- * Find the axis rect associated with the specified metric group and metric name.  Create the kernel execution graph item from the details using the associated axis rect.
- * Add graph item to QCustomPlot instance.
+ * Find the event lane associated with the specified metric group and metric name.  Add the kernel execution event from the details to the event lane.
  */
 void PerformanceDataTimelineView::handleAddKernelExecution(const QString &clusteringCriteriaName, const QString &clusterName, const Base::Time &time_origin, const CUDA::KernelExecution &details)
 {
-    QCPAxisRect* axisRect( Q_NULLPTR );
-
-    {
-        QMutexLocker guard( &m_mutex );
-
-        if ( m_metricGroups.contains( clusteringCriteriaName ) ) {
-            QMap< QString, QCPAxisRect* >& axisRects = m_metricGroups[ clusteringCriteriaName ]->axisRects;
-            if ( axisRects.contains( clusterName ) )
-                axisRect = axisRects[ clusterName ];
-        }
-    }
+    OSSEventLanePlottable* lane = getEventLane( clusteringCriteriaName, clusterName );
 
-    if ( Q_NULLPTR == axisRect )
+    if ( Q_NULLPTR == lane )
         return;
 
-    OSSKernelExecutionItem* kernelExecItem = new OSSKernelExecutionItem( axisRect, ui->graphView );
-
-    kernelExecItem->setData( time_origin, details );
-
-#if !defined(HAS_QCUSTOMPLOT_V2)
-    ui->graphView->addItem( kernelExecItem );
-#endif
+    lane->addKernelExecution( getTimelineTime( details.time_begin, time_origin ), getTimelineTime( details.time_end, time_origin ) );
 }
 
 /**
@@ -993,38 +1063,71 @@ void PerformanceDataTimelineView::handleAddKernelExecution(const QString &cluste
  * @param time_end - the end time of the periodic sample (relative to time origin of the experiment)
  * @param count - the period sample counter value
  *
- * Find the axis rect associated with the specified metric group and sample counter index.  Create the periodic sample graph item from the details using the associated axis rect.
- * Add graph item to QCustomPlot instance.  Update y-axis upper range value if counter value is greater than the current y-axis upper range value.
+ * Find the event lane associated with the specified metric group and sample counter index.  Add the periodic sample to the event lane.
+ * Update y-axis upper range value if counter value is greater than the current y-axis upper range value.
  */
 void PerformanceDataTimelineView::handleAddPeriodicSample(const QString &clusteringCriteriaName, const QString& clusterName, const double &time_begin, const double &time_end, const double &count)
 {
-    QCPAxisRect* axisRect( Q_NULLPTR );
+    OSSEventLanePlottable* lane = getEventLane( clusteringCriteriaName, clusterName );
 
-    {
-        QMutexLocker guard( &m_mutex );
+    if ( Q_NULLPTR == lane )
+        return;
 
-        if ( m_metricGroups.contains( clusteringCriteriaName ) ) {
-            QMap< QString, QCPAxisRect* >& axisRects = m_metricGroups[ clusteringCriteriaName ]->axisRects;
-            if ( axisRects.contains( clusterName ) )
-                axisRect = axisRects[ clusterName ];
-        }
-    }
+    lane->addPeriodicSample( time_begin, time_end, count );
 
-    if ( Q_NULLPTR == axisRect )
-        return;
+    QCPAxis* yAxis = lane->valueAxis();
+
+    if ( count > yAxis->range().upper )
+        yAxis->setRangeUpper( count );
+}
+
+/**
+ * @brief PerformanceDataTimelineView::getEventLane
+ * @param clusteringCriteriaName - the clustering criteria name
+ * @param clusterName - the cluster name
+ * @return - the event lane of the axis rect associated with the metric group and cluster name (or null if there is no such axis rect)
+ *
+ * Find the event lane of the axis rect associated with the specified metric group and cluster name.  The event lane is created
+ * when the first event is added to the axis rect.
+ */
+OSSEventLanePlottable *PerformanceDataTimelineView::getEventLane(const QString &clusteringCriteriaName, const QString &clusterName)
+{
+    QMutexLocker guard( &m_mutex );
+
+    if ( ! m_metricGroups.contains( clusteringCriteriaName ) )
+        return Q_NULLPTR;
 
-    OSSPeriodicSampleItem* periodicSampleItem = new OSSPeriodicSampleItem( axisRect, ui->graphView );
+    MetricGroup* group = m_metricGroups[ clusteringCriteriaName ];
 
-    periodicSampleItem->setData( time_begin, time_end, count );
+    OSSEventLanePlottable* lane = group->eventLanes.value( clusterName, Q_NULLPTR );
 
+    if ( Q_NULLPTR == lane && group->axisRects.contains( clusterName ) ) {
+        lane = new OSSEventLanePlottable( group->axisRects[ clusterName ] );
 #if !defined(HAS_QCUSTOMPLOT_V2)
-   ui->graphView->addItem( periodicSampleItem );
+        ui->graphView->addPlottable( lane );
 #endif
+        lane->removeFromLegend();
+        group->eventLanes.insert( clusterName, lane );
+    }
 
-    QCPAxis* yAxis = axisRect->axis( QCPAxis::atLeft );
+    return lane;
+}
 
-    if ( count > yAxis->range().upper )
-        yAxis->setRangeUpper( count );
+/**
+ * @brief PerformanceDataTimelineView::setEventLanesCoarse
+ * @param coarse - whether the event lanes draw only a coarse approximation of the events
+ *
+ * Set all event lanes of all metric groups coarse or exact.
+ */
+void PerformanceDataTimelineView::setEventLanesCoarse(bool coarse)
+{
+    QMutexLocker guard( &m_mutex );
+
+    foreach ( MetricGroup* group, m_metricGroups ) {
+        foreach ( OSSEventLanePlottable* lane, group->eventLanes ) {
+            lane->setCoarse( coarse );
+        }
+    }
 }
 
 /**
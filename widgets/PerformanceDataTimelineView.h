@@ -26,11 +26,14 @@
 
 #include <QWidget>
 #include <QMutex>
+#include <QTimer>
 
 #include "qcustomplot.h"
 
 #include "common/openss-gui-config.h"
 
+#include "managers/TraceEventStore.h"
+
 namespace Ui {
 class PerformanceDataTimelineView;
 }
@@ -51,6 +54,7 @@ namespace GUI {
 
 class OSSEventsSummaryItem;
 class OSSHighlightItem;
+class OSSEventLanePlottable;
 
 class PerformanceDataTimelineView : public QWidget
 {
@@ -79,9 +83,15 @@ private slots:
 
     void handleAxisRangeChange(const QCPRange &requestedRange);
     void handleAxisRangeChangeForMetricGroup(QCPAxis *senderAxis, const QCPRange &requestedRange);
+    void handleRankAxisRangeChange(const QCPRange &requestedRange);
+    void handleRefineTimeout();
     void handleAxisLabelDoubleClick(QCPAxis* axis, QCPAxis::SelectablePart part);
     void handleSelectionChanged();
-    void handleItemClick(QCPAbstractItem *item, QMouseEvent *event);
+#if defined(HAS_QCUSTOMPLOT_V2)
+    void handlePlottableClick(QCPAbstractPlottable *plottable, int dataIndex, QMouseEvent *event);
+#else
+    void handlePlottableClick(QCPAbstractPlottable *plottable, QMouseEvent *event);
+#endif
 
     void handleAddCluster(const QString& clusteringCriteriaName, const QString& clusterName, double xAxisLower, double xAxisUpper, bool yAxisVisible, double yAxisLower, double yAxisUpper);
 
@@ -90,12 +100,10 @@ private slots:
                                const Base::Time &time_origin,
                                const CUDA::DataTransfer &details);
 
-    void handleAddTraceItem(const QString &clusteringCriteriaName,
-                            const QString &clusterName,
-                            const QString &functionName,
-                            double startTime,
-                            double endTime,
-                            int rankOrThread);
+    void handleAddTraceItems(const QString &clusteringCriteriaName,
+                             const QString &clusterName,
+                             const QString &functionName,
+                             const TraceEventStorePtr &store);
 
     void handleAddKernelExecution(const QString& clusteringCriteriaName,
                                   const QString& clusterName,
@@ -133,6 +141,8 @@ private:
     QList< QCPAxis* > getAxesForMetricGroup(const QCPAxis::AxisType axisType, const QString& metricGroupName);
     const QCPRange getRange(const QVector<double> &values, bool sortHint = false);
     QCPRange getGraphInfoForMetricGroup(const QCPAxis *axis, QString& clusteringCriteriaName, QString& clusterName, QSize& size);
+    OSSEventLanePlottable* getEventLane(const QString& clusteringCriteriaName, const QString& clusterName);
+    void setEventLanesCoarse(bool coarse);
 
 private:
 
@@ -145,6 +155,7 @@ private:
         QStringList metricList;                   // list of metrics
         QCPMarginGroup* marginGroup;              // one margin group to line up the left and right axes
         QMap< QString, OSSEventsSummaryItem* > eventSummary;
+        QMap< QString, OSSEventLanePlottable* > eventLanes;  // one plottable holding the events of each axis rect
     } MetricGroup;
 
     QMap< QString, MetricGroup* > m_metricGroups; // defines each metric group
@@ -155,6 +166,8 @@ private:
 
     OSSHighlightItem* m_highlightItem;
 
+    QTimer m_refineTimer;   // restarted by each range change; the event lanes are drawn exactly once it times out
+
 };
 
 
@@ -23,8 +23,11 @@
 
 #include "ViewSortFilterProxyModel.h"
 
+#include "MetricTableModel.h"
+
 #include <QDateTime>
 #include <QStringList>
+#include <QHash>
 
 #include <limits>
 
@@ -43,6 +46,9 @@ ViewSortFilterProxyModel::ViewSortFilterProxyModel(const QString &type, QObject
     : DefaultSortFilterProxyModel( type, parent )
     , m_lower( std::numeric_limits<double>::min() )
     , m_upper( std::numeric_limits<double>::max() )
+    , m_rangeSet( false )
+    , m_metricTableModel( Q_NULLPTR )
+    , m_indexValid( false )
 {
     setDynamicSortFilter( true );
 }
@@ -57,6 +63,39 @@ ViewSortFilterProxyModel::~ViewSortFilterProxyModel()
 
 }
 
+/**
+ * @brief ViewSortFilterProxyModel::setSourceModel
+ * @param sourceModel - the source model
+ *
+ * The method reimplements QSortFilterProxyModel::setSourceModel.  Any change to the rows of the source model invalidates
+ * the interval index.  The connections are made before the base class connects to the source model so that the index is
+ * already invalid when the base class filters the changed rows.  A MetricTableModel only appends rows to its storage and its
+ * rows are indexed in storage order, so appending rows or changing the order, row filter or paging of the rows exposed by the
+ * model leaves the index valid for the rows already indexed.
+ */
+void ViewSortFilterProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    if ( this->sourceModel() ) {
+        disconnect( this->sourceModel(), Q_NULLPTR, this, SLOT(invalidateIndex()) );
+    }
+
+    invalidateIndex();
+
+    m_metricTableModel = qobject_cast< const MetricTableModel* >( sourceModel );
+
+    if ( sourceModel ) {
+        if ( ! m_metricTableModel ) {
+            connect( sourceModel, SIGNAL(rowsInserted(QModelIndex,int,int)), this, SLOT(invalidateIndex()) );
+            connect( sourceModel, SIGNAL(rowsRemoved(QModelIndex,int,int)), this, SLOT(invalidateIndex()) );
+            connect( sourceModel, SIGNAL(layoutChanged()), this, SLOT(invalidateIndex()) );
+            connect( sourceModel, SIGNAL(modelReset()), this, SLOT(invalidateIndex()) );
+            connect( sourceModel, SIGNAL(dataChanged(QModelIndex,QModelIndex)), this, SLOT(invalidateIndex()) );
+        }
+    }
+
+    DefaultSortFilterProxyModel::setSourceModel( sourceModel );
+}
+
 /**
  * @brief ViewSortFilterProxyModel::setColumnHeaders
  * @param columnHeaders - the subset of columns to be included in the proxy model
@@ -86,14 +125,175 @@ void ViewSortFilterProxyModel::setColumnHeaders(const QStringList &columnHeaders
  * @param lower - the lower value of the filter range
  * @param upper - the upper value of the filter range
  *
- * This method updates the filter range and updates the proxy model by invalidating the filter.
+ * This method updates the filter range and updates the proxy model by invalidating the filter.  The rows of the accepted
+ * types overlapping the range are found by binary search in the interval index of each accepted type.  The index covers
+ * all storage rows of a MetricTableModel, which only exposes the rows accepted by the proxy model as it pages over its rows.
  */
 void ViewSortFilterProxyModel::setFilterRange(double lower, double upper)
 {
     m_lower = lower;
     m_upper = upper;
+    m_rangeSet = true;
+
+    if ( ! m_indexValid || ( m_metricTableModel && m_timedRows.size() != m_metricTableModel->storageRowCount() ) )
+        buildIndex();
+
+    // mark the rows overlapping the new range found by the interval index
+    m_inRange.fill( false, m_timedRows.size() );
+
+    if ( m_type == "*" ) {
+        foreach ( int id, m_index.findOverlapping( m_lower, m_upper ) ) {
+            m_inRange.setBit( m_indexedRows[ id ] );
+        }
+    }
+    else {
+        foreach ( int key, m_typeKeys ) {
+            foreach ( int id, m_index.findOverlapping( key, m_lower, m_upper ) ) {
+                m_inRange.setBit( m_indexedRows[ id ] );
+            }
+        }
+    }
+
+    invalidateRowFilter();
+}
+
+/**
+ * @brief ViewSortFilterProxyModel::countAcceptedRows
+ * @param criteria - list of criteria items - each consisting of a column name and filter regular expression
+ * @return - the number of source rows the criteria would accept in the current time range
+ *
+ * The method reimplements DefaultSortFilterProxyModel::countAcceptedRows.  The indexed rows rejected by the time range and
+ * type filter are excluded from the count of rows accepted by the criteria.
+ */
+int ViewSortFilterProxyModel::countAcceptedRows(const QList<QPair<QString, QString> > &criteria) const
+{
+    QBitArray rejectedRows;
+
+    if ( m_indexValid && m_metricTableModel )
+        rejectedRows = m_timedRows & ~m_inRange;
 
-    invalidateFilter();
+    return countFilteredRows( criteria, rejectedRows );
+}
+
+/**
+ * @brief ViewSortFilterProxyModel::invalidateIndex
+ *
+ * Mark the interval index as out of date after a change of the source model.  Rows are filtered by reading the source
+ * model until the index is rebuilt on the next range change.
+ */
+void ViewSortFilterProxyModel::invalidateIndex()
+{
+    m_indexValid = false;
+}
+
+/**
+ * @brief ViewSortFilterProxyModel::buildIndex
+ *
+ * Read the "Type", "Time Begin" and "Time End" values of each source row once and build the interval index of the rows
+ * having a type and begin and end times.  The events are keyed by type and the keys of the types accepted by the type
+ * filter are determined once for each distinct type.  The values are read directly from the typed column storage of a
+ * MetricTableModel.
+ */
+void ViewSortFilterProxyModel::buildIndex()
+{
+    QAbstractItemModel* model = sourceModel();
+
+    const int rowCount = m_metricTableModel ? m_metricTableModel->storageRowCount() : ( model ? model->rowCount() : 0 );
+
+    QVector< double > timeBegin;
+    QVector< double > timeEnd;
+    QVector< int > keys;
+
+    m_indexedRows.clear();
+    m_types.clear();
+    m_typeKeys.clear();
+    m_timedRows.fill( false, rowCount );
+
+    if ( hasTypedTimes() ) {
+        QHash< int, int > typeIdKeys;   // map interned string id of type to key
+
+        for ( int row=0; row<rowCount; ++row ) {
+            const int typeId = m_metricTableModel->stringId( row, 0 );    // "Type" value
+
+            if ( typeId < 0 || m_metricTableModel->isNull( row, 2 ) || m_metricTableModel->isNull( row, 3 ) )
+                continue;
+
+            QHash< int, int >::const_iterator iter = typeIdKeys.constFind( typeId );
+            if ( iter == typeIdKeys.constEnd() ) {
+                iter = typeIdKeys.insert( typeId, m_types.size() );
+                m_types << m_metricTableModel->internedString( typeId );
+            }
+
+            m_indexedRows << row;
+            timeBegin << m_metricTableModel->doubleValue( row, 2 );      // "Time Begin" value
+            timeEnd << m_metricTableModel->doubleValue( row, 3 );        // "Time End" value
+            keys << iter.value();
+            m_timedRows.setBit( row );
+        }
+    }
+    else {
+        QHash< QString, int > typeKeys;   // map type to key
+
+        // the rows of a MetricTableModel are read in storage order including the rows not exposed by the model yet
+        const bool hasTimes = ! m_metricTableModel || m_metricTableModel->columnCount() >= 4;
+
+        for ( int row=0; hasTimes && row<rowCount; ++row ) {
+            QVariant typeVar = m_metricTableModel ? m_metricTableModel->storedValue( row, 0 ) : model->data( model->index( row, 0 ) );       // "Type" value
+            QVariant timeBeginVar = m_metricTableModel ? m_metricTableModel->storedValue( row, 2 ) : model->data( model->index( row, 2 ) );  // "Time Begin" value
+            QVariant timeEndVar = m_metricTableModel ? m_metricTableModel->storedValue( row, 3 ) : model->data( model->index( row, 3 ) );    // "Time End" value
+
+            if ( QVariant::String == typeVar.type() && QVariant::Double == timeBeginVar.type() && QVariant::Double == timeEndVar.type()  ) {
+                const QString type = typeVar.toString();
+
+                QHash< QString, int >::const_iterator iter = typeKeys.constFind( type );
+                if ( iter == typeKeys.constEnd() ) {
+                    iter = typeKeys.insert( type, m_types.size() );
+                    m_types << type;
+                }
+
+                m_indexedRows << row;
+                timeBegin << timeBeginVar.toDouble();
+                timeEnd << timeEndVar.toDouble();
+                keys << iter.value();
+                m_timedRows.setBit( row );
+            }
+        }
+    }
+
+    for ( int key=0; key<m_types.size(); ++key ) {
+        if ( m_type == "*" || m_types.at( key ).startsWith( m_type ) )
+            m_typeKeys << key;
+    }
+
+    m_index.build( timeBegin, timeEnd, keys );
+
+    m_indexValid = true;
+}
+
+/**
+ * @brief ViewSortFilterProxyModel::hasTypedTimes
+ * @return - indicates whether the source model is a MetricTableModel storing the "Type" values as strings and the "Time Begin" and "Time End" values as doubles
+ */
+bool ViewSortFilterProxyModel::hasTypedTimes() const
+{
+    if ( ! m_metricTableModel || m_metricTableModel->columnCount() < 4 )
+        return false;
+
+    return MetricViewDataBlock::String == m_metricTableModel->columnType( 0 ) &&
+            MetricViewDataBlock::Double == m_metricTableModel->columnType( 2 ) &&
+            QMetaType::Double == m_metricTableModel->columnUserType( 2 ) &&
+            MetricViewDataBlock::Double == m_metricTableModel->columnType( 3 ) &&
+            QMetaType::Double == m_metricTableModel->columnUserType( 3 );
+}
+
+/**
+ * @brief ViewSortFilterProxyModel::indexRow
+ * @param source_row - the row of the item in the model
+ * @return - the row of the index - the storage row for a MetricTableModel and otherwise the source row
+ */
+int ViewSortFilterProxyModel::indexRow(int source_row) const
+{
+    return m_metricTableModel ? m_metricTableModel->storageRow( source_row ) : source_row;
 }
 
 /**
@@ -105,30 +305,86 @@ void ViewSortFilterProxyModel::setFilterRange(double lower, double upper)
  * The method reimplements QSortFilterProxyModel::filterAcceptsRow.
  *
  * The method implements a filter to keep the specified row if either "Time Begin" value within range defined by ['m_lower' .. 'm_upper'] OR
- * "Time Begin" is before 'm_lower' but "Time End" is equal to or greater than 'm_lower'.
+ * "Time Begin" is before 'm_lower' but "Time End" is equal to or greater than 'm_lower'.  When the interval index covers the row
+ * the time range and type tests are a lookup of the rows found by the index.
  */
 bool ViewSortFilterProxyModel::filterAcceptsRow(int source_row, const QModelIndex &source_parent) const
 {
     bool result( DefaultSortFilterProxyModel::filterAcceptsRow( source_row, source_parent ) );
 
+    if ( ! result )
+        return false;
+
+    if ( m_indexValid && ! source_parent.isValid() ) {
+        const int row = indexRow( source_row );
+        if ( row >= 0 && row < m_timedRows.size() )
+            return ! m_timedRows.testBit( row ) || m_inRange.testBit( row );
+    }
+
     QModelIndex indexType = sourceModel()->index( source_row, 0, source_parent );       // "Type" index
-    QVariant typeVar = sourceModel()->data( indexType );
     QModelIndex indexTimeBegin = sourceModel()->index( source_row, 2, source_parent );  // "Time Begin" index
-    QVariant timeBeginVar = sourceModel()->data( indexTimeBegin );
     QModelIndex indexTimeEnd = sourceModel()->index( source_row, 3, source_parent );    // "Time End" index
-    QVariant timeEndVar = sourceModel()->data( indexTimeEnd );
 
+    return acceptsEvent( sourceModel()->data( indexType ), sourceModel()->data( indexTimeBegin ), sourceModel()->data( indexTimeEnd ) );
+}
+
+/**
+ * @brief ViewSortFilterProxyModel::acceptsEvent
+ * @param typeVar - the "Type" value of the row
+ * @param timeBeginVar - the "Time Begin" value of the row
+ * @param timeEndVar - the "Time End" value of the row
+ * @return - indicates whether a row having the values is accepted by the type filter and the filter range
+ *
+ * The row is kept if either "Time Begin" value within range defined by ['m_lower' .. 'm_upper'] OR "Time Begin" is before
+ * 'm_lower' but "Time End" is equal to or greater than 'm_lower'.  Rows without a type and begin and end times are kept.
+ */
+bool ViewSortFilterProxyModel::acceptsEvent(const QVariant &typeVar, const QVariant &timeBeginVar, const QVariant &timeEndVar) const
+{
     if ( QVariant::String == typeVar.type() && QVariant::Double == timeBeginVar.type() && QVariant::Double == timeEndVar.type()  ) {
         const QString type = typeVar.toString();           // "Type" value
         const double timeBegin = timeBeginVar.toDouble();  // "Time Begin" value
         const double timeEnd = timeEndVar.toDouble();      // "Time End" value
-        // keep row if either "Time Begin" value within range defined by ['m_lower' .. 'm_upper'] OR
-        // "Time Begin" is before 'm_lower' but "Time End" is equal to or greater than 'm_lower'
-        result &= ( ( m_type == "*" || type.startsWith( m_type ) ) &&
-                  ( ( timeBegin >= m_lower && timeBegin <= m_upper ) || ( timeBegin < m_lower && timeEnd >= m_lower ) ) );
+        return ( ( m_type == "*" || type.startsWith( m_type ) ) &&
+                 ( ( timeBegin >= m_lower && timeBegin <= m_upper ) || ( timeBegin < m_lower && timeEnd >= m_lower ) ) );
     }
 
-    return result;
+    return true;
+}
+
+/**
+ * @brief ViewSortFilterProxyModel::filtersStorageRows
+ * @return - indicates whether the proxy model rejects any rows of a MetricTableModel source model
+ *
+ * The method reimplements DefaultSortFilterProxyModel::filtersStorageRows.  Rows are rejected by the type filter of a view of
+ * one type of event and once a filter range has been set.
+ */
+bool ViewSortFilterProxyModel::filtersStorageRows() const
+{
+    return m_type != "*" || m_rangeSet || DefaultSortFilterProxyModel::filtersStorageRows();
+}
+
+/**
+ * @brief ViewSortFilterProxyModel::filterAcceptsStorageRow
+ * @param storageRow - the storage row of a MetricTableModel source model
+ * @return - indicates whether the storage row is accepted - the same as ViewSortFilterProxyModel::filterAcceptsRow for the source row
+ *
+ * The method reimplements DefaultSortFilterProxyModel::filterAcceptsStorageRow.  The rows covered by the interval index are looked
+ * up in the rows found by the index; the values of other rows are read from the typed storage.
+ */
+bool ViewSortFilterProxyModel::filterAcceptsStorageRow(int storageRow) const
+{
+    if ( ! DefaultSortFilterProxyModel::filterAcceptsStorageRow( storageRow ) )
+        return false;
+
+    if ( m_indexValid && storageRow < m_timedRows.size() )
+        return ! m_timedRows.testBit( storageRow ) || m_inRange.testBit( storageRow );
+
+    if ( ! m_metricTableModel || m_metricTableModel->columnCount() < 4 )
+        return true;
+
+    return acceptsEvent( m_metricTableModel->storedValue( storageRow, 0 ),      // "Type" value
+                         m_metricTableModel->storedValue( storageRow, 2 ),      // "Time Begin" value
+                         m_metricTableModel->storedValue( storageRow, 3 ) );    // "Time End" value
 }
 
 /**
@@ -28,13 +28,21 @@
 
 #include "common/openss-gui-config.h"
 
+#include "managers/EventIntervalIndex.h"
+
 #include <QSet>
 #include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QBitArray>
 
 
 namespace ArgoNavis { namespace GUI {
 
 
+class MetricTableModel;
+
+
 class ViewSortFilterProxyModel : public DefaultSortFilterProxyModel
 {
     Q_OBJECT
@@ -44,22 +52,53 @@ public:
     explicit ViewSortFilterProxyModel(const QString& type = "*", QObject* parent = Q_NULLPTR);
     virtual ~ViewSortFilterProxyModel();
 
+    virtual void setSourceModel(QAbstractItemModel *sourceModel) Q_DECL_OVERRIDE;
+
     void setColumnHeaders(const QStringList &columnHeaders);
 
     void setFilterRange(double lower, double upper);
 
+    virtual int countAcceptedRows(const QList<QPair<QString,QString>>& criteria) const Q_DECL_OVERRIDE;
+
 protected:
 
     bool filterAcceptsRow(int source_row, const QModelIndex &source_parent) const Q_DECL_OVERRIDE;
     bool filterAcceptsColumn(int source_column, const QModelIndex &source_parent) const Q_DECL_OVERRIDE;
 
+    virtual bool filtersStorageRows() const Q_DECL_OVERRIDE;
+    virtual bool filterAcceptsStorageRow(int storageRow) const Q_DECL_OVERRIDE;
+
+private slots:
+
+    void invalidateIndex();
+
 private:
 
+    void buildIndex();
+    bool hasTypedTimes() const;
+    int indexRow(int source_row) const;
+    bool acceptsEvent(const QVariant& typeVar, const QVariant& timeBeginVar, const QVariant& timeEndVar) const;
+
     double m_lower;
     double m_upper;
+    bool m_rangeSet;                // whether a filter range has been set
 
     QSet< int > m_columns;
 
+    // source model when it is a MetricTableModel - its rows are indexed in storage order which is unchanged by appending rows
+    const MetricTableModel* m_metricTableModel;
+
+    // interval index of the "Time Begin" and "Time End" values of the source rows built on the first range change - each
+    // event is keyed by the index of its "Type" value in the list of distinct types; it is not the index of the timeline
+    // event lanes, which is keyed by rank over the lane rows re-sorted by begin time and covers only the events plotted
+    EventIntervalIndex m_index;
+    QVector< int > m_indexedRows;   // the indexed row of each indexed event
+    QStringList m_types;            // the distinct "Type" values of the indexed events
+    QVector< int > m_typeKeys;      // keys of the distinct types accepted by the type filter
+    QBitArray m_timedRows;          // set bit for each indexed row having a type and begin and end times
+    QBitArray m_inRange;            // set bit for each indexed row of an accepted type overlapping the filter range
+    bool m_indexValid;
+
 };
 
 